@@ -0,0 +1,324 @@
+//
+//  AssetChunkStore.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetChunkStore.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegExp>
+#include <QtCore/QSaveFile>
+
+#include "AssetServerLogging.h"
+
+static const QString MANIFESTS_SUBDIR = "manifests";
+static const QString CHUNKS_SUBDIR = "chunks";
+
+static const quint32 MANIFEST_MAGIC = 0x4b4e4843; // "CHNK"
+static const quint8 MANIFEST_VERSION = 1;
+// magic, version, asset size and chunk count, followed by a hash and size per chunk
+static const qint64 MANIFEST_HEADER_SIZE = sizeof(quint32) + sizeof(quint8) + sizeof(qint64) + sizeof(quint32);
+static const qint64 MANIFEST_ENTRY_SIZE = AssetUtils::SHA256_HASH_LENGTH + sizeof(quint32);
+
+AssetChunkStore::AssetChunkStore(const QDir& storeDirectory) :
+    _manifestsDirectory(storeDirectory),
+    _chunksDirectory(storeDirectory)
+{
+    _isValid = storeDirectory.mkpath(MANIFESTS_SUBDIR) && storeDirectory.mkpath(CHUNKS_SUBDIR) &&
+        _manifestsDirectory.cd(MANIFESTS_SUBDIR) && _chunksDirectory.cd(CHUNKS_SUBDIR);
+
+    if (!_isValid) {
+        qCCritical(asset_server) << "Unable to create chunk store in" << storeDirectory.absolutePath();
+        return;
+    }
+
+    for (const auto& hash : getAssetHashes()) {
+        Manifest manifest;
+        if (readManifest(hash, manifest)) {
+            for (const auto& chunk : manifest.chunks) {
+                ++_chunkReferences[chunk.hash];
+            }
+        }
+    }
+}
+
+QString AssetChunkStore::manifestPath(const AssetUtils::AssetHash& hash) const {
+    return _manifestsDirectory.absoluteFilePath(hash);
+}
+
+QString AssetChunkStore::chunkPath(const QByteArray& chunkHash) const {
+    // Fan chunks out over 256 directories to keep directory listings manageable
+    auto hexHash = QString::fromLatin1(chunkHash.toHex());
+    return _chunksDirectory.absoluteFilePath(hexHash.left(2) + "/" + hexHash);
+}
+
+bool AssetChunkStore::contains(const AssetUtils::AssetHash& hash) const {
+    return _isValid && QFile::exists(manifestPath(hash));
+}
+
+qint64 AssetChunkStore::getAssetSize(const AssetUtils::AssetHash& hash) const {
+    Manifest manifest;
+    return readManifest(hash, manifest) ? manifest.size : -1;
+}
+
+bool AssetChunkStore::readManifest(const AssetUtils::AssetHash& hash, Manifest& manifest) const {
+    if (!_isValid) {
+        return false;
+    }
+
+    QFile file { manifestPath(hash) };
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    quint32 magic;
+    quint8 version;
+    quint32 chunkCount;
+    stream >> magic >> version >> manifest.size >> chunkCount;
+    if (stream.status() != QDataStream::Ok || magic != MANIFEST_MAGIC || version != MANIFEST_VERSION) {
+        qCWarning(asset_server) << "Invalid chunk manifest for" << hash;
+        return false;
+    }
+
+    // Don't trust the count before allocating for it
+    if (file.size() != MANIFEST_HEADER_SIZE + (qint64)chunkCount * MANIFEST_ENTRY_SIZE) {
+        qCWarning(asset_server) << "Chunk manifest for" << hash << "has the wrong size for" << chunkCount << "chunks";
+        return false;
+    }
+
+    manifest.chunks.resize(chunkCount);
+    qint64 totalSize = 0;
+    for (auto& chunk : manifest.chunks) {
+        chunk.hash.resize(AssetUtils::SHA256_HASH_LENGTH);
+        stream.readRawData(chunk.hash.data(), AssetUtils::SHA256_HASH_LENGTH);
+        stream >> chunk.size;
+        totalSize += chunk.size;
+    }
+
+    if (stream.status() != QDataStream::Ok || totalSize != manifest.size) {
+        qCWarning(asset_server) << "Truncated chunk manifest for" << hash;
+        return false;
+    }
+    return true;
+}
+
+bool AssetChunkStore::writeManifest(const AssetUtils::AssetHash& hash, const Manifest& manifest) const {
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream << MANIFEST_MAGIC << MANIFEST_VERSION << manifest.size << (quint32)manifest.chunks.size();
+    for (const auto& chunk : manifest.chunks) {
+        stream.writeRawData(chunk.hash.constData(), chunk.hash.size());
+        stream << chunk.size;
+    }
+
+    return writeFileAtomically(manifestPath(hash), data.constData(), data.size());
+}
+
+bool AssetChunkStore::writeFileAtomically(const QString& path, const char* data, qint64 size) const {
+    // QSaveFile writes to a temporary file and renames it into place, so readers never see a partial chunk
+    QSaveFile file { path };
+    if (!file.open(QIODevice::WriteOnly) || file.write(data, size) != size) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+bool AssetChunkStore::storeAsset(const AssetUtils::AssetHash& hash, const QByteArray& data) {
+    if (!_isValid) {
+        return false;
+    }
+
+    Manifest manifest;
+    manifest.size = data.size();
+
+    std::vector<const char*> chunkData;
+    int chunkStart = 0;
+    for (int chunkEnd : AssetUtils::findChunkBoundaries(data)) {
+        ChunkRef chunk;
+        chunk.size = (quint32)(chunkEnd - chunkStart);
+        chunkData.push_back(data.constData() + chunkStart);
+        chunk.hash = QCryptographicHash::hash(QByteArray::fromRawData(chunkData.back(), chunk.size), QCryptographicHash::Sha256);
+        manifest.chunks.push_back(chunk);
+        chunkStart = chunkEnd;
+    }
+
+    std::lock_guard<std::mutex> lock(_referencesMutex);
+    if (QFile::exists(manifestPath(hash))) {
+        // assets are stored under the hash of their content, so this is the same asset
+        return true;
+    }
+
+    for (size_t i = 0; i < manifest.chunks.size(); ++i) {
+        const auto& chunk = manifest.chunks[i];
+        auto path = chunkPath(chunk.hash);
+        if (_chunkReferences.contains(chunk.hash) || QFile::exists(path)) {
+            ++_chunksDeduplicated;
+        } else {
+            _chunksDirectory.mkpath(QFileInfo(path).absolutePath());
+            if (!writeFileAtomically(path, chunkData[i], chunk.size)) {
+                qCWarning(asset_server) << "Failed to write chunk" << chunk.hash.toHex() << "for asset" << hash;
+                return false;
+            }
+            ++_chunksWritten;
+            _chunkBytesWritten += chunk.size;
+        }
+    }
+
+    if (!writeManifest(hash, manifest)) {
+        qCWarning(asset_server) << "Failed to write chunk manifest for asset" << hash;
+        return false;
+    }
+
+    // Chunks written above without a manifest stay unreferenced if we fail earlier, removeUnreferencedChunks
+    // picks them up
+    for (const auto& chunk : manifest.chunks) {
+        ++_chunkReferences[chunk.hash];
+    }
+
+    ++_assetsStored;
+    _logicalBytesStored += manifest.size;
+    return true;
+}
+
+bool AssetChunkStore::removeAsset(const AssetUtils::AssetHash& hash) {
+    std::lock_guard<std::mutex> lock(_referencesMutex);
+
+    Manifest manifest;
+    if (!readManifest(hash, manifest) || !QFile::remove(manifestPath(hash))) {
+        return false;
+    }
+
+    for (const auto& chunk : manifest.chunks) {
+        auto it = _chunkReferences.find(chunk.hash);
+        if (it != _chunkReferences.end() && --it.value() > 0) {
+            continue;
+        }
+        _chunkReferences.remove(chunk.hash);
+        if (QFile::remove(chunkPath(chunk.hash))) {
+            ++_chunksRemoved;
+        }
+    }
+
+    ++_assetsRemoved;
+    return true;
+}
+
+int AssetChunkStore::removeUnreferencedChunks() {
+    if (!_isValid) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(_referencesMutex);
+
+    int removed = 0;
+    QDirIterator it(_chunksDirectory.absolutePath(), QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        auto chunkHash = QByteArray::fromHex(it.fileName().toLatin1());
+        if (!_chunkReferences.contains(chunkHash) && QFile::remove(it.filePath())) {
+            ++removed;
+        }
+    }
+    _chunksRemoved += removed;
+    return removed;
+}
+
+std::vector<AssetUtils::AssetHash> AssetChunkStore::getAssetHashes() const {
+    std::vector<AssetUtils::AssetHash> hashes;
+    if (!_isValid) {
+        return hashes;
+    }
+
+    QRegExp hashFileRegex { AssetUtils::ASSET_HASH_REGEX_STRING };
+    for (const auto& fileName : _manifestsDirectory.entryList(QDir::Files)) {
+        if (hashFileRegex.exactMatch(fileName)) {
+            hashes.push_back(fileName);
+        }
+    }
+    return hashes;
+}
+
+bool AssetChunkStore::readRange(const AssetUtils::AssetHash& hash, qint64 offset, qint64 length, QByteArray& data) const {
+    Manifest manifest;
+    if (!readManifest(hash, manifest) || offset < 0 || length < 0 || offset + length > manifest.size) {
+        return false;
+    }
+
+    data.clear();
+    data.reserve(length);
+
+    qint64 chunkStart = 0;
+    const qint64 rangeEnd = offset + length;
+    for (const auto& chunk : manifest.chunks) {
+        const qint64 chunkEnd = chunkStart + chunk.size;
+        if (chunkEnd > offset && chunkStart < rangeEnd) {
+            QFile file { chunkPath(chunk.hash) };
+            if (!file.open(QIODevice::ReadOnly)) {
+                qCWarning(asset_server) << "Missing chunk" << chunk.hash.toHex() << "for asset" << hash;
+                return false;
+            }
+
+            const qint64 readStart = std::max(offset, chunkStart) - chunkStart;
+            const qint64 readEnd = std::min(rangeEnd, chunkEnd) - chunkStart;
+            file.seek(readStart);
+            data.append(file.read(readEnd - readStart));
+        }
+        if (chunkEnd >= rangeEnd) {
+            break;
+        }
+        chunkStart = chunkEnd;
+    }
+
+    return data.size() == length;
+}
+
+bool AssetChunkStore::reassemble(const AssetUtils::AssetHash& hash, const QString& destinationPath) const {
+    Manifest manifest;
+    if (!readManifest(hash, manifest)) {
+        return false;
+    }
+
+    QSaveFile destination { destinationPath };
+    if (!destination.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    for (const auto& chunk : manifest.chunks) {
+        QFile file { chunkPath(chunk.hash) };
+        if (!file.open(QIODevice::ReadOnly) || destination.write(file.readAll()) != chunk.size) {
+            qCWarning(asset_server) << "Failed to reassemble asset" << hash << "from chunk" << chunk.hash.toHex();
+            destination.cancelWriting();
+            return false;
+        }
+    }
+    return destination.commit();
+}
+
+QJsonObject AssetChunkStore::getStats() const {
+    QJsonObject stats;
+    stats["1. Assets Stored"] = (double)_assetsStored;
+    stats["2. Asset Bytes Stored"] = (double)_logicalBytesStored;
+    stats["3. Chunks Written"] = (double)_chunksWritten;
+    stats["4. Chunk Bytes Written"] = (double)_chunkBytesWritten;
+    stats["5. Chunks Deduplicated"] = (double)_chunksDeduplicated;
+    stats["6. Assets Removed"] = (double)_assetsRemoved;
+    stats["7. Chunks Removed"] = (double)_chunksRemoved;
+    return stats;
+}
@@ -0,0 +1,105 @@
+//
+//  AssetChunkStore.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_AssetChunkStore_h
+#define hifi_AssetChunkStore_h
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include <AssetUtils.h>
+
+// Deduplicating storage backend for the asset server.
+//
+// Assets are split with content-defined chunking (AssetUtils::findChunkBoundaries), so inserting or changing bytes in
+// a file only changes the chunks around the edit. Each chunk is stored once under its SHA-256, and each asset is
+// described by a small manifest listing its chunks in order. Re-uploading a slightly modified model or re-baked
+// texture set therefore only writes the chunks that actually changed.
+//
+// Chunks are reference counted across manifests; removing an asset deletes the chunks no other asset uses.
+//
+// All methods are safe to call from the asset server transfer threads.
+class AssetChunkStore {
+public:
+    struct ChunkRef {
+        QByteArray hash;  // raw SHA-256 of the chunk content
+        quint32 size { 0 };
+    };
+
+    struct Manifest {
+        qint64 size { 0 };
+        std::vector<ChunkRef> chunks;
+    };
+
+    AssetChunkStore(const QDir& storeDirectory);
+
+    bool isValid() const { return _isValid; }
+
+    bool contains(const AssetUtils::AssetHash& hash) const;
+
+    /// Returns the size of the asset, or -1 if the store doesn't have it
+    qint64 getAssetSize(const AssetUtils::AssetHash& hash) const;
+
+    /// Chunk data and store the asset under hash. Only chunks not already in the store are written.
+    bool storeAsset(const AssetUtils::AssetHash& hash, const QByteArray& data);
+
+    /// Remove the asset's manifest along with every chunk no other asset references
+    bool removeAsset(const AssetUtils::AssetHash& hash);
+
+    /// Delete chunks that no manifest references, e.g. left behind by an upload interrupted before its manifest
+    /// was written. Returns the number of chunks deleted.
+    int removeUnreferencedChunks();
+
+    std::vector<AssetUtils::AssetHash> getAssetHashes() const;
+
+    /// Read length bytes starting at offset. Only the chunks overlapping the range are read from disk.
+    bool readRange(const AssetUtils::AssetHash& hash, qint64 offset, qint64 length, QByteArray& data) const;
+
+    /// Write the complete asset to a regular file, e.g. to hand it to the oven
+    bool reassemble(const AssetUtils::AssetHash& hash, const QString& destinationPath) const;
+
+    QJsonObject getStats() const;
+
+private:
+    QString manifestPath(const AssetUtils::AssetHash& hash) const;
+    QString chunkPath(const QByteArray& chunkHash) const;
+
+    bool readManifest(const AssetUtils::AssetHash& hash, Manifest& manifest) const;
+    bool writeManifest(const AssetUtils::AssetHash& hash, const Manifest& manifest) const;
+    bool writeFileAtomically(const QString& path, const char* data, qint64 size) const;
+
+    QDir _manifestsDirectory;
+    QDir _chunksDirectory;
+    bool _isValid { false };
+
+    // Number of manifest entries referencing each chunk, keyed by raw chunk hash. The mutex also serializes
+    // writing and deleting chunk files and manifests, so a chunk is never deleted while a new asset takes a reference.
+    std::mutex _referencesMutex;
+    QHash<QByteArray, int> _chunkReferences;
+
+    std::atomic<qint64> _assetsStored { 0 };
+    std::atomic<qint64> _logicalBytesStored { 0 };
+    std::atomic<qint64> _chunksWritten { 0 };
+    std::atomic<qint64> _chunkBytesWritten { 0 };
+    std::atomic<qint64> _chunksDeduplicated { 0 };
+    std::atomic<qint64> _assetsRemoved { 0 };
+    std::atomic<qint64> _chunksRemoved { 0 };
+};
+
+#endif // hifi_AssetChunkStore_h
@@ -113,11 +113,16 @@ QString getBakeMapping(const AssetUtils::AssetHash& hash, const QString& relativ
 
 const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
+static const QString ASSET_FILES_SUBDIR = "files";
+static const QString ASSET_CHUNKS_SUBDIR = "chunked";
+static const QString ASSET_BAKE_CACHE_SUBDIR = "bake-cache";
+
 void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, _chunkStore,
+                                                    _resourcesDirectory.absoluteFilePath(ASSET_BAKE_CACHE_SUBDIR));
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -362,8 +367,6 @@ void AssetServer::run() {
     ThreadedAssignment::commonInit(ASSET_SERVER_LOGGING_TARGET_NAME, NodeType::AssetServer);
 }
 
-static const QString ASSET_FILES_SUBDIR = "files";
-
 void AssetServer::completeSetup() {
     auto nodeList = DependencyManager::get<NodeList>();
 
@@ -424,6 +427,16 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    // optionally store new uploads split into deduplicated chunks
+    static const QString CHUNKED_STORAGE_OPTION = "chunked_storage";
+    if (assetServerObject[CHUNKED_STORAGE_OPTION].toBool(false)) {
+        auto chunkStore = std::make_shared<AssetChunkStore>(QDir(_resourcesDirectory.absoluteFilePath(ASSET_CHUNKS_SUBDIR)));
+        if (chunkStore->isValid()) {
+            qCInfo(asset_server) << "Storing new uploads in chunk store:" << _resourcesDirectory.absoluteFilePath(ASSET_CHUNKS_SUBDIR);
+            _chunkStore = chunkStore;
+        }
+    }
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -548,6 +561,30 @@ void AssetServer::cleanupUnmappedFiles() {
             }
         }
     }
+
+    if (_chunkStore) {
+        QSet<AssetUtils::AssetHash> mappedHashes;
+        for (auto& pair : _fileMappings) {
+            mappedHashes.insert(pair.second);
+        }
+
+        for (const auto& hash : _chunkStore->getAssetHashes()) {
+            if (!mappedHashes.contains(hash)) {
+                if (_chunkStore->removeAsset(hash)) {
+                    qCDebug(asset_server) << "\tDeleted" << hash << "from chunk store since it is unmapped.";
+
+                    removeBakedPathsForDeletedAsset(hash);
+                } else {
+                    qCDebug(asset_server) << "\tAttempt to delete unmapped chunked asset" << hash << "failed";
+                }
+            }
+        }
+
+        int removedChunks = _chunkStore->removeUnreferencedChunks();
+        if (removedChunks > 0) {
+            qCDebug(asset_server) << "\tDeleted" << removedChunks << "unreferenced chunks from chunk store.";
+        }
+    }
 }
 
 void AssetServer::cleanupBakedFilesForDeletedAssets() {
@@ -844,10 +881,14 @@ void AssetServer::handleAssetGetInfo(QSharedPointer<ReceivedMessage> message, Sh
     QString fileName = QString(hexHash);
     QFileInfo fileInfo { _filesDirectory.filePath(fileName) };
 
+    qint64 chunkedAssetSize = -1;
     if (fileInfo.exists() && fileInfo.isReadable()) {
         qCDebug(asset_server) << "Opening file: " << fileInfo.filePath();
         replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
         replyPacket->writePrimitive(fileInfo.size());
+    } else if (_chunkStore && (chunkedAssetSize = _chunkStore->getAssetSize(fileName)) >= 0) {
+        replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+        replyPacket->writePrimitive(chunkedAssetSize);
     } else {
         qCDebug(asset_server) << "Asset not found: " << QString(hexHash);
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -867,7 +908,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _chunkStore);
     _transferTaskPool.start(task);
 }
 
@@ -881,7 +922,7 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit, _chunkStore);
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -957,6 +998,10 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    if (_chunkStore) {
+        serverStats["Chunk Store"] = _chunkStore->getStats();
+    }
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1169,10 +1214,14 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
         // we now have a set of hashes that are unmapped - we will delete those asset files
         for (auto& hash : hashesToCheckForDeletion) {
-            // remove the unmapped file
+            // remove the unmapped file, or the chunked asset stored in its place
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
+            bool removed = removeableFile.remove();
+            if (_chunkStore && _chunkStore->contains(hash)) {
+                removed = _chunkStore->removeAsset(hash) || removed;
+            }
 
-            if (removeableFile.remove()) {
+            if (removed) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
                 removeBakedPathsForDeletedAsset(hash);
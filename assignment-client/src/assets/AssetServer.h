@@ -18,6 +18,7 @@
 
 #include <ThreadedAssignment.h>
 
+#include "AssetChunkStore.h"
 #include "AssetUtils.h"
 #include "ReceivedMessage.h"
 
@@ -153,6 +154,9 @@ private:
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Deduplicating chunked storage for uploads, only set when enabled in the domain settings
+    std::shared_ptr<AssetChunkStore> _chunkStore;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
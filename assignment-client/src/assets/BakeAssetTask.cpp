@@ -24,10 +24,13 @@ static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             std::shared_ptr<AssetChunkStore> chunkStore, const QString& bakeCacheDirectory) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _chunkStore(chunkStore),
+    _bakeCacheDirectory(bakeCacheDirectory)
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -55,7 +58,13 @@ void BakeAssetTask::run() {
     // Copy file to bake the temporary dir and give a name the oven can work with
     auto assetName = _assetPath.split("/").last();
     auto tempAssetPath = tempOutputDir + "/" + assetName;
-    auto success = QFile::copy(_filePath, tempAssetPath);
+    bool success;
+    if (!QFile::exists(_filePath) && _chunkStore && _chunkStore->contains(_assetHash)) {
+        // the oven needs a regular file, so put the chunked asset back together
+        success = _chunkStore->reassemble(_assetHash, tempAssetPath);
+    } else {
+        success = QFile::copy(_filePath, tempAssetPath);
+    }
     if (!success) {
         QString errors = "Couldn't copy file to bake to temporary directory";
         emit bakeFailed(_assetHash, _assetPath, errors);
@@ -71,6 +80,10 @@ void BakeAssetTask::run() {
         "-o", tempOutputDir,
         "-t", extension,
     };
+    if (!_bakeCacheDirectory.isEmpty()) {
+        // rebakes after a bake version bump or a re-upload of the same content restore from the cache
+        args << "--cache" << _bakeCacheDirectory;
+    }
 
     _ovenProcess.reset(new QProcess());
 
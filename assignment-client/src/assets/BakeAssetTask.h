@@ -22,10 +22,13 @@
 
 #include <AssetUtils.h>
 
+#include "AssetChunkStore.h"
+
 class BakeAssetTask : public QObject, public QRunnable {
     Q_OBJECT
 public:
-    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                  std::shared_ptr<AssetChunkStore> chunkStore = nullptr, const QString& bakeCacheDirectory = QString());
 
     // Thread-safe inspection methods
     bool isBaking() { return _isBaking.load(); }
@@ -46,6 +49,8 @@ private:
     AssetUtils::AssetHash _assetHash;
     AssetUtils::AssetPath _assetPath;
     QString _filePath;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
+    QString _bakeCacheDirectory;
     std::unique_ptr<QProcess> _ovenProcess { nullptr };
     std::atomic<bool> _wasAborted { false };
 };
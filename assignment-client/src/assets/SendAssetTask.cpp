@@ -26,11 +26,13 @@
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             std::shared_ptr<AssetChunkStore> chunkStore) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -66,8 +68,25 @@ void SendAssetTask::run() {
         QString filePath = _resourcesDir.filePath(QString(hexHash));
         
         QFile file { filePath };
-
-        if (file.open(QIODevice::ReadOnly)) {
+        qint64 chunkedAssetSize = -1;
+
+        if (!file.exists() && _chunkStore && (chunkedAssetSize = _chunkStore->getAssetSize(hexHash)) >= 0) {
+            // the asset lives in the chunk store, only the chunks overlapping the range are read
+            byteRange.fixupRange(chunkedAssetSize);
+            QByteArray data;
+            qint64 readStart = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : chunkedAssetSize + byteRange.fromInclusive;
+            if (chunkedAssetSize < byteRange.fromInclusive || chunkedAssetSize < byteRange.toExclusive ||
+                !_chunkStore->readRange(hexHash, readStart, byteRange.size(), data)) {
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+                qCDebug(networking) << "Bad byte range: " << hexHash << " "
+                    << byteRange.fromInclusive << ":" << byteRange.toExclusive;
+            } else {
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(byteRange.size());
+                replyPacketList->write(data);
+                qCDebug(networking) << "Sending chunked asset: " << hexHash;
+            }
+        } else if (file.open(QIODevice::ReadOnly)) {
 
             // first fixup the range based on the now known file size
             byteRange.fixupRange(file.size());
@@ -21,11 +21,13 @@
 #include "ClientServerUtils.h"
 
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 const QDir& resourcesDir, uint64_t filesizeLimit,
+                                 std::shared_ptr<AssetChunkStore> chunkStore) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
     _resourcesDir(resourcesDir),
-    _filesizeLimit(filesizeLimit)
+    _filesizeLimit(filesizeLimit),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -68,8 +70,20 @@ void UploadAssetTask::run() {
         QFile file { _resourcesDir.filePath(QString(hexHash)) };
 
         bool existingCorrectFile = false;
-        
-        if (file.exists()) {
+
+        if (_chunkStore) {
+            // with chunked storage enabled only the chunks we don't have yet are written to disk,
+            // and no whole file is written below
+            existingCorrectFile = true;
+            if (file.exists() || _chunkStore->contains(hexHash) || _chunkStore->storeAsset(hexHash, fileData)) {
+                qDebug() << "Stored file" << hexHash << "in chunk store. Upload complete";
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacket->write(hash);
+            } else {
+                qWarning() << "Failed to store file" << hexHash << "in chunk store - upload failed.";
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
+            }
+        } else if (file.exists()) {
             // check if the local file has the correct contents, otherwise we overwrite
             if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
                 qDebug() << "Not overwriting existing verified file: " << hexHash;
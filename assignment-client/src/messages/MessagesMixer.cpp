@@ -14,9 +14,11 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
 #include <QBuffer>
+#include <algorithm>
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
@@ -31,45 +33,129 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    auto localID = killedNode->getLocalID();
+    for (auto& channel : _channels) {
+        auto& subscribers = channel.subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), localID), subscribers.end());
     }
+    _senders.erase(localID);
+}
+
+MessagesMixer::ChannelID MessagesMixer::channelIDForName(const QByteArray& channelName) {
+    auto it = _channelIDs.find(channelName);
+    if (it != _channelIDs.end()) {
+        return it.value();
+    }
+
+    ChannelID channelID = (ChannelID)_channels.size();
+    _channels.emplace_back();
+    _channels.back().name = QString::fromUtf8(channelName);
+    _channelIDs.insert(channelName, channelID);
+    return channelID;
+}
+
+bool MessagesMixer::allowMessageFromSender(Node::LocalID senderID, int messageSize) {
+    if (_maxMessagesPerSender <= 0 && _maxKbpsPerSender <= 0) {
+        return true;
+    }
+
+    auto& sender = _senders[senderID];
+    float maxMessagesPerSecond = (float)_maxMessagesPerSender;
+    float maxBytesPerSecond = (float)_maxKbpsPerSender * BYTES_PER_KILOBIT;
+
+    // refill the allowances for the time since the last message, up to a second's worth
+    auto now = usecTimestampNow();
+    if (sender.lastRefill == 0) {
+        sender.messageAllowance = maxMessagesPerSecond;
+        sender.byteAllowance = maxBytesPerSecond;
+    } else {
+        float elapsed = (float)(now - sender.lastRefill) / (float)USECS_PER_SECOND;
+        sender.messageAllowance = std::min(sender.messageAllowance + elapsed * maxMessagesPerSecond, maxMessagesPerSecond);
+        sender.byteAllowance = std::min(sender.byteAllowance + elapsed * maxBytesPerSecond, maxBytesPerSecond);
+    }
+    sender.lastRefill = now;
+
+    if ((_maxMessagesPerSender > 0 && sender.messageAllowance < 1.0f) ||
+        (_maxKbpsPerSender > 0 && sender.byteAllowance < (float)messageSize)) {
+        ++sender.numDroppedMessages;
+        return false;
+    }
+
+    sender.messageAllowance -= 1.0f;
+    sender.byteAllowance -= (float)messageSize;
+    return true;
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    QUuid senderID;
-    bool isText;
-    MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+    // only the channel is read out of the message (see MessagesClient::encodeMessagesPacket for the layout),
+    // the rest is forwarded to the subscribers as is
+    QByteArray payload = receivedMessage->getMessage();
 
-    auto nodeList = DependencyManager::get<NodeList>();
+    quint16 channelLength;
+    if (payload.size() < (int)sizeof(channelLength)) {
+        return;
+    }
+    memcpy(&channelLength, payload.constData(), sizeof(channelLength));
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+    const int MESSAGE_LENGTH_OFFSET = (int)sizeof(channelLength) + channelLength + (int)sizeof(bool);
+    quint32 messageLength;
+    if (payload.size() < MESSAGE_LENGTH_OFFSET + (int)sizeof(messageLength)) {
+        return;
+    }
+    memcpy(&messageLength, payload.constData() + MESSAGE_LENGTH_OFFSET, sizeof(messageLength));
+
+    int senderIDOffset = MESSAGE_LENGTH_OFFSET + (int)sizeof(messageLength) + (int)messageLength;
+    if (messageLength > (quint32)payload.size() || payload.size() < senderIDOffset) {
+        return;
+    }
+
+    if (!allowMessageFromSender(senderNode->getLocalID(), payload.size())) {
+        return;
+    }
+
+    auto channelIt = _channelIDs.find(QByteArray::fromRawData(payload.constData() + sizeof(channelLength), channelLength));
+    if (channelIt == _channelIDs.end()) {
+        return;
+    }
+    auto& channel = _channels[channelIt.value()];
+    channel.messageRate.increment();
+
+    // the sender ID is left to the mixer if the packet was missing it
+    if (payload.size() < senderIDOffset + NUM_BYTES_RFC4122_UUID) {
+        payload.truncate(senderIDOffset);
+        payload.append(QUuid().toRfc4122());
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    for (auto localID : channel.subscribers) {
+        auto node = nodeList->nodeWithLocalID(localID);
+        if (node && node->getActiveSocket()) {
+            auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+            packetList->write(payload);
+            nodeList->sendPacketList(std::move(packetList), *node);
+            channel.outboundByteRate.increment(payload.size());
+        }
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    QString channel = QString::fromUtf8(message->getMessage());
-    _channelSubscribers[channel] << senderNode->getUUID();
+    auto& subscribers = _channels[channelIDForName(message->getMessage())].subscribers;
+    auto localID = senderNode->getLocalID();
+    if (std::find(subscribers.begin(), subscribers.end(), localID) == subscribers.end()) {
+        subscribers.push_back(localID);
+    }
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    QString channel = QString::fromUtf8(message->getMessage());
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderNode->getUUID());
+    auto it = _channelIDs.find(message->getMessage());
+    if (it != _channelIDs.end()) {
+        auto& subscribers = _channels[it.value()].subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), senderNode->getLocalID()), subscribers.end());
     }
 }
 
 void MessagesMixer::sendStatsPacket() {
-    QJsonObject statsObject, messagesMixerObject;
+    QJsonObject statsObject, messagesMixerObject, channelsObject;
 
     // add stats for each listerner
     DependencyManager::get<NodeList>()->eachNode([&](const SharedNodePointer& node) {
@@ -77,14 +163,48 @@ void MessagesMixer::sendStatsPacket() {
         clientStats[USERNAME_UUID_REPLACEMENT_STATS_KEY] = uuidStringWithoutCurlyBraces(node->getUUID());
         clientStats["outbound_kbps"] = node->getOutboundKbps();
         clientStats["inbound_kbps"] = node->getInboundKbps();
+        auto sender = _senders.find(node->getLocalID());
+        clientStats["dropped_messages"] = sender != _senders.end() ? (double)sender->second.numDroppedMessages : 0.0;
         messagesMixerObject[uuidStringWithoutCurlyBraces(node->getUUID())] = clientStats;
     });
 
+    // and for each channel someone is listening to
+    for (const auto& channel : _channels) {
+        if (channel.subscribers.empty()) {
+            continue;
+        }
+        QJsonObject channelStats;
+        channelStats["subscribers"] = (int)channel.subscribers.size();
+        channelStats["messages_per_second"] = channel.messageRate.rate();
+        channelStats["outbound_kbps"] = channel.outboundByteRate.rate() / BYTES_PER_KILOBIT;
+        channelsObject[channel.name] = channelStats;
+    }
+
     statsObject["messages"] = messagesMixerObject;
+    statsObject["channels"] = channelsObject;
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
+void MessagesMixer::domainSettingsRequestComplete() {
+    const QJsonObject& settingsObject = DependencyManager::get<NodeList>()->getDomainHandler().getSettingsObject();
+
+    static const QString MESSAGES_MIXER_SETTINGS_KEY = "messages_mixer";
+    auto messagesMixerSettings = settingsObject[MESSAGES_MIXER_SETTINGS_KEY].toObject();
+
+    static const QString MAX_MESSAGES_PER_SENDER_OPTION = "max_messages_per_sender";
+    static const QString MAX_KBPS_PER_SENDER_OPTION = "max_kbps_per_sender";
+    _maxMessagesPerSender = std::max(0, messagesMixerSettings[MAX_MESSAGES_PER_SENDER_OPTION].toInt());
+    _maxKbpsPerSender = std::max(0, messagesMixerSettings[MAX_KBPS_PER_SENDER_OPTION].toInt());
+    _senders.clear();
+
+    qDebug() << QString("Received messages mixer settings, Max messages per sender: %1/s, Max kbps per sender: %2")
+                .arg(_maxMessagesPerSender).arg(_maxKbpsPerSender);
+}
+
 void MessagesMixer::run() {
+    DomainHandler& domainHandler = DependencyManager::get<NodeList>()->getDomainHandler();
+    connect(&domainHandler, &DomainHandler::settingsReceived, this, &MessagesMixer::domainSettingsRequestComplete);
+
     ThreadedAssignment::commonInit(MESSAGES_MIXER_LOGGING_NAME, NodeType::MessagesMixer);
     auto nodeList = DependencyManager::get<NodeList>();
     nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
@@ -15,7 +15,12 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 #include <ThreadedAssignment.h>
+#include <shared/RateCounter.h>
 
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
 class MessagesMixer : public ThreadedAssignment {
@@ -29,12 +34,39 @@ public slots:
     void sendStatsPacket() override;
 
 private slots:
+    void domainSettingsRequestComplete();
     void handleMessages(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
 private:
-    QHash<QString,QSet<QUuid>> _channelSubscribers;
+    using ChannelID = uint32_t;
+
+    struct Channel {
+        QString name;
+        std::vector<Node::LocalID> subscribers;
+        RateCounter<> messageRate;
+        RateCounter<> outboundByteRate;
+    };
+
+    // per-sender token buckets, refilled at the configured rates
+    struct Sender {
+        float messageAllowance { 0.0f };
+        float byteAllowance { 0.0f };
+        quint64 lastRefill { 0 };
+        quint64 numDroppedMessages { 0 };
+    };
+
+    ChannelID channelIDForName(const QByteArray& channelName);
+    bool allowMessageFromSender(Node::LocalID senderID, int messageSize);
+
+    // channel names are interned on subscription, keyed by their UTF-8 bytes as they come off the wire
+    QHash<QByteArray, ChannelID> _channelIDs;
+    std::deque<Channel> _channels;
+
+    std::unordered_map<Node::LocalID, Sender> _senders;
+    int _maxMessagesPerSender { 0 }; // per second, 0 for no limit
+    int _maxKbpsPerSender { 0 }; // 0 for no limit
 };
 
 #endif // hifi_MessagesMixer_h
@@ -0,0 +1,81 @@
+//
+//  EntityScriptEngineRouter.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityScriptEngineRouter.h"
+
+using Lock = std::lock_guard<std::mutex>;
+
+void EntityScriptEngineRouter::setEngines(std::vector<ScriptEnginePointer> engines) {
+    Lock lock(_mutex);
+    _engines = std::move(engines);
+    _assignments.clear();
+}
+
+std::vector<ScriptEnginePointer> EntityScriptEngineRouter::getEngines() const {
+    Lock lock(_mutex);
+    return _engines;
+}
+
+int EntityScriptEngineRouter::getNumEngines() const {
+    Lock lock(_mutex);
+    return (int)_engines.size();
+}
+
+int EntityScriptEngineRouter::selectEngineIndex(const EntityItemID& entityID, const QString& affinity) const {
+    Lock lock(_mutex);
+    if (_engines.empty()) {
+        return -1;
+    }
+    uint hash = affinity.isEmpty() ? qHash(entityID) : qHash(affinity);
+    return (int)(hash % (uint)_engines.size());
+}
+
+void EntityScriptEngineRouter::assignEntity(const EntityItemID& entityID, int engineIndex) {
+    Lock lock(_mutex);
+    _assignments[entityID] = engineIndex;
+}
+
+void EntityScriptEngineRouter::unassignEntity(const EntityItemID& entityID) {
+    Lock lock(_mutex);
+    _assignments.remove(entityID);
+}
+
+QList<EntityItemID> EntityScriptEngineRouter::getAssignedEntities() const {
+    Lock lock(_mutex);
+    return _assignments.keys();
+}
+
+ScriptEnginePointer EntityScriptEngineRouter::engineForEntity(const EntityItemID& entityID) const {
+    Lock lock(_mutex);
+    if (_engines.empty()) {
+        return ScriptEnginePointer();
+    }
+
+    auto it = _assignments.find(entityID);
+    int engineIndex = it != _assignments.end() ? it.value() : (int)(qHash(entityID) % (uint)_engines.size());
+    return _engines[engineIndex];
+}
+
+void EntityScriptEngineRouter::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                      const QStringList& params, const QUuid& remoteCallerID) {
+    auto engine = engineForEntity(entityID);
+    if (engine) {
+        // queued over to the engine's thread if the caller is a script running on another engine
+        engine->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+}
+
+QFuture<QVariant> EntityScriptEngineRouter::getLocalEntityScriptDetails(const EntityItemID& entityID) {
+    auto engine = engineForEntity(entityID);
+    if (engine) {
+        return engine->getLocalEntityScriptDetails(entityID);
+    }
+    return QFuture<QVariant>();
+}
@@ -0,0 +1,52 @@
+//
+//  EntityScriptEngineRouter.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityScriptEngineRouter_h
+#define hifi_EntityScriptEngineRouter_h
+
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <ScriptEngine.h>
+
+// Spreads the server entity scripts over a pool of script engines, each running on its own thread.
+// A script runs on the engine picked from its affinity hint if it has one, or from its entity ID otherwise,
+// and calls made to an entity through the EntityScriptingInterface are routed to the engine running its script.
+class EntityScriptEngineRouter : public EntitiesScriptEngineProvider {
+public:
+    void setEngines(std::vector<ScriptEnginePointer> engines);
+    std::vector<ScriptEnginePointer> getEngines() const;
+    int getNumEngines() const;
+
+    // Entities with the same affinity hint share an engine, so their scripts can call each other synchronously
+    int selectEngineIndex(const EntityItemID& entityID, const QString& affinity) const;
+
+    void assignEntity(const EntityItemID& entityID, int engineIndex);
+    void unassignEntity(const EntityItemID& entityID);
+    QList<EntityItemID> getAssignedEntities() const;
+
+    // The engine running this entity's script, or the one it would be assigned to
+    ScriptEnginePointer engineForEntity(const EntityItemID& entityID) const;
+
+    // EntitiesScriptEngineProvider
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<ScriptEnginePointer> _engines;
+    QHash<EntityItemID, int> _assignments;
+};
+
+#endif // hifi_EntityScriptEngineRouter_h
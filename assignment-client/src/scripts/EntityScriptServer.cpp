@@ -13,6 +13,14 @@
 
 #include <mutex>
 
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <QtCore/QJsonDocument>
+
 #include <AudioConstants.h>
 #include <AudioInjectorManager.h>
 #include <ClientServerUtils.h>
@@ -125,7 +133,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        auto engine = _entitiesScriptEngines ? _entitiesScriptEngines->engineForEntity(entityID) : ScriptEnginePointer();
+        if (engine && engine->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -154,6 +163,23 @@ void EntityScriptServer::handleSettings() {
 
     auto entityScriptServerSettings = settingsObject[ENTITY_SCRIPT_SERVER_SETTINGS_KEY].toObject();
 
+    static const QString NUM_SCRIPT_ENGINES_OPTION = "num_script_engines";
+    int numScriptEngines = std::max(1, entityScriptServerSettings[NUM_SCRIPT_ENGINES_OPTION].toInt(DEFAULT_NUM_SCRIPT_ENGINES));
+    if (numScriptEngines != _numScriptEngines) {
+        qDebug() << "Running server entity scripts on" << numScriptEngines << "script engines";
+        _numScriptEngines = numScriptEngines;
+
+        // re-spread the running scripts over the new set of engines
+        if (!_shuttingDown && _entitiesScriptEngines->getNumEngines() > 0) {
+            auto entityIDs = _entitiesScriptEngines->getAssignedEntities();
+            stopEntitiesScriptEngines();
+            resetEntitiesScriptEngines();
+            for (const auto& entityID : entityIDs) {
+                checkAndCallPreload(entityID);
+            }
+        }
+    }
+
     static const QString MAX_ENTITY_PPS_OPTION = "max_total_entity_pps";
     static const QString ENTITY_PPS_PER_SCRIPT = "entity_pps_per_script";
 
@@ -169,8 +195,19 @@ void EntityScriptServer::handleSettings() {
                 .arg(_maxEntityPPS).arg(_entityPPSPerScript);
 }
 
+int EntityScriptServer::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    if (!_entitiesScriptEngines) {
+        return numRunningScripts;
+    }
+    for (const auto& engine : _entitiesScriptEngines->getEngines()) {
+        numRunningScripts += engine->getNumRunningEntityScripts();
+    }
+    return numRunningScripts;
+}
+
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    int numRunningScripts = getNumRunningEntityScripts();
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -231,7 +268,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (!_shuttingDown && _entitiesScriptEngines->getNumEngines() > 0 && _entityViewer.getTree()) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -245,7 +282,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _entitiesScriptEngines->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -276,8 +313,8 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -439,7 +476,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::createEntitiesScriptEngine(bool drivesEntityTree) {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -456,48 +493,69 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+    // one engine is enough to keep the entity tree updated
+    if (drivesEntityTree) {
+        connect(newEngine.data(), &ScriptEngine::update, this, [this] {
+            _entityViewer.queryOctree();
+            _entityViewer.getTree()->preUpdate();
+            _entityViewer.getTree()->update();
+        });
+    }
+
+    connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
     scriptEngines->runScriptInitializers(newEngine);
     newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngineSP);
+    return newEngine;
+}
 
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    std::vector<ScriptEnginePointer> engines;
+    _engineLoads.clear();
+    for (int i = 0; i < _numScriptEngines; ++i) {
+        engines.push_back(createEntitiesScriptEngine(i == 0));
+        _engineLoads.push_back(std::make_shared<EngineLoad>());
     }
+    _entitiesScriptEngines->setEngines(std::move(engines));
 
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(_entitiesScriptEngines);
 }
 
+void EntityScriptServer::stopEntitiesScriptEngines() {
+    if (!_entitiesScriptEngines) {
+        return;
+    }
+
+    // unload and stop the engines
+    for (const auto& engine : _entitiesScriptEngines->getEngines()) {
+        disconnect(engine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
-void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
         // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
+        engine->unloadAllEntityScripts();
+        engine->stop();
     }
+    for (const auto& engine : _entitiesScriptEngines->getEngines()) {
+        engine->waitTillDoneRunning();
+    }
+    _entitiesScriptEngines->setEngines({});
+}
+
+void EntityScriptServer::clear() {
+    stopEntitiesScriptEngines();
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    if (_entitiesScriptEngines) {
+        for (const auto& engine : _entitiesScriptEngines->getEngines()) {
+            engine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+        }
     }
     _shuttingDown = true;
 
@@ -506,9 +564,10 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entitiesScriptEngines.clear();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    entityScriptingInterface->setEntitiesScriptEngine(nullptr);
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
     entityScriptingInterface->setEntityTree(nullptr);
 
@@ -524,8 +583,12 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown) {
+        auto engine = _entitiesScriptEngines->engineForEntity(entityID);
+        if (engine) {
+            engine->unloadEntityScript(entityID, true);
+        }
+        _entitiesScriptEngines->unassignEntity(entityID);
     }
 }
 
@@ -535,26 +598,103 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
     }
 }
 
+// Server scripts of entities with the same affinity share a script engine, e.g. { "serverScriptAffinity": "game" }
+static QString serverScriptAffinity(const EntityItemPointer& entity) {
+    static const QString SERVER_SCRIPT_AFFINITY_KEY = "serverScriptAffinity";
+    const QString& userData = entity->getUserData();
+    if (!userData.contains(SERVER_SCRIPT_AFFINITY_KEY)) {
+        return QString();
+    }
+    return QJsonDocument::fromJson(userData.toUtf8()).object()[SERVER_SCRIPT_AFFINITY_KEY].toString();
+}
+
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngines->getNumEngines() > 0) {
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
+        if (!entity) {
+            return;
+        }
+
+        auto currentEngine = _entitiesScriptEngines->engineForEntity(entityID);
+        int engineIndex = _entitiesScriptEngines->selectEngineIndex(entityID, serverScriptAffinity(entity));
+        auto engine = _entitiesScriptEngines->getEngines()[engineIndex];
+
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
-        if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
+        bool isRunning = currentEngine->getEntityScriptDetails(entityID, details);
+        bool isMoving = currentEngine != engine;
+        if (forceRedownload || isMoving || !isRunning || details.scriptText != entity->getServerScripts()) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                currentEngine->unloadEntityScript(entityID, true);
             }
+            _entitiesScriptEngines->unassignEntity(entityID);
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                _entitiesScriptEngines->assignEntity(entityID, engineIndex);
+                engine->loadEntityScript(entityID, scriptUrl, forceRedownload);
             }
         }
     }
 }
 
+// CPU time used by the calling thread
+static quint64 threadCPUTimeUsecs() {
+#ifdef Q_OS_WIN
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    auto toUsecs = [](const FILETIME& time) {
+        return ((quint64)time.dwHighDateTime << 32 | time.dwLowDateTime) / 10; // 100ns units
+    };
+    return toUsecs(kernelTime) + toUsecs(userTime);
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return (quint64)time.tv_sec * USECS_PER_SECOND + (quint64)time.tv_nsec / NSECS_PER_USEC;
+#endif
+}
+
+QJsonObject EntityScriptServer::probeEntitiesScriptEngines() {
+    QJsonObject enginesStats;
+
+    if (!_entitiesScriptEngines) {
+        return enginesStats;
+    }
+
+    auto engines = _entitiesScriptEngines->getEngines();
+    auto now = usecTimestampNow();
+    for (size_t i = 0; i < engines.size() && i < _engineLoads.size(); ++i) {
+        const auto& engine = engines[i];
+        auto load = _engineLoads[i];
+
+        // report what the last probe found, the CPU time as a fraction of the time since the one before
+        QJsonObject engineStats;
+        engineStats["number_running_scripts"] = engine->getNumRunningEntityScripts();
+        engineStats["event_loop_lag_msecs"] = (double)load->eventLoopLag / USECS_PER_MSEC;
+        quint64 cpuTime = load->cpuTime;
+        if (load->lastSampleTime != 0 && now > load->lastSampleTime && cpuTime >= load->lastCPUTime) {
+            engineStats["cpu_usage"] = (double)(cpuTime - load->lastCPUTime) / (double)(now - load->lastSampleTime);
+        }
+        engineStats["cpu_time_secs"] = (double)cpuTime / USECS_PER_SECOND;
+        load->lastCPUTime = cpuTime;
+        load->lastSampleTime = now;
+        enginesStats[QString("engine_%1").arg(i)] = engineStats;
+
+        // the next probe measures how long the engine takes to get to its queued events
+        QMetaObject::invokeMethod(engine.data(), [load, now] {
+            load->eventLoopLag = usecTimestampNow() - now;
+            load->cpuTime = threadCPUTimeUsecs();
+        }, Qt::QueuedConnection);
+    }
+
+    return enginesStats;
+}
+
 void EntityScriptServer::sendStatsPacket() {
     QJsonObject statsObject;
 
@@ -565,14 +705,10 @@ void EntityScriptServer::sendStatsPacket() {
     statsObject["octree_stats"] = octreeStats;
 
     QJsonObject scriptEngineStats;
-    int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
-    }
-    scriptEngineStats["number_running_scripts"] = numberRunningScripts;
+    scriptEngineStats["number_running_scripts"] = getNumRunningEntityScripts();
+    scriptEngineStats["engines"] = probeEntitiesScriptEngines();
     statsObject["script_engine_stats"] = scriptEngineStats;
-    
+
 
     auto nodeList = DependencyManager::get<NodeList>();
     QJsonObject nodesObject;
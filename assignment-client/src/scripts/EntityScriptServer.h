@@ -12,9 +12,12 @@
 #ifndef hifi_EntityScriptServer_h
 #define hifi_EntityScriptServer_h
 
+#include <atomic>
+#include <memory>
 #include <set>
 #include <vector>
 
+#include <QtCore/QJsonObject>
 #include <QtCore/QObject>
 #include <QtCore/QUuid>
 
@@ -24,6 +27,9 @@
 #include <SimpleEntitySimulation.h>
 #include <ThreadedAssignment.h>
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityScriptEngineRouter.h"
+
+static const int DEFAULT_NUM_SCRIPT_ENGINES = 1;
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -61,9 +67,13 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    ScriptEnginePointer createEntitiesScriptEngine(bool drivesEntityTree);
+    void resetEntitiesScriptEngines();
+    void stopEntitiesScriptEngines();
     void clear();
     void shutdownScriptEngine();
+    int getNumRunningEntityScripts() const;
+    QJsonObject probeEntitiesScriptEngines();
 
     void addingEntity(const EntityItemID& entityID);
     void deletingEntity(const EntityItemID& entityID);
@@ -75,7 +85,17 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+    QSharedPointer<EntityScriptEngineRouter> _entitiesScriptEngines { new EntityScriptEngineRouter() };
+    int _numScriptEngines { DEFAULT_NUM_SCRIPT_ENGINES };
+
+    // sampled on each engine's thread when stats are sent
+    struct EngineLoad {
+        std::atomic<quint64> eventLoopLag { 0 }; // usecs
+        std::atomic<quint64> cpuTime { 0 }; // usecs, on the engine's thread
+        quint64 lastCPUTime { 0 };
+        quint64 lastSampleTime { 0 };
+    };
+    std::vector<std::shared_ptr<EngineLoad>> _engineLoads;
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
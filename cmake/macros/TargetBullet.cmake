@@ -17,6 +17,8 @@ macro(TARGET_BULLET)
         list(APPEND BULLET_LIBRARIES ${LIB_DIR}/libBulletSoftBody.a)
     else()
         find_package(Bullet REQUIRED)
+        # our vcpkg port builds Bullet with BULLET2_MULTITHREADING, which consumers must match
+        target_compile_definitions(${TARGET_NAME} PUBLIC BT_THREADSAFE=1)
    endif()
     # perform the system include hack for OS X to ignore warnings
     if (APPLE)
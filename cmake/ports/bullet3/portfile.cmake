@@ -1,4 +1,4 @@
-# Updated June 6th, 2019, to force new vckpg hash
+# Updated October 19th, 2026, to force new vckpg hash
 #
 # Common Ambient Variables:
 #
@@ -44,6 +44,7 @@ vcpkg_configure_cmake(
         -DBUILD_CPU_DEMOS=OFF
         -DBUILD_EXTRAS=OFF
         -DBUILD_UNIT_TESTS=OFF
+        -DBULLET2_MULTITHREADING=ON
         -DBUILD_SHARED_LIBS=ON
         -DINSTALL_LIBS=ON
 )
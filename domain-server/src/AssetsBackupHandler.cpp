@@ -10,9 +10,11 @@
 //
 
 #include "AssetsBackupHandler.h"
+#include "BackupBlobStore.h"
 
 #include <QJsonDocument>
 #include <QDate>
+#include <QtCore/QFileInfo>
 #include <QtCore/QLoggingCategory>
 
 #if !defined(__clang__) && defined(__GNUC__)
@@ -77,13 +79,13 @@ void AssetsBackupHandler::setupRefreshTimer() {
 
 void AssetsBackupHandler::refreshAssetsOnDisk() {
     QDir assetsDir { _assetsDirectory };
-    auto assetNames = assetsDir.entryList(QDir::Files);
 
     // store all valid hashes
-    copy_if(begin(assetNames), end(assetNames),
-            inserter(_assetsOnDisk, begin(_assetsOnDisk)),
-            AssetUtils::isValidHash);
-
+    for (const auto& assetInfo : assetsDir.entryInfoList(QDir::Files)) {
+        if (AssetUtils::isValidHash(assetInfo.fileName()) && _assetsOnDisk.insert(assetInfo.fileName()).second) {
+            _assetBytesOnDisk += assetInfo.size();
+        }
+    }
 }
 
 void AssetsBackupHandler::refreshAssetsInBackups() {
@@ -118,9 +120,11 @@ void AssetsBackupHandler::checkForAssetsToDelete() {
         });
         if (noCorruptedBackups) {
             for (const auto& hash : deprecatedAssets) {
+                auto size = QFileInfo(_assetsDirectory + hash).size();
                 auto success = QFile::remove(_assetsDirectory + hash);
                 if (success) {
                     _assetsOnDisk.erase(hash);
+                    _assetBytesOnDisk -= size;
                 } else {
                     qCWarning(asset_backup) << "Could not delete asset:" << hash;
                 }
@@ -409,7 +413,7 @@ void AssetsBackupHandler::consolidateBackup(const QString& backupName, QuaZip& z
             qCDebug(asset_backup) << "Could not open zip file:" << zipFile.getZipError();
             continue;
         }
-        zipFile.write(file.readAll());
+        BackupBlobStore::copy(file, zipFile);
         zipFile.close();
         if (zipFile.getZipError() != UNZ_OK) {
             qCDebug(asset_backup) << "Could not close zip file: " << zipFile.getZipError();
@@ -466,12 +470,31 @@ void AssetsBackupHandler::downloadMissingFiles(const AssetUtils::Mappings& mappi
 
     // If we were empty, that means no download chain was already going, start one.
     if (wasEmpty) {
+        if (!_assetsLeftToRequest.empty()) {
+            _currentAssetBackupRun = AssetBackupRun();
+            _currentAssetBackupRun.startedAt = QDateTime::currentDateTime();
+            _assetBackupRunStart = p_high_resolution_clock::now();
+        }
         downloadNextMissingFile();
     }
 }
 
 void AssetsBackupHandler::downloadNextMissingFile() {
     if (_assetsLeftToRequest.empty()) {
+        if (_currentAssetBackupRun.startedAt.isValid()) {
+            auto& run = _currentAssetBackupRun;
+            run.durationMsecs = std::chrono::duration_cast<std::chrono::milliseconds>(p_high_resolution_clock::now() -
+                                                                                      _assetBackupRunStart).count();
+            qCInfo(asset_backup).nospace() << "Backed up " << run.assetsDownloaded << " assets in " << run.durationMsecs
+                << "ms, downloaded " << run.bytesDownloaded << " bytes, " << run.assetsFailed << " failed";
+
+            static const size_t MAX_ASSET_BACKUP_RUNS = 20;
+            _assetBackupRuns.push_back(run);
+            if (_assetBackupRuns.size() > MAX_ASSET_BACKUP_RUNS) {
+                _assetBackupRuns.pop_front();
+            }
+            _currentAssetBackupRun = AssetBackupRun();
+        }
         return;
     }
     auto hash = *begin(_assetsLeftToRequest);
@@ -484,11 +507,16 @@ void AssetsBackupHandler::downloadNextMissingFile() {
             qCDebug(asset_backup) << "Backing up asset" << request->getHash();
 
             bool success = writeAssetFile(request->getHash(), request->getData());
-            if (!success) {
+            if (success) {
+                ++_currentAssetBackupRun.assetsDownloaded;
+                _currentAssetBackupRun.bytesDownloaded += request->getData().size();
+            } else {
                 qCCritical(asset_backup) << "Failed to write asset file" << request->getHash();
+                ++_currentAssetBackupRun.assetsFailed;
             }
         } else {
             qCCritical(asset_backup) << "Failed to backup asset" << request->getHash();
+            ++_currentAssetBackupRun.assetsFailed;
         }
 
         _assetsLeftToRequest.erase(request->getHash());
@@ -515,11 +543,32 @@ bool AssetsBackupHandler::writeAssetFile(const AssetUtils::AssetHash& hash, cons
         return false;
     }
 
-    _assetsOnDisk.insert(hash);
+    if (_assetsOnDisk.insert(hash).second) {
+        _assetBytesOnDisk += bytesWritten;
+    }
 
     return true;
 }
 
+QVariantMap AssetsBackupHandler::getBackupStatus() const {
+    QVariantList assetBackupRuns;
+    for (const auto& run : _assetBackupRuns) {
+        assetBackupRuns.push_back(QVariantMap({
+            { "startedAtMillis", run.startedAt.toMSecsSinceEpoch() },
+            { "durationMillis", run.durationMsecs },
+            { "bytesDownloaded", run.bytesDownloaded },
+            { "assetsDownloaded", run.assetsDownloaded },
+            { "assetsFailed", run.assetsFailed }
+        }));
+    }
+
+    return QVariantMap({
+        { "recentAssetBackupRuns", assetBackupRuns },
+        { "assetBackupBytesOnDisk", _assetBytesOnDisk },
+        { "assetBackupFilesOnDisk", (qulonglong)_assetsOnDisk.size() }
+    });
+}
+
 void AssetsBackupHandler::computeServerStateDifference(const AssetUtils::Mappings& currentMappings,
                                                        const AssetUtils::Mappings& newMappings) {
     _mappingsLeftToSet.reserve((int)newMappings.size());
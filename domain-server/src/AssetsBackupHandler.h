@@ -12,9 +12,11 @@
 #ifndef hifi_AssetsBackupHandler_h
 #define hifi_AssetsBackupHandler_h
 
+#include <deque>
 #include <set>
 #include <map>
 
+#include <QDateTime>
 #include <QObject>
 #include <QTimer>
 #include <QJsonDocument>
@@ -45,6 +47,8 @@ public:
 
     bool operationInProgress() { return getRecoveryStatus().first; }
 
+    QVariantMap getBackupStatus() const override;
+
 private:
     void setupRefreshTimer();
     void refreshMappings();
@@ -85,9 +89,23 @@ private:
     std::set<AssetUtils::AssetHash> _assetsInBackups;
     std::set<AssetUtils::AssetHash> _assetsOnDisk;
 
+    qint64 _assetBytesOnDisk { 0 };
+
     // Internal storage for backup in progress
     std::set<AssetUtils::AssetHash> _assetsLeftToRequest;
 
+    // Each run of downloads started when new assets show up in the mappings
+    struct AssetBackupRun {
+        QDateTime startedAt;
+        qint64 durationMsecs { 0 };
+        qint64 bytesDownloaded { 0 };
+        int assetsDownloaded { 0 };
+        int assetsFailed { 0 };
+    };
+    AssetBackupRun _currentAssetBackupRun;
+    p_high_resolution_clock::time_point _assetBackupRunStart;
+    std::deque<AssetBackupRun> _assetBackupRuns;
+
     // Internal storage for restore in progress
     std::vector<AssetUtils::AssetHash> _assetsLeftToUpload;
     std::vector<std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash>> _mappingsLeftToSet;
@@ -0,0 +1,150 @@
+//
+//  BackupBlobStore.cpp
+//  domain-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BackupBlobStore.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSet>
+#include <QtCore/QTemporaryFile>
+
+static const qint64 COPY_CHUNK_SIZE = 256 * 1024;
+
+BackupBlobStore::BackupBlobStore(const QString& directory, const QString& extension) :
+    _directory(directory),
+    _extension(extension)
+{
+    QDir(_directory).mkpath(".");
+}
+
+QString BackupBlobStore::hash(const QByteArray& data) {
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex();
+}
+
+qint64 BackupBlobStore::copy(QIODevice& from, QIODevice& to) {
+    qint64 copied = 0;
+    QByteArray chunk;
+    while (!from.atEnd()) {
+        chunk = from.read(COPY_CHUNK_SIZE);
+        if (chunk.isEmpty()) {
+            break;
+        }
+        if (to.write(chunk) != chunk.size()) {
+            return -1;
+        }
+        copied += chunk.size();
+    }
+    return copied;
+}
+
+bool BackupBlobStore::isValidHash(const QString& hash) {
+    static const QRegularExpression SHA256_HEX { "^[0-9a-f]{64}$" };
+    return SHA256_HEX.match(hash).hasMatch();
+}
+
+QString BackupBlobStore::getPath(const QString& hash) const {
+    if (!isValidHash(hash)) {
+        return QString();
+    }
+    return _directory + "/" + hash + _extension;
+}
+
+bool BackupBlobStore::contains(const QString& hash) const {
+    return isValidHash(hash) && QFile::exists(getPath(hash));
+}
+
+QString BackupBlobStore::storeFile(const QString& sourcePath) {
+    QFile source { sourcePath };
+    if (!source.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not open" << sourcePath << "to back it up:" << source.errorString();
+        return QString();
+    }
+
+    // write it under a temporary name, only renamed to its hash once the whole file has been read
+    QTemporaryFile blob { _directory + "/XXXXXX.tmp" };
+    if (!blob.open()) {
+        qWarning() << "Could not create backup blob in" << _directory << ":" << blob.errorString();
+        return QString();
+    }
+
+    QCryptographicHash hash { QCryptographicHash::Sha256 };
+    QByteArray chunk;
+    while (!source.atEnd()) {
+        chunk = source.read(COPY_CHUNK_SIZE);
+        if (chunk.isEmpty()) {
+            break;
+        }
+        hash.addData(chunk);
+        if (blob.write(chunk) != chunk.size()) {
+            qWarning() << "Could not write backup blob" << blob.fileName() << ":" << blob.errorString();
+            return QString();
+        }
+    }
+    QString blobHash = hash.result().toHex();
+
+    // the temporary file removes itself unless it becomes the blob
+    if (!contains(blobHash)) {
+        if (!blob.flush() || !blob.rename(getPath(blobHash))) {
+            qWarning() << "Could not write backup blob" << getPath(blobHash) << ":" << blob.errorString();
+            return QString();
+        }
+        blob.setAutoRemove(false);
+    }
+    return blobHash;
+}
+
+bool BackupBlobStore::storeData(const QString& hash, const QByteArray& data) {
+    if (!isValidHash(hash)) {
+        qWarning() << "Refusing to store backup blob under invalid hash" << hash;
+        return false;
+    }
+    if (contains(hash)) {
+        return true;
+    }
+
+    QSaveFile blob { getPath(hash) };
+    if (!blob.open(QIODevice::WriteOnly) || blob.write(data) != data.size() || !blob.commit()) {
+        qWarning() << "Could not write backup blob" << blob.fileName() << ":" << blob.errorString();
+        return false;
+    }
+    return true;
+}
+
+QString BackupBlobStore::getReference(const QString& backupName) const {
+    auto it = _references.find(backupName);
+    return it != _references.end() ? it->second : QString();
+}
+
+void BackupBlobStore::referencesLoaded() {
+    _referencesLoaded = true;
+    removeUnreferenced();
+}
+
+void BackupBlobStore::removeUnreferenced() {
+    if (!_referencesLoaded) {
+        return;
+    }
+
+    QSet<QString> referenced;
+    for (const auto& reference : _references) {
+        referenced.insert(reference.second + _extension);
+    }
+
+    QDir directory { _directory };
+    for (const auto& fileName : directory.entryList({ "*" + _extension }, QDir::Files | QDir::NoSymLinks)) {
+        if (!referenced.contains(fileName) && !directory.remove(fileName)) {
+            qWarning() << "Could not remove unused backup blob" << directory.filePath(fileName);
+        }
+    }
+}
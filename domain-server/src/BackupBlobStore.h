@@ -0,0 +1,63 @@
+//
+//  BackupBlobStore.h
+//  domain-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BackupBlobStore_h
+#define hifi_BackupBlobStore_h
+
+#include <unordered_map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+class QIODevice;
+
+// Backed up content kept once per distinct version, in a directory beside the backups and named by the hash of
+// its data.  A backup records the hash rather than the data, so content that has not changed since the last
+// backup costs a few bytes to back up again, and the archives only carry it in full when consolidated for download.
+class BackupBlobStore {
+public:
+    BackupBlobStore(const QString& directory, const QString& extension);
+
+    static QString hash(const QByteArray& data);
+
+    // copies everything left to read from one device to the other a chunk at a time, returning the bytes copied
+    // or -1 on failure
+    static qint64 copy(QIODevice& from, QIODevice& to);
+
+    // true only for a hash this store could have written: the 64 hex digits of a SHA-256.  Hashes read from backups,
+    // which may have been uploaded, must pass this before they name a file
+    static bool isValidHash(const QString& hash);
+
+    // empty for an invalid hash
+    QString getPath(const QString& hash) const;
+    bool contains(const QString& hash) const;
+
+    // hashes the file as it copies it in, so the blob matches its hash even if the file changes meanwhile, and
+    // returns that hash or an empty string on failure
+    QString storeFile(const QString& sourcePath);
+    bool storeData(const QString& hash, const QByteArray& data);
+
+    // keep track of which backups use which blob, so that the ones nothing uses any more can be removed
+    void setReference(const QString& backupName, const QString& hash) { _references[backupName] = hash; }
+    void removeReference(const QString& backupName) { _references.erase(backupName); }
+    QString getReference(const QString& backupName) const;
+
+    // nothing is removed until the references from all the existing backups have been loaded
+    void referencesLoaded();
+    void removeUnreferenced();
+
+private:
+    QString _directory;
+    QString _extension;
+    std::unordered_map<QString, QString> _references;
+    bool _referencesLoaded { false };
+};
+
+#endif // hifi_BackupBlobStore_h
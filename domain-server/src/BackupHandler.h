@@ -12,9 +12,11 @@
 #ifndef hifi_BackupHandler_h
 #define hifi_BackupHandler_h
 
+#include <chrono>
 #include <memory>
 
 #include <QString>
+#include <QVariantMap>
 
 class QuaZip;
 
@@ -34,6 +36,12 @@ public:
     virtual void deleteBackup(const QString& backupName) = 0;
     virtual void consolidateBackup(const QString& backupName, QuaZip& zip) = 0;
     virtual bool isCorruptedBackup(const QString& backupName) = 0;
+
+    // How long the last createBackup held on to state that the domain-server's own thread also needs.
+    virtual std::chrono::microseconds getLastBackupStallTime() const { return std::chrono::microseconds(0); }
+
+    // Entries to add to the backup status, for work a handler does for its backups outside of createBackup.
+    virtual QVariantMap getBackupStatus() const { return QVariantMap(); }
 };
 using BackupHandlerPointer = std::unique_ptr<BackupHandlerInterface>;
 
@@ -12,6 +12,10 @@
 #include "ContentSettingsBackupHandler.h"
 #include "DomainContentBackupManager.h"
 
+#include <QtCore/QDir>
+
+#include <PortableHighResolutionClock.h>
+
 #if !defined(__clang__) && defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsuggest-override"
@@ -26,23 +30,81 @@
 #endif
 
 static const QString DATETIME_FORMAT { "yyyy-MM-dd_HH-mm-ss" };
+static const QString SETTINGS_BLOBS_DIR { "/settings" };
 
-ContentSettingsBackupHandler::ContentSettingsBackupHandler(DomainServerSettingsManager& domainServerSettingsManager) :
-    _settingsManager(domainServerSettingsManager)
+ContentSettingsBackupHandler::ContentSettingsBackupHandler(DomainServerSettingsManager& domainServerSettingsManager,
+                                                           QString backupDirectory) :
+    _settingsManager(domainServerSettingsManager),
+    _backupDirectory(backupDirectory),
+    _blobs(backupDirectory + SETTINGS_BLOBS_DIR, ".json")
 {
 }
 
+// A full backup holds the settings themselves.  A skeleton backup holds the hash of the blob with the settings in
+// it, next to the installed content details that change with every backup.
 static const QString CONTENT_SETTINGS_BACKUP_FILENAME = "content-settings.json";
+static const QString CONTENT_SETTINGS_REFERENCE_FILENAME = "content-settings-reference.json";
+static const QString CONTENT_SETTINGS_HASH_KEY = "hash";
+
+static bool readZipEntry(QuaZip& zip, const QString& fileName, QByteArray& data) {
+    if (!zip.setCurrentFile(fileName)) {
+        return false;
+    }
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    data = zipFile.readAll();
+    zipFile.close();
+    return zipFile.getZipError() == UNZ_OK;
+}
+
+static bool writeZipEntry(QuaZip& zip, const QString& fileName, const QByteArray& data) {
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(fileName))) {
+        qCritical().nospace() << "Failed to open " << fileName << ": " << zipFile.getZipError();
+        return false;
+    }
+    if (zipFile.write(data) == -1) {
+        qCritical().nospace() << "Failed to write to " << fileName << ": " << zipFile.getZipError();
+    }
+    zipFile.close();
+    if (zipFile.getZipError() != UNZ_OK) {
+        qCritical().nospace() << "Failed to zip " << fileName << ": " << zipFile.getZipError();
+        return false;
+    }
+    return true;
+}
+
+void ContentSettingsBackupHandler::loadBackup(const QString& backupName, QuaZip& zip) {
+    QByteArray rawReference;
+    if (readZipEntry(zip, CONTENT_SETTINGS_REFERENCE_FILENAME, rawReference)) {
+        auto reference = QJsonDocument::fromJson(rawReference).object();
+        QString blobHash = reference[CONTENT_SETTINGS_HASH_KEY].toString();
+        if (!BackupBlobStore::isValidHash(blobHash)) {
+            qWarning() << "Ignoring invalid content settings hash in backup" << backupName;
+            return;
+        }
+        _blobs.setReference(backupName, blobHash);
+    }
+}
+
+void ContentSettingsBackupHandler::loadingComplete() {
+    _blobs.referencesLoaded();
+}
 
 void ContentSettingsBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
 
     // grab the content settings as JSON, excluding default values and values hidden from backup
+    // this holds the settings lock that the domain-server's thread needs to change them
+    auto snapshotStart = p_high_resolution_clock::now();
     QJsonObject contentSettingsJSON = _settingsManager.settingsResponseObjectForType(
         "", // include all settings types
         DomainServerSettingsManager::Authenticated, DomainServerSettingsManager::NoDomainSettings,
         DomainServerSettingsManager::IncludeContentSettings, DomainServerSettingsManager::NoDefaultSettings,
         DomainServerSettingsManager::ForBackup
     );
+    _lastBackupStallTime = std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now() - snapshotStart);
     QString prefixFormat = "(" + QRegExp::escape(AUTOMATIC_BACKUP_PREFIX) + "|" + QRegExp::escape(MANUAL_BACKUP_PREFIX) + ")";
     QString nameFormat = "(.+)";
     QString dateTimeFormat = "(" + DATETIME_FORMAT_RE + ")";
@@ -62,33 +124,80 @@ void ContentSettingsBackupHandler::createBackup(const QString& backupName, QuaZi
         { INSTALLED_CONTENT_CREATION_TIME, createdAt.currentMSecsSinceEpoch()}
     };
 
-    contentSettingsJSON.insert(INSTALLED_CONTENT, installed_content);
+    // the settings only take space in the backups when they have changed since the last one
+    auto settingsData = QJsonDocument(contentSettingsJSON).toJson(QJsonDocument::Compact);
+    auto hash = BackupBlobStore::hash(settingsData);
+    if (!_blobs.storeData(hash, settingsData)) {
+        qCritical() << "Failed to store content settings for backup" << backupName;
+        return;
+    }
 
-    // make a QJsonDocument using the object
-    QJsonDocument contentSettingsDocument { contentSettingsJSON };
+    QJsonObject reference {
+        { CONTENT_SETTINGS_HASH_KEY, hash },
+        { INSTALLED_CONTENT, installed_content }
+    };
+    if (writeZipEntry(zip, CONTENT_SETTINGS_REFERENCE_FILENAME, QJsonDocument(reference).toJson())) {
+        _blobs.setReference(backupName, hash);
+    }
+}
 
-    QuaZipFile zipFile { &zip };
+void ContentSettingsBackupHandler::deleteBackup(const QString& backupName) {
+    _blobs.removeReference(backupName);
+    _blobs.removeUnreferenced();
+}
 
-    if (zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(CONTENT_SETTINGS_BACKUP_FILENAME))) {
-        if (zipFile.write(contentSettingsDocument.toJson()) == -1) {
-            qCritical().nospace() << "Failed to write to " << CONTENT_SETTINGS_BACKUP_FILENAME << ": " << zipFile.getZipError();
-        }
+void ContentSettingsBackupHandler::consolidateBackup(const QString& backupName, QuaZip& zip) {
+    auto hash = _blobs.getReference(backupName);
+    if (hash.isEmpty()) {
+        // already a full backup
+        return;
+    }
 
-        zipFile.close();
+    // the consolidated copy is only open for adding files, so the installed content details come from the original
+    QuaZip backup { QDir(_backupDirectory).filePath(backupName) };
+    QByteArray rawReference;
+    if (!backup.open(QuaZip::mdUnzip) || !readZipEntry(backup, CONTENT_SETTINGS_REFERENCE_FILENAME, rawReference)) {
+        qCritical() << "Failed to read" << CONTENT_SETTINGS_REFERENCE_FILENAME << "to consolidate" << backupName;
+        return;
+    }
+    backup.close();
+    auto reference = QJsonDocument::fromJson(rawReference).object();
 
-        if (zipFile.getZipError() != UNZ_OK) {
-            qCritical().nospace() << "Failed to zip " << CONTENT_SETTINGS_BACKUP_FILENAME << ": " << zipFile.getZipError();
-        }
-    } else {
-        qCritical().nospace() << "Failed to open " << CONTENT_SETTINGS_BACKUP_FILENAME << ": " << zipFile.getZipError();
+    QFile blob { _blobs.getPath(hash) };
+    if (!blob.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not open content settings" << blob.fileName() << "to consolidate" << backupName;
+        return;
     }
+    auto contentSettingsJSON = QJsonDocument::fromJson(blob.readAll()).object();
+    contentSettingsJSON.insert(INSTALLED_CONTENT, reference[INSTALLED_CONTENT]);
+
+    writeZipEntry(zip, CONTENT_SETTINGS_BACKUP_FILENAME, QJsonDocument(contentSettingsJSON).toJson());
+}
+
+bool ContentSettingsBackupHandler::isCorruptedBackup(const QString& backupName) {
+    auto hash = _blobs.getReference(backupName);
+    return !hash.isEmpty() && !_blobs.contains(hash);
 }
 
 std::pair<bool, QString> ContentSettingsBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
     if (!zip.setCurrentFile(CONTENT_SETTINGS_BACKUP_FILENAME)) {
-        QString errorStr("Failed to find " + CONTENT_SETTINGS_BACKUP_FILENAME + " while recovering backup");
-        qWarning() << errorStr;
-        return { false, errorStr };
+        // a skeleton backup refers to the settings in the blob store
+        QByteArray rawReference;
+        if (!readZipEntry(zip, CONTENT_SETTINGS_REFERENCE_FILENAME, rawReference)) {
+            QString errorStr("Failed to find " + CONTENT_SETTINGS_BACKUP_FILENAME + " while recovering backup");
+            qWarning() << errorStr;
+            return { false, errorStr };
+        }
+        auto reference = QJsonDocument::fromJson(rawReference).object();
+        QFile blob { _blobs.getPath(reference[CONTENT_SETTINGS_HASH_KEY].toString()) };
+        if (!blob.open(QIODevice::ReadOnly)) {
+            QString errorStr("Failed to open the content settings " + CONTENT_SETTINGS_REFERENCE_FILENAME + " refers to in backup");
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+        auto contentSettingsJSON = QJsonDocument::fromJson(blob.readAll()).object();
+        contentSettingsJSON.insert(INSTALLED_CONTENT, reference[INSTALLED_CONTENT]);
+        return recoverSettings(contentSettingsJSON, username, sourceFilename);
     }
 
     QuaZipFile zipFile { &zip };
@@ -108,8 +217,10 @@ std::pair<bool, QString> ContentSettingsBackupHandler::recoverBackup(const QStri
     }
 
     QJsonDocument jsonDocument = QJsonDocument::fromJson(rawData);
-    QJsonObject jsonObject = jsonDocument.object();
+    return recoverSettings(jsonDocument.object(), username, sourceFilename);
+}
 
+std::pair<bool, QString> ContentSettingsBackupHandler::recoverSettings(QJsonObject jsonObject, const QString& username, const QString& sourceFilename) {
     auto archiveJson = jsonObject.find(INSTALLED_CONTENT)->toObject();
 
     QJsonObject installed_content {
@@ -12,32 +12,40 @@
 #ifndef hifi_ContentSettingsBackupHandler_h
 #define hifi_ContentSettingsBackupHandler_h
 
+#include "BackupBlobStore.h"
 #include "BackupHandler.h"
 #include "DomainServerSettingsManager.h"
 
 class ContentSettingsBackupHandler : public BackupHandlerInterface {
 public:
-    ContentSettingsBackupHandler(DomainServerSettingsManager& domainServerSettingsManager);
+    ContentSettingsBackupHandler(DomainServerSettingsManager& domainServerSettingsManager, QString backupDirectory);
 
     std::pair<bool, float> isAvailable(const QString& backupName) override { return { true, 1.0f }; }
     std::pair<bool, float> getRecoveryStatus() override { return { false, 1.0f }; }
 
-    void loadBackup(const QString& backupName, QuaZip& zip) override {}
+    void loadBackup(const QString& backupName, QuaZip& zip) override;
 
-    void loadingComplete() override {}
+    void loadingComplete() override;
 
     void createBackup(const QString& backupName, QuaZip& zip) override;
 
     std::pair<bool, QString> recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) override;
 
-    void deleteBackup(const QString& backupName) override {}
+    void deleteBackup(const QString& backupName) override;
 
-    void consolidateBackup(const QString& backupName, QuaZip& zip) override {}
+    void consolidateBackup(const QString& backupName, QuaZip& zip) override;
 
-    bool isCorruptedBackup(const QString& backupName) override { return false; }
+    bool isCorruptedBackup(const QString& backupName) override;
+
+    std::chrono::microseconds getLastBackupStallTime() const override { return _lastBackupStallTime; }
 
 private:
+    std::pair<bool, QString> recoverSettings(QJsonObject jsonObject, const QString& username, const QString& sourceFilename);
+
     DomainServerSettingsManager& _settingsManager;
+    QString _backupDirectory;
+    BackupBlobStore _blobs;
+    std::chrono::microseconds _lastBackupStallTime { 0 };
 };
 
 #endif // hifi_ContentSettingsBackupHandler_h
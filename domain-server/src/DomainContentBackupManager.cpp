@@ -25,6 +25,7 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QJsonDocument>
@@ -44,6 +45,7 @@ const std::chrono::seconds DomainContentBackupManager::DEFAULT_PERSIST_INTERVAL
 static const QString DATETIME_FORMAT { "yyyy-MM-dd_HH-mm-ss" };
 static const QString PRE_UPLOAD_SUFFIX{ "pre_upload" };
 static const QString MANUAL_BACKUP_NAME_RE { "[a-zA-Z0-9\\-_ ]+" };
+static const size_t MAX_BACKUP_RUN_STATS = 20;
 
 void DomainContentBackupManager::addBackupHandler(BackupHandlerPointer handler) {
     _backupHandlers.push_back(std::move(handler));
@@ -491,6 +493,25 @@ void DomainContentBackupManager::getAllBackupsAndStatus(MiniPromise::Promise pro
         status["recoveryError"] = _recoveryError;
     }
 
+    QVariantList backupRuns;
+    for (const auto& stats : _backupRunStats) {
+        backupRuns.push_back(QVariantMap({
+            { "id", stats.name },
+            { "createdAtMillis", stats.createdAt.toMSecsSinceEpoch() },
+            { "durationMillis", stats.durationMsecs },
+            { "bytesWritten", stats.bytesWritten },
+            { "stallMicros", stats.stallUsecs }
+        }));
+    }
+    status["recentBackupRuns"] = backupRuns;
+
+    for (auto& handler : _backupHandlers) {
+        auto handlerStatus = handler->getBackupStatus();
+        for (auto it = handlerStatus.begin(); it != handlerStatus.end(); ++it) {
+            status[it.key()] = it.value();
+        }
+    }
+
 
     QString filename = _settingsManager.valueForKeyPath(CONTENT_SETTINGS_INSTALLED_CONTENT_FILENAME).toString();
     QString name = _settingsManager.valueForKeyPath(CONTENT_SETTINGS_INSTALLED_CONTENT_NAME).toString();
@@ -544,6 +565,12 @@ void DomainContentBackupManager::removeOldBackupVersions(const BackupRule& rule)
                 QFile backupFile(fileInfo);
                 if (!backupFile.remove()) {
                     qCDebug(domain_server) << "Failed to remove old backup: " << backupFile.fileName();
+                    continue;
+                }
+
+                // let go of the content only this backup was holding on to
+                for (auto& handler : _backupHandlers) {
+                    handler->deleteBackup(matchingFiles[i].fileName());
                 }
             }
         }
@@ -731,11 +758,28 @@ std::pair<bool, QString> DomainContentBackupManager::createBackup(const QString&
         return { false, path };
     }
 
+    auto start = p_high_resolution_clock::now();
+    std::chrono::microseconds stallTime { 0 };
     for (auto& handler : _backupHandlers) {
         handler->createBackup(fileName, zip);
+        stallTime += handler->getLastBackupStallTime();
     }
 
     zip.close();
 
+    BackupRunStats stats {
+        fileName,
+        QDateTime::currentDateTime(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(p_high_resolution_clock::now() - start).count(),
+        QFileInfo(path).size(),
+        stallTime.count()
+    };
+    qCDebug(domain_server).nospace() << "Backed up " << fileName << " in " << stats.durationMsecs << "ms, wrote "
+        << stats.bytesWritten << " bytes, stalled the domain-server for " << stats.stallUsecs << "us";
+    _backupRunStats.push_back(stats);
+    if (_backupRunStats.size() > MAX_BACKUP_RUN_STATS) {
+        _backupRunStats.pop_front();
+    }
+
     return { true, path };
 }
@@ -22,6 +22,7 @@
 #include <QDateTime>
 #include <QTimer>
 
+#include <deque>
 #include <mutex>
 #include <unordered_map>
 
@@ -55,6 +56,15 @@ struct BackupItemInfo {
     bool isManualBackup;
 };
 
+struct BackupRunStats {
+    QString name;
+    QDateTime createdAt;
+    qint64 durationMsecs;
+    qint64 bytesWritten;
+    // time spent holding on to state the domain-server's own thread needs, see BackupHandlerInterface
+    qint64 stallUsecs;
+};
+
 struct ConsolidatedBackupInfo {
     enum State {
         CONSOLIDATING,
@@ -144,6 +154,8 @@ private:
 
     p_high_resolution_clock::time_point _lastCheck;
     std::vector<BackupRule> _backupRules;
+
+    std::deque<BackupRunStats> _backupRunStats;
 };
 
 #endif  // hifi_DomainContentBackupManager_h
@@ -0,0 +1,100 @@
+//
+//  DomainListState.cpp
+//  domain-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListState.h"
+
+#include <QtCore/QDataStream>
+#include <QtCore/QSet>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+const DomainListState::Version DomainListState::NULL_VERSION;
+
+// nodes check in every second, so there is no point in re-serializing the list for every request
+const quint64 DOMAIN_LIST_REFRESH_INTERVAL_USECS = 100 * USECS_PER_MSEC;
+
+// past this many removals, nodes that acked older versions get a full list again
+const size_t MAX_DOMAIN_LIST_REMOVALS = 1024;
+
+void DomainListState::refresh(LimitedNodeList& nodeList) {
+    auto now = usecTimestampNow();
+    if (_lastRefresh != 0 && now - _lastRefresh < DOMAIN_LIST_REFRESH_INTERVAL_USECS) {
+        return;
+    }
+    _lastRefresh = now;
+
+    Version nextVersion = _version + 1;
+    bool changed = false;
+
+    QSet<QUuid> liveNodes;
+    liveNodes.reserve(_entries.size());
+
+    nodeList.eachNode([&](const SharedNodePointer& node) {
+        liveNodes.insert(node->getUUID());
+
+        QByteArray serializedNode;
+        QDataStream stream(&serializedNode, QIODevice::WriteOnly);
+        stream << *node.data();
+
+        auto& entry = _entries[node->getUUID()];
+        if (entry.version == NULL_VERSION || entry.serializedNode != serializedNode) {
+            entry.serializedNode = serializedNode;
+            entry.version = nextVersion;
+            changed = true;
+        }
+    });
+
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (!liveNodes.contains(it.key())) {
+            _removals.emplace_back(nextVersion, it.key());
+            it = _entries.erase(it);
+            changed = true;
+        } else {
+            ++it;
+        }
+    }
+
+    while (_removals.size() > MAX_DOMAIN_LIST_REMOVALS) {
+        _oldestDeltaVersion = _removals.front().first;
+        _removals.pop_front();
+    }
+
+    if (changed) {
+        _version = nextVersion;
+    }
+}
+
+bool DomainListState::canSendDeltaFrom(Version version) const {
+    // a version newer than ours means the node heard from a previous run of this domain-server
+    return version != NULL_VERSION && version >= _oldestDeltaVersion && version <= _version;
+}
+
+void DomainListState::eachNodeChangedSince(Version version, const EntryOperator& functor) const {
+    for (auto it = _entries.cbegin(); it != _entries.cend(); ++it) {
+        if (it->version > version) {
+            functor(it.key(), it->serializedNode);
+        }
+    }
+}
+
+void DomainListState::eachNodeRemovedSince(Version version, const RemovalOperator& functor) const {
+    for (auto it = _removals.crbegin(); it != _removals.crend() && it->first > version; ++it) {
+        functor(it->second);
+    }
+}
+
+int DomainListState::numNodesRemovedSince(Version version) const {
+    int numRemoved = 0;
+    eachNodeRemovedSince(version, [&numRemoved](const QUuid&) {
+        ++numRemoved;
+    });
+    return numRemoved;
+}
@@ -0,0 +1,60 @@
+//
+//  DomainListState.h
+//  domain-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DomainListState_h
+#define hifi_DomainListState_h
+
+#include <deque>
+#include <functional>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QUuid>
+
+#include <LimitedNodeList.h>
+
+// Versioned copy of the serialized domain list.
+// Nodes ack the last version they received with their DomainListRequest, and are then sent
+// only the nodes that were added or changed, and the ones that were removed, since that version.
+class DomainListState {
+public:
+    using Version = quint32;
+    static const Version NULL_VERSION = 0;
+
+    // Re-serialize the node list, bumping the version of the nodes that were added or changed
+    // and logging the ones that left. Does nothing if the last refresh is recent enough.
+    void refresh(LimitedNodeList& nodeList);
+
+    Version getVersion() const { return _version; }
+
+    // Deltas can be sent to nodes that acked a version we still have the removals since
+    bool canSendDeltaFrom(Version version) const;
+
+    using EntryOperator = std::function<void(const QUuid& nodeUUID, const QByteArray& serializedNode)>;
+    void eachNodeChangedSince(Version version, const EntryOperator& functor) const;
+
+    using RemovalOperator = std::function<void(const QUuid& nodeUUID)>;
+    void eachNodeRemovedSince(Version version, const RemovalOperator& functor) const;
+    int numNodesRemovedSince(Version version) const;
+
+private:
+    struct Entry {
+        QByteArray serializedNode;
+        Version version { NULL_VERSION };
+    };
+
+    QHash<QUuid, Entry> _entries;
+    std::deque<std::pair<Version, QUuid>> _removals; // oldest first
+    Version _version { NULL_VERSION };
+    Version _oldestDeltaVersion { NULL_VERSION };
+    quint64 _lastRefresh { 0 };
+};
+
+#endif // hifi_DomainListState_h
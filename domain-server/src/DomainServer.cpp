@@ -320,9 +320,9 @@ DomainServer::DomainServer(int argc, char* argv[]) :
     _contentManager.reset(new DomainContentBackupManager(getContentBackupDir(), _settingsManager));
 
     connect(_contentManager.get(), &DomainContentBackupManager::started, _contentManager.get(), [this](){
-        _contentManager->addBackupHandler(BackupHandlerPointer(new EntitiesBackupHandler(getEntitiesFilePath(), getEntitiesReplacementFilePath())));
+        _contentManager->addBackupHandler(BackupHandlerPointer(new EntitiesBackupHandler(getEntitiesFilePath(), getEntitiesReplacementFilePath(), getContentBackupDir())));
         _contentManager->addBackupHandler(BackupHandlerPointer(new AssetsBackupHandler(getContentBackupDir(), isAssetServerEnabled())));
-        _contentManager->addBackupHandler(BackupHandlerPointer(new ContentSettingsBackupHandler(_settingsManager)));
+        _contentManager->addBackupHandler(BackupHandlerPointer(new ContentSettingsBackupHandler(_settingsManager, getContentBackupDir())));
     });
 
     _contentManager->initialize(true);
@@ -1100,6 +1100,12 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
         safeInterestSet.remove(NodeType::Agent);
     }
 
+    // a node that changed what it is interested in needs the full list again
+    DomainListState::Version knownDomainListVersion = nodeRequestData.domainListVersion;
+    if (nodeData->getNodeInterestSet() != safeInterestSet) {
+        knownDomainListVersion = DomainListState::NULL_VERSION;
+    }
+
     // update the NodeInterestSet in case there have been any changes
     nodeData->setNodeInterestSet(safeInterestSet);
 
@@ -1109,7 +1115,8 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
-    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
+    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false,
+                         knownDomainListVersion);
 }
 
 bool DomainServer::isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -1191,16 +1198,31 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
     broadcastNewNode(newNode);
 }
 
-void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr &senderSockAddr, bool newConnection) {
+void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr &senderSockAddr, bool newConnection,
+                                        DomainListState::Version knownDomainListVersion) {
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
+    quint64 serializationStart = usecTimestampNow();
+
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+    bool sendsNodes = nodeInterestSet.size() > 0 && nodeData->isAuthenticated();
+
+    // nodes that acked a version we can diff against only get what was added, changed or removed since.
+    // Nodes we don't send anything to are left at the null version so they get a full list once we do.
+    _domainListState.refresh(*limitedNodeList);
+    DomainListState::Version domainListVersion = sendsNodes ? _domainListState.getVersion() : DomainListState::NULL_VERSION;
+    bool isDelta = sendsNodes && !newConnection && _domainListState.canSendDeltaFrom(knownDomainListVersion);
+    quint32 numRemovedNodes = isDelta ? _domainListState.numNodesRemovedSince(knownDomainListVersion) : 0;
+
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1212,44 +1234,81 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    extendedHeaderStream << domainListVersion;
+    extendedHeaderStream << isDelta;
+    extendedHeaderStream << (isDelta ? knownDomainListVersion : DomainListState::NULL_VERSION);
+    extendedHeaderStream << numRemovedNodes;
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
+    if (isDelta) {
+        // the nodes that left since the acked version come first
+        _domainListState.eachNodeRemovedSince(knownDomainListVersion, [&](const QUuid& removedUUID) {
+            domainListPackets->startSegment();
+            domainListStream << removedUUID;
+            domainListPackets->endSegment();
+        });
 
+        // then the ones that were added or changed, still serialized from the last refresh
+        _domainListState.eachNodeChangedSince(knownDomainListVersion, [&](const QUuid& otherUUID, const QByteArray& serializedNode) {
+            auto otherNode = limitedNodeList->nodeWithUUID(otherUUID);
+            if (otherNode && otherUUID != node->getUUID() && isInInterestSet(node, otherNode)) {
+                domainListPackets->startSegment();
+                domainListPackets->write(serializedNode);
+                domainListStream << connectionSecretForNodes(node, otherNode);
+                domainListPackets->endSegment();
+            }
+        });
+    } else if (sendsNodes) {
         // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
+        // if this authenticated node has any interest types, send back those nodes as well
+        limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
+            if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                // since we're about to add a node to the packet we start a segment
+                domainListPackets->startSegment();
 
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+                // don't send avatar nodes to other avatars, that will come from avatar mixer
+                domainListStream << *otherNode.data();
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
+                // pack the secret that these two nodes will use to communicate with each other
+                domainListStream << connectionSecretForNodes(node, otherNode);
 
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+                // we've added the node we wanted so end the segment now
+                domainListPackets->endSegment();
+            }
+        });
     }
 
     // send an empty list to the node, in case there were no other nodes
     domainListPackets->closeCurrentPacket(true);
 
+    size_t numBytes = domainListPackets->getDataSize();
+    quint64 serializationTime = usecTimestampNow() - serializationStart;
+    nodeData->noteDomainListSent(isDelta, serializationTime, numBytes);
+    _domainListBytesRate.increment(numBytes);
+    _domainListSerializationTime.updateAverage((float)serializationTime);
+    if (isDelta) {
+        ++_numDeltaDomainLists;
+    } else {
+        ++_numFullDomainLists;
+    }
+
     // write the PacketList to this node
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+QJsonObject DomainServer::domainListStatsJSON() const {
+    QJsonObject stats;
+    stats["version"] = (double)_domainListState.getVersion();
+    stats["full_lists"] = (double)_numFullDomainLists;
+    stats["delta_lists"] = (double)_numDeltaDomainLists;
+    stats["average_serialization_usecs"] = _domainListSerializationTime.getAverage();
+    stats["bytes_per_second"] = _domainListBytesRate.rate();
+    return stats;
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -2171,6 +2230,7 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             });
 
             rootJSON["nodes"] = nodesJSONArray;
+            rootJSON["domain_list"] = domainListStatsJSON();
 
             // print out the created JSON
             QJsonDocument nodesDocument(rootJSON);
@@ -2266,6 +2326,10 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                     QJsonObject statsObject =
                         static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getStatsJSONObject();
 
+                    // add what it costs us to keep this node's domain list up to date
+                    statsObject["domain_list"] =
+                        static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getDomainListStatsJSONObject();
+
                     // add the node type to the JSON data for output purposes
                     statsObject["node_type"] = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
 
@@ -26,9 +26,12 @@
 #include <Assignment.h>
 #include <HTTPSConnection.h>
 #include <LimitedNodeList.h>
+#include <SimpleMovingAverage.h>
+#include <shared/RateCounter.h>
 
 #include "AssetsBackupHandler.h"
 #include "DomainGatekeeper.h"
+#include "DomainListState.h"
 #include "DomainMetadata.h"
 #include "DomainServerSettingsManager.h"
 #include "DomainServerWebSessionData.h"
@@ -176,7 +179,9 @@ private:
     void handleKillNode(SharedNodePointer nodeToKill);
     void broadcastNodeDisconnect(const SharedNodePointer& disconnnectedNode);
 
-    void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr& senderSockAddr, bool newConnection);
+    void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr& senderSockAddr, bool newConnection,
+                              DomainListState::Version knownDomainListVersion = DomainListState::NULL_VERSION);
+    QJsonObject domainListStatsJSON() const;
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
@@ -230,6 +235,12 @@ private:
 
     DomainGatekeeper _gatekeeper;
 
+    DomainListState _domainListState;
+    RateCounter<> _domainListBytesRate;
+    SimpleMovingAverage _domainListSerializationTime; // usecs
+    quint64 _numFullDomainLists { 0 };
+    quint64 _numDeltaDomainLists { 0 };
+
     HTTPManager _httpManager;
     std::unique_ptr<HTTPSManager> _httpsManager;
 
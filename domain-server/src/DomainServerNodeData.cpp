@@ -77,3 +77,17 @@ void DomainServerNodeData::removeOverrideForKey(const QString& key, const QStrin
     // Remove override value
     _overrideHash.remove({key, value});
 }
+
+void DomainServerNodeData::noteDomainListSent(bool isDelta, quint64 serializationTime, size_t numBytes) {
+    _domainListWasDelta = isDelta;
+    _domainListSerializationTime = serializationTime;
+    _domainListBytesRate.increment(numBytes);
+}
+
+QJsonObject DomainServerNodeData::getDomainListStatsJSONObject() const {
+    QJsonObject stats;
+    stats["last_was_delta"] = _domainListWasDelta;
+    stats["last_serialization_usecs"] = (double)_domainListSerializationTime;
+    stats["bytes_per_second"] = _domainListBytesRate.rate();
+    return stats;
+}
@@ -21,6 +21,7 @@
 #include <NLPacket.h>
 #include <NodeData.h>
 #include <NodeType.h>
+#include <shared/RateCounter.h>
 
 class DomainServerNodeData : public NodeData {
 public:
@@ -75,6 +76,9 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
+
+    void noteDomainListSent(bool isDelta, quint64 serializationTime, size_t numBytes);
+    QJsonObject getDomainListStatsJSONObject() const;
     
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
@@ -102,6 +106,10 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    RateCounter<> _domainListBytesRate;
+    quint64 _domainListSerializationTime { 0 }; // usecs, for the last domain list sent
+    bool _domainListWasDelta { false };
 };
 
 #endif // hifi_DomainServerNodeData_h
@@ -27,55 +27,144 @@
 
 #include <OctreeDataUtils.h>
 
-EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath) :
+static const QString ENTITIES_BLOBS_DIR { "/entities" };
+
+EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath,
+                                             QString backupDirectory) :
     _entitiesFilePath(entitiesFilePath),
-    _entitiesReplacementFilePath(entitiesReplacementFilePath)
+    _entitiesReplacementFilePath(entitiesReplacementFilePath),
+    _blobs(backupDirectory + ENTITIES_BLOBS_DIR, ".json.gz")
 {
 }
 
+// a full backup holds the entities themselves, a skeleton backup only the hash of the blob holding them
 static const QString ENTITIES_BACKUP_FILENAME = "models.json.gz";
+static const QString ENTITIES_BACKUP_HASH_FILENAME = "models.json.gz.sha256";
 
-void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
-    QFile entitiesFile { _entitiesFilePath };
+static bool readZipEntry(QuaZip& zip, const QString& fileName, QByteArray& data) {
+    if (!zip.setCurrentFile(fileName)) {
+        return false;
+    }
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    data = zipFile.readAll();
+    zipFile.close();
+    return zipFile.getZipError() == UNZ_OK;
+}
 
-    if (entitiesFile.open(QIODevice::ReadOnly)) {
-        QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, _entitiesFilePath))) {
-            qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
-            return;
-        }
-        auto entityData = entitiesFile.readAll();
-        if (zipFile.write(entityData) != entityData.size()) {
-            qCritical() << "Failed to write entities file to backup";
-            zipFile.close();
+void EntitiesBackupHandler::loadBackup(const QString& backupName, QuaZip& zip) {
+    QByteArray hash;
+    if (readZipEntry(zip, ENTITIES_BACKUP_HASH_FILENAME, hash)) {
+        QString blobHash = QString::fromLatin1(hash.trimmed());
+        if (!BackupBlobStore::isValidHash(blobHash)) {
+            qWarning() << "Ignoring invalid entities hash in backup" << backupName;
             return;
         }
-        zipFile.close();
-        if (zipFile.getZipError() != UNZ_OK) {
-            qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_FILENAME << ": " << zipFile.getZipError();
-        }
+        _blobs.setReference(backupName, blobHash);
     }
 }
 
-std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
-    if (!zip.setCurrentFile(ENTITIES_BACKUP_FILENAME)) {
-        QString errorStr("Failed to find " + ENTITIES_BACKUP_FILENAME + " while recovering backup");
-        qWarning() << errorStr;
-        return { false, errorStr };
+void EntitiesBackupHandler::loadingComplete() {
+    _blobs.referencesLoaded();
+}
+
+void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
+    if (!QFile::exists(_entitiesFilePath)) {
+        return;
     }
-    QuaZipFile zipFile { &zip };
-    if (!zipFile.open(QIODevice::ReadOnly)) {
-        QString errorStr("Failed to open " + ENTITIES_BACKUP_FILENAME + " in backup");
-        qCritical() << errorStr;
-        return { false, errorStr };
+
+    // the entities only take space in the backups when they have changed since the last one
+    auto hash = _blobs.storeFile(_entitiesFilePath);
+    if (hash.isEmpty()) {
+        qCritical() << "Failed to store entities for backup" << backupName;
+        return;
     }
-    auto rawData = zipFile.readAll();
 
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_HASH_FILENAME, _entitiesFilePath))) {
+        qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_HASH_FILENAME << " for writing in zip";
+        return;
+    }
+    zipFile.write(hash.toLatin1());
     zipFile.close();
+    if (zipFile.getZipError() != UNZ_OK) {
+        qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_HASH_FILENAME << ": " << zipFile.getZipError();
+        return;
+    }
+    _blobs.setReference(backupName, hash);
+}
+
+void EntitiesBackupHandler::deleteBackup(const QString& backupName) {
+    _blobs.removeReference(backupName);
+    _blobs.removeUnreferenced();
+}
+
+void EntitiesBackupHandler::consolidateBackup(const QString& backupName, QuaZip& zip) {
+    auto hash = _blobs.getReference(backupName);
+    if (hash.isEmpty()) {
+        // already a full backup
+        return;
+    }
+
+    QFile blob { _blobs.getPath(hash) };
+    if (!blob.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not open entities" << blob.fileName() << "to consolidate" << backupName;
+        return;
+    }
 
+    // the entities are gzipped already, there is nothing to gain from deflating them again
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, blob.fileName()), nullptr, 0, 0)) {
+        qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
+        return;
+    }
+    if (BackupBlobStore::copy(blob, zipFile) < 0) {
+        qCritical() << "Failed to write entities file to consolidated backup";
+    }
+    zipFile.close();
     if (zipFile.getZipError() != UNZ_OK) {
-        QString errorStr("Failed to unzip " + ENTITIES_BACKUP_FILENAME + ": " + zipFile.getZipError());
-        qCritical() << errorStr;
+        qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_FILENAME << ": " << zipFile.getZipError();
+    }
+}
+
+bool EntitiesBackupHandler::isCorruptedBackup(const QString& backupName) {
+    auto hash = _blobs.getReference(backupName);
+    return !hash.isEmpty() && !_blobs.contains(hash);
+}
+
+std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
+    QByteArray rawData;
+    QByteArray hash;
+    if (zip.setCurrentFile(ENTITIES_BACKUP_FILENAME)) {
+        // full and consolidated backups carry the entities themselves
+        QuaZipFile zipFile { &zip };
+        if (!zipFile.open(QIODevice::ReadOnly)) {
+            QString errorStr("Failed to open " + ENTITIES_BACKUP_FILENAME + " in backup");
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+        rawData = zipFile.readAll();
+
+        zipFile.close();
+
+        if (zipFile.getZipError() != UNZ_OK) {
+            QString errorStr("Failed to unzip " + ENTITIES_BACKUP_FILENAME + ": " + zipFile.getZipError());
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+    } else if (readZipEntry(zip, ENTITIES_BACKUP_HASH_FILENAME, hash)) {
+        QFile blob { _blobs.getPath(QString::fromLatin1(hash.trimmed())) };
+        if (!blob.open(QIODevice::ReadOnly)) {
+            QString errorStr("Failed to open the entities " + ENTITIES_BACKUP_HASH_FILENAME + " refers to in backup");
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+        rawData = blob.readAll();
+    } else {
+        QString errorStr("Failed to find " + ENTITIES_BACKUP_FILENAME + " while recovering backup");
+        qWarning() << errorStr;
         return { false, errorStr };
     }
 
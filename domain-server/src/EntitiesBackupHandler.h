@@ -12,36 +12,38 @@
 #ifndef hifi_EntitiesBackupHandler_h
 #define hifi_EntitiesBackupHandler_h
 
+#include "BackupBlobStore.h"
 #include "BackupHandler.h"
 
 class EntitiesBackupHandler : public BackupHandlerInterface {
 public:
-    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath);
+    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath, QString backupDirectory);
 
     std::pair<bool, float> isAvailable(const QString& backupName) override { return { true, 1.0f }; }
     std::pair<bool, float> getRecoveryStatus() override { return { false, 1.0f }; }
 
-    void loadBackup(const QString& backupName, QuaZip& zip) override {}
+    void loadBackup(const QString& backupName, QuaZip& zip) override;
 
-    void loadingComplete() override {}
+    void loadingComplete() override;
 
-    // Create a skeleton backup
+    // Create a skeleton backup, referring to the entities by hash
     void createBackup(const QString& backupName, QuaZip& zip) override;
 
-    // Recover from a full backup
+    // Recover from a full or skeleton backup
     std::pair<bool, QString> recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) override;
 
     // Delete a skeleton backup
-    void deleteBackup(const QString& backupName) override {}
+    void deleteBackup(const QString& backupName) override;
 
     // Create a full backup
-    void consolidateBackup(const QString& backupName, QuaZip& zip) override {}
+    void consolidateBackup(const QString& backupName, QuaZip& zip) override;
 
-    bool isCorruptedBackup(const QString& backupName) override { return false; }
+    bool isCorruptedBackup(const QString& backupName) override;
 
 private:
     QString _entitiesFilePath;
     QString _entitiesReplacementFilePath;
+    BackupBlobStore _blobs;
 };
 
 #endif /* hifi_EntitiesBackupHandler_h */
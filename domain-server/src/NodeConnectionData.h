@@ -35,6 +35,7 @@ public:
     quint32 connectReason;
     quint64 previousConnectionUpTime;
     QByteArray protocolVersion;
+    quint32 domainListVersion { 0 };
 };
 
 
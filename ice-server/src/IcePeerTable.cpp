@@ -0,0 +1,159 @@
+//
+//  IcePeerTable.cpp
+//  ice-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "IcePeerTable.h"
+
+#include <algorithm>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+
+#include <SharedUtil.h>
+
+IcePeerTable::IcePeerTable(quint64 silenceThresholdUsecs, quint64 wheelSlotUsecs) :
+    _silenceThresholdUsecs(silenceThresholdUsecs),
+    _wheelSlotUsecs(wheelSlotUsecs),
+    // enough slots that a peer is never scheduled a full turn of the wheel ahead
+    _wheel((size_t)(silenceThresholdUsecs / wheelSlotUsecs) + 2),
+    _nextWheelSlot(slotForTime(usecTimestampNow()))
+{
+}
+
+SharedNetworkPeer IcePeerTable::find(const QUuid& peerID) const {
+    const auto& shard = _shards[shardForID(peerID)];
+    Locker lock(shard.mutex);
+    auto it = shard.peers.find(peerID);
+    return it != shard.peers.end() ? it->second.peer : SharedNetworkPeer();
+}
+
+size_t IcePeerTable::size() const {
+    size_t result = 0;
+    for (const auto& shard : _shards) {
+        Locker lock(shard.mutex);
+        result += shard.peers.size();
+    }
+    return result;
+}
+
+SharedNetworkPeer IcePeerTable::addOrUpdate(const QUuid& peerID, const HifiSockAddr& publicSocket,
+                                            const HifiSockAddr& localSocket, quint64 now) {
+    SharedNetworkPeer peer;
+    bool isNewPeer = false;
+    {
+        auto& shard = _shards[shardForID(peerID)];
+        Locker lock(shard.mutex);
+        auto& entry = shard.peers[peerID];
+        if (!entry.peer) {
+            entry.peer = QSharedPointer<NetworkPeer>::create(peerID, publicSocket, localSocket);
+            // we may be on a worker thread, but the peer belongs with the rest of the server
+            if (qApp && entry.peer->thread() != qApp->thread()) {
+                entry.peer->moveToThread(qApp->thread());
+            }
+            isNewPeer = true;
+        } else {
+            // we already had the peer so just potentially update their sockets
+            entry.peer->setPublicSocket(publicSocket);
+            entry.peer->setLocalSocket(localSocket);
+        }
+
+        // update our last heard microstamp for this network peer to now
+        entry.peer->setLastHeardMicrostamp(now);
+        peer = entry.peer;
+    }
+
+    if (isNewPeer) {
+        schedule(peerID, now + _silenceThresholdUsecs);
+    }
+    return peer;
+}
+
+bool IcePeerTable::isVerifiedHeartbeat(const QUuid& peerID, const QByteArray& plaintext,
+                                       const QByteArray& signature) const {
+    const auto& shard = _shards[shardForID(peerID)];
+    Locker lock(shard.mutex);
+    auto it = shard.peers.find(peerID);
+    return it != shard.peers.end() && !it->second.verifiedSignature.isEmpty() &&
+        it->second.verifiedSignature == signature && it->second.verifiedPlaintext == plaintext;
+}
+
+void IcePeerTable::setVerifiedHeartbeat(const QUuid& peerID, const QByteArray& plaintext, const QByteArray& signature) {
+    auto& shard = _shards[shardForID(peerID)];
+    Locker lock(shard.mutex);
+    auto it = shard.peers.find(peerID);
+    if (it != shard.peers.end()) {
+        // the plaintext points into the packet, keep a copy of our own
+        it->second.verifiedPlaintext = QByteArray(plaintext.constData(), plaintext.size());
+        it->second.verifiedSignature = signature;
+    }
+}
+
+void IcePeerTable::clearVerifiedHeartbeat(const QUuid& peerID) {
+    auto& shard = _shards[shardForID(peerID)];
+    Locker lock(shard.mutex);
+    auto it = shard.peers.find(peerID);
+    if (it != shard.peers.end()) {
+        it->second.verifiedPlaintext.clear();
+        it->second.verifiedSignature.clear();
+    }
+}
+
+void IcePeerTable::schedule(const QUuid& peerID, quint64 expiryTime) {
+    std::lock_guard<std::mutex> lock(_wheelMutex);
+    // anything due in a slot we have already turned past goes in the next one to come due
+    auto slot = std::max(slotForTime(expiryTime), _nextWheelSlot);
+    _wheel[slot % _wheel.size()].push_back(peerID);
+}
+
+std::vector<SharedNetworkPeer> IcePeerTable::removeInactivePeers(quint64 now) {
+    std::vector<SharedNetworkPeer> removedPeers;
+
+    std::vector<QUuid> duePeerIDs;
+    {
+        std::lock_guard<std::mutex> lock(_wheelMutex);
+        auto currentSlot = slotForTime(now);
+        if (currentSlot < _nextWheelSlot) {
+            // already turned up to this time, or the clock went backwards
+            return removedPeers;
+        }
+        // never turn more than once around the wheel, even after a long stall
+        if (currentSlot - _nextWheelSlot >= _wheel.size()) {
+            _nextWheelSlot = currentSlot - _wheel.size() + 1;
+        }
+        for (; _nextWheelSlot <= currentSlot; ++_nextWheelSlot) {
+            auto& slot = _wheel[_nextWheelSlot % _wheel.size()];
+            duePeerIDs.insert(duePeerIDs.end(), slot.begin(), slot.end());
+            slot.clear();
+        }
+    }
+
+    for (const auto& peerID : duePeerIDs) {
+        quint64 expiryTime = 0;
+        {
+            auto& shard = _shards[shardForID(peerID)];
+            Locker lock(shard.mutex);
+            auto it = shard.peers.find(peerID);
+            if (it == shard.peers.end()) {
+                continue;
+            }
+
+            expiryTime = it->second.peer->getLastHeardMicrostamp() + _silenceThresholdUsecs;
+            if (expiryTime < now) {
+                removedPeers.push_back(it->second.peer);
+                shard.peers.erase(it);
+                continue;
+            }
+        }
+
+        // heard from since it was scheduled, look again when its latest heartbeat runs out
+        schedule(peerID, expiryTime);
+    }
+
+    return removedPeers;
+}
@@ -0,0 +1,84 @@
+//
+//  IcePeerTable.h
+//  ice-server/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_IcePeerTable_h
+#define hifi_IcePeerTable_h
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUuid>
+
+#include <UUIDHasher.h>
+
+#include <NetworkPeer.h>
+
+// The heartbeating peers the ice-server knows about, split into shards by ID so that heartbeats for different
+// shards can be handled on different threads without contending for one lock.
+//
+// Peers are expired off a timer wheel rather than by scanning the whole table: each peer sits in the slot of the
+// time it would go silent, and only the peers in the slots that have come due get looked at, to be dropped or
+// moved on to the slot their last heartbeat puts them in now.
+class IcePeerTable {
+public:
+    static const int NUM_SHARDS = 16;
+
+    IcePeerTable(quint64 silenceThresholdUsecs, quint64 wheelSlotUsecs);
+
+    static int shardForID(const QUuid& peerID) { return (int)(qHash(peerID) % NUM_SHARDS); }
+
+    SharedNetworkPeer find(const QUuid& peerID) const;
+    size_t size() const;
+
+    // creates the peer or refreshes its sockets, and marks it as heard from now
+    SharedNetworkPeer addOrUpdate(const QUuid& peerID, const HifiSockAddr& publicSocket,
+                                  const HifiSockAddr& localSocket, quint64 now);
+
+    // a domain's heartbeats are signed the same way until its sockets change, so the last one that passed RSA
+    // verification is remembered and an identical one is let through without verifying it again
+    bool isVerifiedHeartbeat(const QUuid& peerID, const QByteArray& plaintext, const QByteArray& signature) const;
+    void setVerifiedHeartbeat(const QUuid& peerID, const QByteArray& plaintext, const QByteArray& signature);
+    // for when the domain's public key changes, so that what it signed with the old key has to be verified again
+    void clearVerifiedHeartbeat(const QUuid& peerID);
+
+    // removes and returns the peers that have not been heard from in the silence threshold
+    std::vector<SharedNetworkPeer> removeInactivePeers(quint64 now);
+
+private:
+    struct Entry {
+        SharedNetworkPeer peer;
+        QByteArray verifiedPlaintext;
+        QByteArray verifiedSignature;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<QUuid, Entry> peers;
+    };
+
+    using Locker = std::lock_guard<std::mutex>;
+
+    quint64 slotForTime(quint64 time) const { return time / _wheelSlotUsecs; }
+    void schedule(const QUuid& peerID, quint64 expiryTime);
+
+    const quint64 _silenceThresholdUsecs;
+    const quint64 _wheelSlotUsecs;
+
+    std::array<Shard, NUM_SHARDS> _shards;
+
+    std::mutex _wheelMutex;
+    std::vector<std::vector<QUuid>> _wheel;
+    quint64 _nextWheelSlot { 0 };
+};
+
+#endif // hifi_IcePeerTable_h
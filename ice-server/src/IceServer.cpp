@@ -13,27 +13,50 @@
 
 #include <openssl/x509.h>
 
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QDataStream>
+#include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QTimer>
 #include <QtNetwork/QNetworkReply>
 #include <QtNetwork/QNetworkRequest>
 
 #include <LimitedNodeList.h>
+#include <LogHandler.h>
 #include <NetworkAccessManager.h>
 #include <NetworkingConstants.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
+#include <UUID.h>
 
 const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
 const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
 
+// batches with fewer heartbeats than this are handled on the main thread
+const size_t MIN_PARALLEL_HEARTBEATS = 64;
+
 IceServer::IceServer(int argc, char* argv[]) :
     QCoreApplication(argc, argv),
     _id(QUuid::createUuid()),
     _serverSocket(0, false),
-    _activePeers()
+    _activePeers(PEER_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC, CLEAR_INACTIVE_PEERS_INTERVAL_MSECS * USECS_PER_MSEC)
 {
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity ICE server");
+
+    const QCommandLineOption testDomainKeysOption("test-domain-keys",
+        "For stress testing only: trust the domain public keys in this file, one \"<domain ID> <base64 PKCS#1 key>\" "
+        "per line, as written by ice-client --write-test-domain-keys", "path");
+    parser.addOption(testDomainKeysOption);
+    // the ice-server has always ignored arguments it doesn't know, keep doing so
+    parser.parse(arguments());
+
+    if (parser.isSet(testDomainKeysOption)) {
+        loadTestDomainPublicKeys(parser.value(testDomainKeysOption));
+    }
+
     // start the ice-server socket
     qDebug() << "ice-server socket is listening on" << ICE_SERVER_DEFAULT_PORT;
     _serverSocket.bind(QHostAddress::AnyIPv4, ICE_SERVER_DEFAULT_PORT);
@@ -67,64 +90,117 @@ bool IceServer::packetVersionMatch(const udt::Packet& packet) {
 }
 
 void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
+    // the socket hands us every datagram it read in one go, so hold on to them and handle them together once it's done
+    if (_pendingPackets.empty()) {
+        QMetaObject::invokeMethod(this, "processPendingPackets", Qt::QueuedConnection);
+    }
+    _pendingPackets.push_back(NLPacket::fromBase(std::move(packet)));
+}
+
+void IceServer::processPendingPackets() {
+    auto packets = std::move(_pendingPackets);
+    _pendingPackets.clear();
+
+    // heartbeats are grouped by the peer table shard of their sender, so that each shard is only touched by one thread
+    std::array<std::vector<Heartbeat>, IcePeerTable::NUM_SHARDS> heartbeatShards;
+    size_t numHeartbeats = 0;
+    std::vector<std::unique_ptr<NLPacket>> queries;
+
+    for (auto& nlPacket : packets) {
+        // make sure that this packet at least looks like something we can read
+        if (nlPacket->getPayloadSize() < NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
+            continue;
+        }
 
-    auto nlPacket = NLPacket::fromBase(std::move(packet));
-    
-    // make sure that this packet at least looks like something we can read
-    if (nlPacket->getPayloadSize() >= NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
-        
         if (nlPacket->getType() == PacketType::ICEServerHeartbeat) {
-            SharedNetworkPeer peer = addOrUpdateHeartbeatingPeer(*nlPacket);
-            if (peer) {
-                // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
-                peer->activateMatchingOrNewSymmetricSocket(nlPacket->getSenderSockAddr());
+            if (nlPacket->getPayloadSize() < NUM_BYTES_RFC4122_UUID) {
+                continue;
+            }
+            auto senderUUID = QUuid::fromRfc4122(QByteArray::fromRawData(nlPacket->getPayload(), NUM_BYTES_RFC4122_UUID));
+            Heartbeat heartbeat;
+            heartbeat.packet = std::move(nlPacket);
+            heartbeatShards[IcePeerTable::shardForID(senderUUID)].push_back(std::move(heartbeat));
+            ++numHeartbeats;
+        } else if (nlPacket->getType() == PacketType::ICEServerQuery) {
+            queries.push_back(std::move(nlPacket));
+        }
+    }
+
+    auto processShard = [this](std::vector<Heartbeat>& heartbeats) {
+        for (auto& heartbeat : heartbeats) {
+            processHeartbeat(heartbeat);
+        }
+    };
+    if (numHeartbeats >= MIN_PARALLEL_HEARTBEATS) {
+        QtConcurrent::blockingMap(heartbeatShards, processShard);
+    } else {
+        std::for_each(heartbeatShards.begin(), heartbeatShards.end(), processShard);
+    }
 
+    // the socket and the network access manager are only used from here, on the main thread
+    for (auto& heartbeats : heartbeatShards) {
+        for (auto& heartbeat : heartbeats) {
+            if (heartbeat.peer) {
                 // we have an active and verified heartbeating peer
                 // send them an ACK packet so they know that they are being heard and ready for ICE
                 static auto ackPacket = NLPacket::create(PacketType::ICEServerHeartbeatACK);
-                _serverSocket.writePacket(*ackPacket, nlPacket->getSenderSockAddr());
+                _serverSocket.writePacket(*ackPacket, heartbeat.packet->getSenderSockAddr());
             } else {
                 // we couldn't verify this peer - respond back to them so they know they may need to perform keypair re-generation
                 static auto deniedPacket = NLPacket::create(PacketType::ICEServerHeartbeatDenied);
-                _serverSocket.writePacket(*deniedPacket, nlPacket->getSenderSockAddr());
-            }
-        } else if (nlPacket->getType() == PacketType::ICEServerQuery) {
-            QDataStream heartbeatStream(nlPacket.get());
-            
-            // this is a node hoping to connect to a heartbeating peer - do we have the heartbeating peer?
-            QUuid senderUUID;
-            heartbeatStream >> senderUUID;
-            
-            // pull the public and private sock addrs for this peer
-            HifiSockAddr publicSocket, localSocket;
-            heartbeatStream >> publicSocket >> localSocket;
-            
-            // check if this node also included a UUID that they would like to connect to
-            QUuid connectRequestID;
-            heartbeatStream >> connectRequestID;
-            
-            SharedNetworkPeer matchingPeer = _activePeers.value(connectRequestID);
-            
-            if (matchingPeer) {
-                
-                qDebug() << "Sending information for peer" << connectRequestID << "to peer" << senderUUID;
-                
-                // we have the peer they want to connect to - send them pack the information for that peer
-                sendPeerInformationPacket(*matchingPeer, &nlPacket->getSenderSockAddr());
-                
-                // we also need to send them to the active peer they are hoping to connect to
-                // create a dummy peer object we can pass to sendPeerInformationPacket
-                
-                NetworkPeer dummyPeer(senderUUID, publicSocket, localSocket);
-                sendPeerInformationPacket(dummyPeer, matchingPeer->getActiveSocket());
-            } else {
-                qDebug() << "Peer" << senderUUID << "asked for" << connectRequestID << "but no matching peer found";
+                _serverSocket.writePacket(*deniedPacket, heartbeat.packet->getSenderSockAddr());
+
+                // ask the metaverse API for the right public key, unless we already are
+                if (heartbeat.verification == HeartbeatVerification::NeedsPublicKey &&
+                    !_pendingPublicKeyRequests.contains(heartbeat.domainID)) {
+                    requestDomainPublicKey(heartbeat.domainID);
+                }
             }
         }
     }
+
+    for (auto& query : queries) {
+        processQuery(*query);
+    }
+}
+
+void IceServer::processQuery(NLPacket& packet) {
+    QDataStream heartbeatStream(&packet);
+
+    // this is a node hoping to connect to a heartbeating peer - do we have the heartbeating peer?
+    QUuid senderUUID;
+    heartbeatStream >> senderUUID;
+
+    // pull the public and private sock addrs for this peer
+    HifiSockAddr publicSocket, localSocket;
+    heartbeatStream >> publicSocket >> localSocket;
+
+    // check if this node also included a UUID that they would like to connect to
+    QUuid connectRequestID;
+    heartbeatStream >> connectRequestID;
+
+    SharedNetworkPeer matchingPeer = _activePeers.find(connectRequestID);
+
+    if (matchingPeer) {
+
+        // one of these per query would flood the log under load
+        HIFI_FDEBUG("Sending information for peer" << connectRequestID << "to peer" << senderUUID);
+
+        // we have the peer they want to connect to - send them pack the information for that peer
+        sendPeerInformationPacket(*matchingPeer, &packet.getSenderSockAddr());
+
+        // we also need to send them to the active peer they are hoping to connect to
+        // create a dummy peer object we can pass to sendPeerInformationPacket
+
+        NetworkPeer dummyPeer(senderUUID, publicSocket, localSocket);
+        sendPeerInformationPacket(dummyPeer, matchingPeer->getActiveSocket());
+    } else {
+        HIFI_FDEBUG("Peer" << senderUUID << "asked for" << connectRequestID << "but no matching peer found");
+    }
 }
 
-SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
+void IceServer::processHeartbeat(Heartbeat& heartbeat) {
+    auto& packet = *heartbeat.packet;
 
     // pull the UUID, public and private sock addrs for this peer
     QUuid senderUUID;
@@ -137,72 +213,70 @@ SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
     auto signedPlaintext = QByteArray::fromRawData(packet.getPayload(), heartbeatStream.device()->pos());
     heartbeatStream >> signature;
 
-    // make sure this is a verified heartbeat before performing any more processing
-    if (isVerifiedHeartbeat(senderUUID, signedPlaintext, signature)) {
-        // make sure we have this sender in our peer hash
-        SharedNetworkPeer matchingPeer = _activePeers.value(senderUUID);
-
-        if (!matchingPeer) {
-            // if we don't have this sender we need to create them now
-            matchingPeer = QSharedPointer<NetworkPeer>::create(senderUUID, publicSocket, localSocket);
-            _activePeers.insert(senderUUID, matchingPeer);
+    heartbeat.domainID = senderUUID;
+    heartbeat.verification = verifyHeartbeat(senderUUID, signedPlaintext, signature);
 
-            qDebug() << "Added a new network peer" << *matchingPeer;
-        } else {
-            // we already had the peer so just potentially update their sockets
-            matchingPeer->setPublicSocket(publicSocket);
-            matchingPeer->setLocalSocket(localSocket);
+    // make sure this is a verified heartbeat before performing any more processing
+    if (heartbeat.verification == HeartbeatVerification::Verified) {
+        // make sure we have this sender in our peer table
+        bool isNewPeer = !_activePeers.find(senderUUID);
+        heartbeat.peer = _activePeers.addOrUpdate(senderUUID, publicSocket, localSocket, usecTimestampNow());
+        _activePeers.setVerifiedHeartbeat(senderUUID, signedPlaintext, signature);
+
+        if (isNewPeer) {
+            qDebug() << "Added a new network peer" << *heartbeat.peer;
         }
 
-        // update our last heard microstamp for this network peer to now
-        matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
-        
-        return matchingPeer;
-    } else {
-        // not verified, return the empty peer object
-        return SharedNetworkPeer();
+        // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
+        heartbeat.peer->activateMatchingOrNewSymmetricSocket(packet.getSenderSockAddr());
     }
 }
 
-bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature) {
+IceServer::HeartbeatVerification IceServer::verifyHeartbeat(const QUuid& domainID, const QByteArray& plaintext,
+                                                            const QByteArray& signature) {
     // make sure we're not already waiting for a public key for this domain-server
-    if (!_pendingPublicKeyRequests.contains(domainID)) {
-        // check if we have a public key for this domain ID - if we do not then fire off the request for it
-        auto it = _domainPublicKeys.find(domainID);
-        if (it != _domainPublicKeys.end()) {
-
-            // attempt to verify the signature for this heartbeat
-            const auto rsaPublicKey = it->second.get();
-
-            if (rsaPublicKey) {
-                auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
-                int verificationResult = RSA_verify(NID_sha256,
-                                                    reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
-                                                    hashedPlaintext.size(),
-                                                    reinterpret_cast<const unsigned char*>(signature.constData()),
-                                                    signature.size(),
-                                                    rsaPublicKey);
-
-                if (verificationResult == 1) {
-                    // this is the only success case - we return true here to indicate that the heartbeat is verified
-                    return true;
-                } else {
-                    qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
-                }
+    if (_pendingPublicKeyRequests.contains(domainID)) {
+        return HeartbeatVerification::Denied;
+    }
+
+    // the same signed heartbeat as the last one we verified needs no more RSA
+    if (_activePeers.isVerifiedHeartbeat(domainID, plaintext, signature)) {
+        return HeartbeatVerification::Verified;
+    }
 
+    // check if we have a public key for this domain ID - if we do not then it needs requesting
+    auto it = _domainPublicKeys.find(domainID);
+    if (it != _domainPublicKeys.end()) {
+
+        // attempt to verify the signature for this heartbeat
+        const auto rsaPublicKey = it->second.get();
+
+        if (rsaPublicKey) {
+            auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
+            int verificationResult = RSA_verify(NID_sha256,
+                                                reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
+                                                hashedPlaintext.size(),
+                                                reinterpret_cast<const unsigned char*>(signature.constData()),
+                                                signature.size(),
+                                                rsaPublicKey);
+
+            if (verificationResult == 1) {
+                // this is the only success case - we return Verified here to indicate that the heartbeat is verified
+                return HeartbeatVerification::Verified;
             } else {
-                // we can't let this user in since we couldn't convert their public key to an RSA key we could use
-                qWarning() << "Public key for" << domainID << "is not a usable RSA* public key.";
-                qWarning() << "Re-requesting public key from API";
+                qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
             }
-        }
 
-        // we could not verify this heartbeat (missing public key, could not load public key, bad actor)
-        // ask the metaverse API for the right public key and return false to indicate that this is not verified
-        requestDomainPublicKey(domainID);
+        } else {
+            // we can't let this user in since we couldn't convert their public key to an RSA key we could use
+            qWarning() << "Public key for" << domainID << "is not a usable RSA* public key.";
+            qWarning() << "Re-requesting public key from API";
+        }
     }
 
-    return false;
+    // we could not verify this heartbeat (missing public key, could not load public key, bad actor)
+    // the metaverse API gets asked for the right public key once we're back on the main thread
+    return HeartbeatVerification::NeedsPublicKey;
 }
 
 void IceServer::requestDomainPublicKey(const QUuid& domainID) {
@@ -222,6 +296,9 @@ void IceServer::requestDomainPublicKey(const QUuid& domainID) {
     // add this to the set of pending public key requests
     _pendingPublicKeyRequests.insert(domainID);
 
+    // the key we have is in doubt, so stop trusting what was verified with it
+    _activePeers.clearVerifiedHeartbeat(domainID);
+
     networkAccessManager.get(publicKeyRequest);
 }
 
@@ -255,6 +332,8 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
 
                 if (rsaPublicKey) {
                     _domainPublicKeys[domainID] = { rsaPublicKey, RSA_free };
+                    // a heartbeat verified with the key this replaces proves nothing about the new one
+                    _activePeers.clearVerifiedHeartbeat(domainID);
                 } else {
                     qWarning() << "Could not convert in-memory public key for" << domainID << "to usable RSA public key.";
                     qWarning() << "Public key will be re-requested on next heartbeat.";
@@ -280,6 +359,36 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
     reply->deleteLater();
 }
 
+void IceServer::loadTestDomainPublicKeys(const QString& path) {
+    QFile keysFile { path };
+    if (!keysFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Could not open test domain keys file" << path;
+        return;
+    }
+
+    while (!keysFile.atEnd()) {
+        auto fields = keysFile.readLine().trimmed().split(' ');
+        if (fields.size() < 2) {
+            continue;
+        }
+
+        QUuid domainID { QString::fromLatin1(fields[0]) };
+        auto publicKey = QByteArray::fromBase64(fields[1]);
+        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKey.constData());
+
+        // keys from RSAKeypairGenerator are PKCS#1, not the X.509 SubjectPublicKeyInfo the API serves
+        RSA* rsaPublicKey = d2i_RSAPublicKey(NULL, &publicKeyData, publicKey.size());
+        if (!domainID.isNull() && rsaPublicKey) {
+            _domainPublicKeys[domainID] = { rsaPublicKey, RSA_free };
+            _testDomainIDs.insert(domainID);
+        } else if (rsaPublicKey) {
+            RSA_free(rsaPublicKey);
+        }
+    }
+
+    qWarning() << "Trusting" << _testDomainIDs.size() << "test domain public keys from" << path;
+}
+
 void IceServer::sendPeerInformationPacket(const NetworkPeer& peer, const HifiSockAddr* destinationSockAddr) {
     auto peerPacket = NLPacket::create(PacketType::ICEServerPeerInformation);
 
@@ -291,22 +400,12 @@ void IceServer::sendPeerInformationPacket(const NetworkPeer& peer, const HifiSoc
 }
 
 void IceServer::clearInactivePeers() {
-    NetworkPeerHash::iterator peerItem = _activePeers.begin();
+    for (const auto& peer : _activePeers.removeInactivePeers(usecTimestampNow())) {
+        qDebug() << "Removing peer from memory for inactivity -" << *peer;
 
-    while (peerItem != _activePeers.end()) {
-        SharedNetworkPeer peer = peerItem.value();
-
-        if ((usecTimestampNow() - peer->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
-            qDebug() << "Removing peer from memory for inactivity -" << *peer;
-
-            // if we had a public key for this domain, remove it now
+        // if we had a public key for this domain, remove it now
+        if (!_testDomainIDs.contains(peer->getUUID())) {
             _domainPublicKeys.erase(peer->getUUID());
-
-            // remove the peer object
-            peerItem = _activePeers.erase(peerItem);
-        } else {
-            // we didn't kill this peer, push the iterator forwards
-            ++peerItem;
         }
     }
 }
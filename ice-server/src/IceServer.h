@@ -12,6 +12,8 @@
 #ifndef hifi_IceServer_h
 #define hifi_IceServer_h
 
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QSharedPointer>
 #include <QUdpSocket>
@@ -26,6 +28,8 @@
 #include <NLPacket.h>
 #include <udt/Socket.h>
 
+#include "IcePeerTable.h"
+
 class QNetworkReply;
 
 class IceServer : public QCoreApplication {
@@ -35,25 +39,49 @@ public:
 private slots:
     void clearInactivePeers();
     void publicKeyReplyFinished(QNetworkReply* reply);
+    void processPendingPackets();
 private:
+    enum class HeartbeatVerification {
+        Verified,
+        Denied,
+        NeedsPublicKey
+    };
+
+    struct Heartbeat {
+        std::unique_ptr<NLPacket> packet;
+        SharedNetworkPeer peer;
+        HeartbeatVerification verification { HeartbeatVerification::Denied };
+        QUuid domainID;
+    };
+
     bool packetVersionMatch(const udt::Packet& packet);
     void processPacket(std::unique_ptr<udt::Packet> packet);
-    
-    SharedNetworkPeer addOrUpdateHeartbeatingPeer(NLPacket& incomingPacket);
+    void processQuery(NLPacket& packet);
+
+    // safe to call from the worker threads, as long as the main thread is waiting on them
+    void processHeartbeat(Heartbeat& heartbeat);
     void sendPeerInformationPacket(const NetworkPeer& peer, const HifiSockAddr* destinationSockAddr);
 
-    bool isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature);
+    HeartbeatVerification verifyHeartbeat(const QUuid& domainID, const QByteArray& plaintext,
+                                          const QByteArray& signature);
     void requestDomainPublicKey(const QUuid& domainID);
 
+    // test hook for stress runs with made up domains the metaverse API has never heard of
+    void loadTestDomainPublicKeys(const QString& path);
+
     QUuid _id;
     udt::Socket _serverSocket;
 
-    using NetworkPeerHash = QHash<QUuid, SharedNetworkPeer>;
-    NetworkPeerHash _activePeers;
+    // packets read off the socket since the last batch was processed
+    std::vector<std::unique_ptr<NLPacket>> _pendingPackets;
+
+    IcePeerTable _activePeers;
 
     using RSAUniquePtr = std::unique_ptr<RSA, std::function<void(RSA*)>>;
     using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
     DomainPublicKeyHash _domainPublicKeys;
+    // domains whose keys came from the test hook, kept when they go quiet since the API can't give them back
+    QSet<QUuid> _testDomainIDs;
 
     QSet<QUuid> _pendingPublicKeyRequests;
 };
@@ -313,6 +313,10 @@ Item {
                         visible: root.expanded;
                         text: "  External Memory: " + root.gpuTextureExternalMemory + " MB";
                     }
+                    StatText {
+                        visible: root.expanded;
+                        text: "  Streamed Last Frame: " + root.gpuTextureStreamedMemory + " KB";
+                    }
                     StatText {
                         visible: root.expanded;
                         text: "GPU Buffers: "
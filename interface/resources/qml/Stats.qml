@@ -131,6 +131,30 @@ Item {
                         visible: root.expanded
                         text: "Avatars NOT Updated: " + root.notUpdatedAvatarCount
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatars Simulated: " + root.simulatedAvatarCount
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Anim LOD Full/Reduced/Minimal: " + root.fullAnimationLODAvatarCount + "/" +
+                                    root.reducedAnimationLODAvatarCount + "/" + root.minimalAnimationLODAvatarCount
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Sim Sort/Joints/Skin: " + root.avatarSortTime.toFixed(2) + "/" +
+                                    root.avatarJointsTime.toFixed(2) + "/" + root.avatarSkinningTime.toFixed(2) + " ms"
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "Physics Active/Sleeping: " + root.activePhysicsObjectCount + "/" +
+                                    root.sleepingPhysicsObjectCount + " (harvest " + root.physicsHarvestTime.toFixed(2) + " ms)"
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "Blendshapes: " + root.blendRate.toFixed(1) + "/s, " + root.blendTime.toFixed(2) +
+                                    " ms each, " + root.queuedBlendCount + " queued"
+                    }
                     StatText {
                         visible: root.expanded
                         text: "Total picks:\n    " +
@@ -393,6 +417,10 @@ Item {
                         visible: root.expanded;
                         text: "  External Memory: " + root.gpuTextureExternalMemory + " MB";
                     }
+                    StatText {
+                        visible: root.expanded;
+                        text: "  Streamed Last Frame: " + root.gpuTextureStreamedMemory + " KB";
+                    }
                     StatText {
                         visible: root.expanded;
                         text: "GPU Buffers: "
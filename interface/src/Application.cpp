@@ -6566,6 +6566,7 @@ void Application::update(float deltaTime) {
                         getEntities()->getTree()->withWriteLock([&] {
                             PROFILE_RANGE(simulation_physics, "HandleChanges");
                             PerformanceTimer perfTimer("handleChanges");
+                            quint64 harvestStart = usecTimestampNow();
 
                             const VectorOfMotionStates& outgoingChanges = _physicsEngine->getChangedMotionStates();
                             _entitySimulation->handleChangedMotionStates(outgoingChanges);
@@ -6573,6 +6574,7 @@ void Application::update(float deltaTime) {
 
                             const VectorOfMotionStates& deactivations = _physicsEngine->getDeactivatedMotionStates();
                             _entitySimulation->handleDeactivatedMotionStates(deactivations);
+                            _physicsHarvestTime = (float)(usecTimestampNow() - harvestStart) / (float)USECS_PER_MSEC;
                         });
 
                         // handleCollisionEvents() AFTER handleChangedMotionStates()
@@ -7090,6 +7092,14 @@ float Application::getNumCollisionObjects() const {
     return _physicsEngine ? _physicsEngine->getNumCollisionObjects() : 0;
 }
 
+int Application::getNumActivePhysicsObjects() const {
+    return _physicsEngine ? _physicsEngine->getNumActiveBodies() : 0;
+}
+
+int Application::getNumSleepingPhysicsObjects() const {
+    return _physicsEngine ? _physicsEngine->getNumSleepingBodies() : 0;
+}
+
 float Application::getTargetRenderFrameRate() const { return getActiveDisplayPlugin()->getTargetFrameRate(); }
 
 QRect Application::getDesirableApplicationGeometry() const {
@@ -202,6 +202,9 @@ public:
     size_t getRenderFrameCount() const { return _graphicsEngine.getRenderFrameCount(); }
     float getRenderLoopRate() const { return _graphicsEngine.getRenderLoopRate(); }
     float getNumCollisionObjects() const;
+    int getNumActivePhysicsObjects() const;
+    int getNumSleepingPhysicsObjects() const;
+    float getPhysicsHarvestTime() const { return _physicsHarvestTime; } // ms
     float getTargetRenderFrameRate() const;  // frames/second
 
     static void setupQmlSurface(QQmlContext* surfaceContext, bool setAdditionalContextProperties);
@@ -780,6 +783,7 @@ private:
     bool _isForeground = true;  // starts out assumed to be in foreground
     bool _isGLInitialized{ false };
     bool _physicsEnabled{ false };
+    float _physicsHarvestTime { 0.0f };
     bool _failedToConnectToEntityServer{ false };
 
     bool _reticleClickPressed{ false };
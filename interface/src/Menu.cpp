@@ -563,6 +563,15 @@ Menu::Menu() {
     addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::ComputeBlendshapes, 0, true,
         DependencyManager::get<ModelBlender>().data(), SLOT(setComputeBlendshapes(bool)));
 
+    // Developer > Render > Instance Model Meshes
+    {
+        auto action = addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::InstanceModelMeshes, 0,
+                                                             MeshPartPayload::enableInstancing);
+        connect(action, &QAction::triggered, [](bool checked) {
+            MeshPartPayload::enableInstancing = checked;
+        });
+    }
+
     {
         auto drawStatusConfig = qApp->getRenderEngine()->getConfiguration()->getConfig<render::DrawStatus>("RenderMainView.DrawStatus");
         addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::HighlightTransitions, 0, false,
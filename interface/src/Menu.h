@@ -230,6 +230,7 @@ namespace MenuOption {
     const QString NotificationSoundsTablet = "play_notification_sounds_tablet";
     const QString ForceCoarsePicking = "Force Coarse Picking";
     const QString ComputeBlendshapes = "Compute Blendshapes";
+    const QString InstanceModelMeshes = "Instance Model Meshes";
     const QString HighlightTransitions = "Highlight Transitions";
     //const QString CustomShaders = "Enable Custom Shaders";
     const QString MaterialProceduralShaders = "Custom Shaders on Models";
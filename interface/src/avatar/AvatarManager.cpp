@@ -11,9 +11,12 @@
 
 #include "AvatarManager.h"
 
+#include <algorithm>
+#include <array>
 #include <string>
 
 #include <QScriptEngine>
+#include <QThread>
 
 #include "AvatarLogging.h"
 
@@ -35,6 +38,7 @@
 #include <RegisteredMetaTypes.h>
 #include <Rig.h>
 #include <SettingHandle.h>
+#include <TBBHelpers.h>
 #include <UsersScriptingInterface.h>
 #include <UUID.h>
 #include <shared/ConicalViewFrustum.h>
@@ -55,6 +59,32 @@
 // We add _myAvatar into the hash with all the other AvatarData, and we use the default NULL QUid as the key.
 const QUuid MY_AVATAR_KEY;  // NULL key
 
+// number of avatars per worker thread whose joints are decoded together before the budget is checked again
+const size_t AVATAR_SIMULATION_BATCH_PER_THREAD = 2;
+
+// angular sizes (bounding radius over distance to the nearest view) below which an avatar's joints are updated less often
+const float FULL_ANIMATION_LOD_MIN_ANGULAR_SIZE = 0.05f;
+const float REDUCED_ANIMATION_LOD_MIN_ANGULAR_SIZE = 0.02f;
+
+static OtherAvatar::AnimationLOD computeAnimationLOD(const ConicalViewFrustums& views, const OtherAvatarPointer& avatar) {
+    if (avatar->getHasPriority()) {
+        return OtherAvatar::AnimationLOD::Full;
+    }
+    glm::vec3 position = avatar->getWorldPosition();
+    float radius = avatar->getBoundingRadius();
+    float angularSize = 0.0f;
+    for (const auto& view : views) {
+        float distance = glm::distance(position, view.getPosition()) + 0.001f;
+        angularSize = std::max(angularSize, radius / distance);
+    }
+    if (angularSize >= FULL_ANIMATION_LOD_MIN_ANGULAR_SIZE) {
+        return OtherAvatar::AnimationLOD::Full;
+    } else if (angularSize >= REDUCED_ANIMATION_LOD_MIN_ANGULAR_SIZE) {
+        return OtherAvatar::AnimationLOD::Reduced;
+    }
+    return OtherAvatar::AnimationLOD::Minimal;
+}
+
 AvatarManager::AvatarManager(QObject* parent) :
     _myAvatar(new MyAvatar(qApp->thread()), [](MyAvatar* ptr) { ptr->deleteLater(); })
 {
@@ -288,103 +318,137 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
     const uint64_t MAX_UPDATE_HEROS_TIME_BUDGET = uint64_t(0.8 * MAX_UPDATE_AVATARS_TIME_BUDGET);
 
+    // Avatars are simulated in batches: the joint decoding of a whole batch is spread across the worker threads,
+    // then the rest of each avatar's update runs in order on this thread since it touches the scene, physics and MyAvatar.
+    // The time budget is checked between batches.
+    const size_t SIMULATION_BATCH_SIZE = AVATAR_SIMULATION_BATCH_PER_THREAD * (size_t)std::max(QThread::idealThreadCount(), 1);
+
     uint64_t updatePriorityExpiries[NumVariants] = { startTime + MAX_UPDATE_HEROS_TIME_BUDGET, startTime + MAX_UPDATE_AVATARS_TIME_BUDGET };
     int numHerosUpdated = 0;
     int numAvatarsUpdated = 0;
     int numAvatarsNotUpdated = 0;
+    uint64_t sortTime = 0;
+    uint64_t jointsTime = 0;
 
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
+    std::vector<OtherAvatarPointer> simulatedAvatars;
+    std::array<int, (size_t)OtherAvatar::AnimationLOD::NumLODs> numAvatarsPerAnimationLOD {};
 
     for (int p = kHero; p < NumVariants; p++) {
         auto& priorityQueue = avatarPriorityQueues[p];
         // Sorting the current queue HERE as part of the measured timing.
+        uint64_t sortStart = usecTimestampNow();
         const auto& sortedAvatarVector = priorityQueue.getSortedVector();
+        sortTime += usecTimestampNow() - sortStart;
 
         auto passExpiry = updatePriorityExpiries[p];
 
-        for (auto it = sortedAvatarVector.begin(); it != sortedAvatarVector.end(); ++it) {
-            const SortableAvatar& sortData = *it;
-            const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
-            if (!avatar->_isClientAvatar) {
-                avatar->setIsClientAvatar(true);
-            }
+        size_t batchStart = 0;
+        while (batchStart < sortedAvatarVector.size()) {
+            if (usecTimestampNow() >= passExpiry) {
+                // we've spent our time budget for this priority bucket
+                // let's deal with the reminding avatars if this pass and BREAK from the loop
 
-            if (_useAvatarPlaceholders) avatar->updateOrbPosition();
-            // TODO: to help us scale to more avatars it would be nice to not have to poll this stuff every update
-            if (avatar->getSkeletonModel()->isLoaded()) {
-                // hide the orb if it is there
-                if (!_useAvatarPlaceholders) avatar->setOrbVisible(false);
-                else avatar->setOrbVisible(true);
+                if (p == kHero) {
+                    // Hero,
+                    // --> put them back in the non hero queue
 
-                if (avatar->needsPhysicsUpdate()) {
-                    _otherAvatarsToChangeInPhysics.insert(avatar);
+                    auto& crowdQueue = avatarPriorityQueues[kNonHero];
+                    for (size_t i = batchStart; i < sortedAvatarVector.size(); ++i) {
+                        crowdQueue.push(SortableAvatar(sortedAvatarVector[i].getAvatar()));
+                    }
+                } else {
+                    // Non Hero
+                    // --> bail on the rest of the avatar updates
+                    // --> more avatars may freeze until their priority trickles up
+                    // --> some scale animations may glitch
+                    // --> some avatar velocity measurements may be a little off
+
+                    // no time to simulate, but we take the time to count how many were tragically missed
+                    numAvatarsNotUpdated = (int)(sortedAvatarVector.size() - batchStart);
                 }
-            } 
-            /*else {
-                avatar->updateOrbPosition();
-            }*/
-
-            // for ALL avatars...
-            if (_shouldRender) {
-                avatar->ensureInScene(avatar, qApp->getMain3DScene());
+
+                // We had to cut short this pass, we must break out of the loop here
+                break;
             }
 
-            avatar->animateScaleChanges(deltaTime);
+            size_t batchEnd = std::min(batchStart + SIMULATION_BATCH_SIZE, sortedAvatarVector.size());
 
-            uint64_t now = usecTimestampNow();
-            if (now < passExpiry) {
-                // we're within budget
-                bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
-                if (inView && avatar->hasNewJointData()) {
-                    numAvatarsUpdated++;
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                const SortableAvatar& sortData = sortedAvatarVector[i];
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+                if (!avatar->_isClientAvatar) {
+                    avatar->setIsClientAvatar(true);
                 }
+
+                if (_useAvatarPlaceholders) avatar->updateOrbPosition();
+                // TODO: to help us scale to more avatars it would be nice to not have to poll this stuff every update
+                if (avatar->getSkeletonModel()->isLoaded()) {
+                    // hide the orb if it is there
+                    if (!_useAvatarPlaceholders) avatar->setOrbVisible(false);
+                    else avatar->setOrbVisible(true);
+
+                    if (avatar->needsPhysicsUpdate()) {
+                        _otherAvatarsToChangeInPhysics.insert(avatar);
+                    }
+                }
+
+                // for ALL avatars...
+                if (_shouldRender) {
+                    avatar->ensureInScene(avatar, qApp->getMain3DScene());
+                }
+
+                avatar->animateScaleChanges(deltaTime);
+                avatar->setAnimationLOD(computeAnimationLOD(views, avatar));
+
                 auto transitStatus = avatar->_transit.update(deltaTime, avatar->_serverPosition, _transitConfig);
                 if (avatar->getIsNewAvatar() && (transitStatus == AvatarTransit::Status::START_TRANSIT ||
                                                  transitStatus == AvatarTransit::Status::ABORT_TRANSIT)) {
                     avatar->_transit.reset();
                     avatar->setIsNewAvatar(false);
                 }
+            }
+
+            uint64_t jointsStart = usecTimestampNow();
+            tbb::parallel_for(tbb::blocked_range<size_t>(batchStart, batchEnd), [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const SortableAvatar& sortData = sortedAvatarVector[i];
+                    const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+                    avatar->prepareJoints(sortData.getPriority() > OUT_OF_VIEW_THRESHOLD);
+                }
+            });
+            jointsTime += usecTimestampNow() - jointsStart;
+
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                const SortableAvatar& sortData = sortedAvatarVector[i];
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+
+                bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
+                // skipped and interpolated frames of a reduced animation LOD don't count as updates
+                if (avatar->_newJointPosesTaken) {
+                    numAvatarsUpdated++;
+                }
+                // faces of the avatars in view get blended first
+                avatar->getSkeletonModel()->setBlendPriority(sortData.getPriority());
                 avatar->simulate(deltaTime, inView);
-                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
+                // only avatars close enough to be animated every frame are worth colliding with MyAvatar's flow
+                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1 &&
+                    avatar->getAnimationLOD() == OtherAvatar::AnimationLOD::Full) {
                     _myAvatar->addAvatarHandsToFlow(avatar);
                 }
                 if (_drawOtherAvatarSkeletons) {
                     avatar->debugJointData();
                 }
                 avatar->setEnableMeshVisible(!_useAvatarPlaceholders);//!_drawOtherAvatarSkeletons);
-                //avatar->updateOrbPosition();
                 avatar->updateRenderItem(renderTransaction);
                 avatar->updateSpaceProxy(workloadTransaction);
                 avatar->setLastRenderUpdateTime(startTime);
-
-            } else {
-                // we've spent our time budget for this priority bucket
-                // let's deal with the reminding avatars if this pass and BREAK from the for loop
-
-                if (p == kHero) {
-                    // Hero,
-                    // --> put them back in the non hero queue
-
-                    auto& crowdQueue = avatarPriorityQueues[kNonHero];
-                    while (it != sortedAvatarVector.end()) {
-                        crowdQueue.push(SortableAvatar((*it).getAvatar()));
-                        ++it;
-                    }
-                } else {
-                    // Non Hero
-                    // --> bail on the rest of the avatar updates
-                    // --> more avatars may freeze until their priority trickles up
-                    // --> some scale animations may glitch
-                    // --> some avatar velocity measurements may be a little off
-
-                    // no time to simulate, but we take the time to count how many were tragically missed
-                    numAvatarsNotUpdated = sortedAvatarVector.end() - it;
-                }
-
-                // We had to cut short this pass, we must break out of the for loop here
-                break;
+                simulatedAvatars.push_back(avatar);
+                numAvatarsPerAnimationLOD[(size_t)avatar->getAnimationLOD()]++;
             }
+
+            batchStart = batchEnd;
         }
 
         if (p == kHero) {
@@ -392,17 +456,32 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         }
     }
 
+    // The cluster matrices would otherwise be computed one model at a time in the post-update lambdas,
+    // which then find them up to date.
+    uint64_t skinningStart = usecTimestampNow();
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, simulatedAvatars.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            simulatedAvatars[i]->getSkeletonModel()->updateClusterMatrices();
+        }
+    });
+    uint64_t skinningTime = usecTimestampNow() - skinningStart;
+
     if (_shouldRender) {
         qApp->getMain3DScene()->enqueueTransaction(renderTransaction);
     }
 
     _space->enqueueTransaction(workloadTransaction);
 
+    _numAvatarsSimulated = (int)simulatedAvatars.size();
+    _numAvatarsPerAnimationLOD = numAvatarsPerAnimationLOD;
     _numAvatarsUpdated = numAvatarsUpdated;
     _numAvatarsNotUpdated = numAvatarsNotUpdated;
     _numHeroAvatarsUpdated = numHerosUpdated;
 
     _avatarSimulationTime = (float)(usecTimestampNow() - startTime) / (float)USECS_PER_MSEC;
+    _avatarSortTime = (float)sortTime / (float)USECS_PER_MSEC;
+    _avatarJointsTime = (float)jointsTime / (float)USECS_PER_MSEC;
+    _avatarSkinningTime = (float)skinningTime / (float)USECS_PER_MSEC;
 }
 
 void AvatarManager::postUpdate(float deltaTime, const render::ScenePointer& scene) {
@@ -12,6 +12,7 @@
 #ifndef hifi_AvatarManager_h
 #define hifi_AvatarManager_h
 
+#include <array>
 #include <set>
 
 #include <QtCore/QHash>
@@ -113,11 +114,16 @@ public:
 
     AvatarSharedPointer getAvatarBySessionID(const QUuid& sessionID) const override;
 
+    int getNumAvatarsSimulated() const { return _numAvatarsSimulated; }
+    int getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD lod) const { return _numAvatarsPerAnimationLOD[(size_t)lod]; }
     int getNumAvatarsUpdated() const { return _numAvatarsUpdated; }
     int getNumAvatarsNotUpdated() const { return _numAvatarsNotUpdated; }
     int getNumHeroAvatars() const { return _numHeroAvatars; }
     int getNumHeroAvatarsUpdated() const { return _numHeroAvatarsUpdated; }
     float getAvatarSimulationTime() const { return _avatarSimulationTime; }
+    float getAvatarSortTime() const { return _avatarSortTime; }
+    float getAvatarJointsTime() const { return _avatarJointsTime; }
+    float getAvatarSkinningTime() const { return _avatarSkinningTime; }
 
     void updateMyAvatar(float deltaTime);
     void updateOtherAvatars(float deltaTime);
@@ -309,11 +315,16 @@ private:
     std::list<QWeakPointer<AudioInjector>> _collisionInjectors;
 
     RateCounter<> _myAvatarSendRate;
+    int _numAvatarsSimulated { 0 };
+    std::array<int, (size_t)OtherAvatar::AnimationLOD::NumLODs> _numAvatarsPerAnimationLOD {};
     int _numAvatarsUpdated { 0 };
     int _numAvatarsNotUpdated { 0 };
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
+    float _avatarSortTime { 0.0f };
+    float _avatarJointsTime { 0.0f };
+    float _avatarSkinningTime { 0.0f };
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
 
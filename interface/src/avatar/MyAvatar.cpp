@@ -221,6 +221,8 @@ MyAvatar::MyAvatar(QThread* thread) :
 
     _skeletonModel = std::make_shared<MySkeletonModel>(this, nullptr);
     _skeletonModel->setLoadingPriority(MYAVATAR_LOADING_PRIORITY);
+    // our own face is always the first one blended
+    _skeletonModel->setBlendPriority(std::numeric_limits<float>::max());
     connect(_skeletonModel.get(), &Model::setURLFinished, this, &Avatar::setModelURLFinished);
     connect(_skeletonModel.get(), &Model::setURLFinished, this, [this](bool success) {
         if (success) {
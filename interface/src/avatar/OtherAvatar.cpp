@@ -264,6 +264,72 @@ void OtherAvatar::setCollisionWithOtherAvatarsFlags() {
     }
 }
 
+void OtherAvatar::setAnimationLOD(AnimationLOD lod) {
+    if (lod != _animationLOD) {
+        _animationLOD = lod;
+        _animationLODPhase = qHash(getSessionUUID());
+    }
+}
+
+uint32_t OtherAvatar::getJointUpdateInterval() const {
+    return _transit.isActive() ? 1 : 1 << (uint32_t)_animationLOD;
+}
+
+bool OtherAvatar::isJointUpdateDue() const {
+    uint32_t interval = getJointUpdateInterval();
+    return ((_animationFrame + _animationLODPhase) & (interval - 1)) == 0;
+}
+
+void OtherAvatar::prepareJoints(bool inView) {
+    PROFILE_RANGE(simulation, "prepareJoints");
+    if (!inView) {
+        return;
+    }
+
+    uint32_t interval = getJointUpdateInterval();
+    if ((_hasNewJointData || _transit.isActive()) && isJointUpdateDue()) {
+        // the pose on screen is the latest one once the previous blend has finished, so start the next blend from it
+        _previousJointPoses = _latestJointPoses.size() == _jointData.size() ? _latestJointPoses : _jointData;
+        _latestJointPoses = _jointData;
+        _jointPoseBlendFrame = 0;
+        _newJointPosesTaken = true;
+    }
+    if (_jointPoseBlendFrame >= interval || _latestJointPoses.isEmpty()) {
+        return;
+    }
+
+    // Between updates of a reduced LOD avatar, blend from its previous pose to the latest one rather than holding
+    // the pose and then jumping.  At full LOD the interval is 1 and the latest pose is applied straight away.
+    _jointPoseBlendFrame++;
+    if (_jointPoseBlendFrame >= interval) {
+        _skeletonModel->getRig().copyJointsFromJointData(_latestJointPoses);
+    } else {
+        float alpha = (float)_jointPoseBlendFrame / (float)interval;
+        _blendedJointPoses.resize(_latestJointPoses.size());
+        for (int i = 0; i < _latestJointPoses.size(); i++) {
+            const JointData& previous = _previousJointPoses.at(i);
+            const JointData& latest = _latestJointPoses.at(i);
+            JointData& blended = _blendedJointPoses[i];
+            blended.rotationIsDefaultPose = previous.rotationIsDefaultPose && latest.rotationIsDefaultPose;
+            blended.translationIsDefaultPose = previous.translationIsDefaultPose && latest.translationIsDefaultPose;
+            if (previous.rotationIsDefaultPose || latest.rotationIsDefaultPose) {
+                blended.rotation = latest.rotation;
+            } else {
+                blended.rotation = safeMix(previous.rotation, latest.rotation, alpha);
+            }
+            if (previous.translationIsDefaultPose || latest.translationIsDefaultPose) {
+                blended.translation = latest.translation;
+            } else {
+                blended.translation = glm::mix(previous.translation, latest.translation, alpha);
+            }
+        }
+        _skeletonModel->getRig().copyJointsFromJointData(_blendedJointPoses);
+    }
+    glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+    _skeletonModel->getRig().computeExternalPoses(rootTransform);
+    _jointsPrepared = true;
+}
+
 void OtherAvatar::simulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
@@ -282,17 +348,19 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         PROFILE_RANGE(simulation, "updateJoints");
         if (inView) {
             Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
-                _jointDataSimulationRate.increment();
+            if (!_jointsPrepared) {
+                prepareJoints(inView);
+            }
+            if (_jointsPrepared) {
+                if (_newJointPosesTaken) {
+                    _jointDataSimulationRate.increment();
+                    _hasNewJointData = false;
+                }
 
                 head->simulate(deltaTime);
                 _skeletonModel->simulate(deltaTime, true);
 
                 locationChanged(); // joints changed, so if there are any children, update them.
-                _hasNewJointData = false;
 
                 glm::vec3 headPosition = getWorldPosition();
                 if (!_skeletonModel->getHeadPosition(headPosition)) {
@@ -310,6 +378,9 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
             _skeletonModel->simulate(deltaTime, false);
         }
         _skeletonModelSimulationRate.increment();
+        _jointsPrepared = false;
+        _newJointPosesTaken = false;
+        _animationFrame++;
     }
 
     // update animation for display name fade in/out
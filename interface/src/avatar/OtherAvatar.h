@@ -32,6 +32,15 @@ public:
         MultiSphereHigh // All joints
     };
 
+    // How often the joint data received for this avatar is applied to its rig.  Small on-screen avatars are
+    // updated every few frames, staggered so that they don't all land on the same frame.
+    enum class AnimationLOD : uint8_t {
+        Full = 0, // every frame
+        Reduced,  // every 2nd frame
+        Minimal,  // every 4th frame
+        NumLODs
+    };
+
     virtual void instantiableAvatar() override { };
     virtual void createOrb() override;
     virtual void indicateLoadingStatus(LoadingStatus loadingStatus) override;
@@ -64,11 +73,19 @@ public:
 
     void setCollisionWithOtherAvatarsFlags() override;
 
+    // Decodes the received joint data into the rig and rebuilds its poses, blending between the last two received
+    // poses on the frames a reduced animation LOD skips.  Only touches this avatar's own state, so AvatarManager
+    // runs it for many avatars in parallel before calling simulate() on the main thread.
+    void prepareJoints(bool inView);
+    void setAnimationLOD(AnimationLOD lod);
+    AnimationLOD getAnimationLOD() const { return _animationLOD; }
     void simulate(float deltaTime, bool inView) override;
     void debugJointData() const;
     friend AvatarManager;
 
 protected:
+    uint32_t getJointUpdateInterval() const;
+    bool isJointUpdateDue() const;
     void handleChangedAvatarEntityData();
     void updateAttachedAvatarEntities();
     void onAddAttachedAvatarEntity(const QUuid& id);
@@ -92,6 +109,15 @@ protected:
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
+    bool _jointsPrepared { false };
+    AnimationLOD _animationLOD { AnimationLOD::Full };
+    uint32_t _animationLODPhase { 0 };
+    uint32_t _animationFrame { 0 };
+    QVector<JointData> _previousJointPoses;
+    QVector<JointData> _latestJointPoses;
+    QVector<JointData> _blendedJointPoses;
+    uint32_t _jointPoseBlendFrame { 0 };
+    bool _newJointPosesTaken { false };
 };
 
 using OtherAvatarPointer = std::shared_ptr<OtherAvatar>;
@@ -23,6 +23,7 @@
 #include <AudioClient.h>
 #include <GeometryCache.h>
 #include <LODManager.h>
+#include <Model.h>
 #include <OffscreenUi.h>
 #include <PerfStat.h>
 #include <plugins/DisplayPlugin.h>
@@ -128,9 +129,15 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(avatarCount, avatarManager->size() - 1);
     STAT_UPDATE(heroAvatarCount, avatarManager->getNumHeroAvatars());
     STAT_UPDATE(physicsObjectCount, qApp->getNumCollisionObjects());
+    STAT_UPDATE(activePhysicsObjectCount, qApp->getNumActivePhysicsObjects());
+    STAT_UPDATE(sleepingPhysicsObjectCount, qApp->getNumSleepingPhysicsObjects());
     STAT_UPDATE(updatedAvatarCount, avatarManager->getNumAvatarsUpdated());
     STAT_UPDATE(updatedHeroAvatarCount, avatarManager->getNumHeroAvatarsUpdated());
     STAT_UPDATE(notUpdatedAvatarCount, avatarManager->getNumAvatarsNotUpdated());
+    STAT_UPDATE(simulatedAvatarCount, avatarManager->getNumAvatarsSimulated());
+    STAT_UPDATE(fullAnimationLODAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::Full));
+    STAT_UPDATE(reducedAnimationLODAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::Reduced));
+    STAT_UPDATE(minimalAnimationLODAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::Minimal));
     STAT_UPDATE(serverCount, (int)nodeList->size());
     STAT_UPDATE_FLOAT(renderrate, qApp->getRenderLoopRate(), 0.1f);
     RefreshRateManager& refreshRateManager = qApp->getRefreshRateManager();
@@ -392,6 +399,16 @@ void Stats::updateStats(bool force) {
     auto config = qApp->getRenderEngine()->getConfiguration().get();
     STAT_UPDATE(engineFrameTime, (float) config->getCPURunTime());
     STAT_UPDATE(avatarSimulationTime, (float)avatarManager->getAvatarSimulationTime());
+    STAT_UPDATE(avatarSortTime, (float)avatarManager->getAvatarSortTime());
+    STAT_UPDATE(avatarJointsTime, (float)avatarManager->getAvatarJointsTime());
+    STAT_UPDATE(avatarSkinningTime, (float)avatarManager->getAvatarSkinningTime());
+    STAT_UPDATE(physicsHarvestTime, qApp->getPhysicsHarvestTime());
+    {
+        auto modelBlender = DependencyManager::get<ModelBlender>();
+        STAT_UPDATE(blendRate, modelBlender->getBlendRate());
+        STAT_UPDATE(blendTime, modelBlender->getAverageBlendTime());
+        STAT_UPDATE(queuedBlendCount, modelBlender->getNumQueuedBlends());
+    }
 
     if (_expanded) {
         STAT_UPDATE(gpuBuffers, (int)gpu::Context::getBufferGPUCount());
@@ -409,6 +426,7 @@ void Stats::updateStats(bool force) {
         STAT_UPDATE(gpuTextureResourceIdealMemory, (int)BYTES_TO_MB(gpu::Context::getTextureResourceIdealGPUMemSize()));
         STAT_UPDATE(gpuTextureResourcePopulatedMemory, (int)BYTES_TO_MB(gpu::Context::getTextureResourcePopulatedGPUMemSize()));
         STAT_UPDATE(gpuTextureExternalMemory, (int)BYTES_TO_MB(gpu::Context::getTextureExternalGPUMemSize()));
+        STAT_UPDATE(gpuTextureStreamedMemory, (int)(gpu::Context::getTextureResourceStreamedGPUMemSize() / BYTES_PER_KILOBYTE));
 #if !defined(Q_OS_ANDROID)
         STAT_UPDATE(gpuTextureMemoryPressureState, getTextureMemoryPressureModeString());
 #endif
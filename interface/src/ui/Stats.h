@@ -88,6 +88,10 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} physicsObjectCount - The number of objects that have collisions enabled.
  *     <em>Read-only.</em>
+ * @property {number} activePhysicsObjectCount - The number of dynamic physics objects in awake simulation islands.
+ *     <em>Read-only.</em>
+ * @property {number} sleepingPhysicsObjectCount - The number of dynamic physics objects in sleeping simulation islands.
+ *     <em>Read-only.</em>
  * @property {number} updatedAvatarCount - The number of avatars in the domain, other than the client's, that were updated in 
  *     the most recent game loop.
  *     <em>Read-only.</em>
@@ -97,6 +101,17 @@ private: \
  * @property {number} notUpdatedAvatarCount - The number of avatars in the domain, other than the client's, that weren't able 
  *     to be updated in the most recent game loop because there wasn't enough time to.
  *     <em>Read-only.</em>
+ * @property {number} simulatedAvatarCount - The number of avatars in the domain, other than the client's, that were simulated 
+ *     in the most recent game loop, whether or not they had new joint data.
+ *     <em>Read-only.</em>
+ * @property {number} fullAnimationLODAvatarCount - The number of simulated avatars whose joints are updated every frame.
+ *     <em>Read-only.</em>
+ * @property {number} reducedAnimationLODAvatarCount - The number of simulated avatars whose joints are updated every 2nd 
+ *     frame because they are small on screen.
+ *     <em>Read-only.</em>
+ * @property {number} minimalAnimationLODAvatarCount - The number of simulated avatars whose joints are updated every 4th 
+ *     frame because they are very small on screen.
+ *     <em>Read-only.</em>
  * @property {number} packetInCount - The number of packets being received from the domain server, in packets per second.
  *     <em>Read-only.</em>
  * @property {number} packetOutCount - The number of packets being sent to the domain server, in packets per second.
@@ -304,6 +319,8 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} gpuTextureResourcePopulatedMemory - How much of the GPU memory allocated has actually been populated, in 
 *      MB.
+ *     <em>Read-only.</em>
+ * @property {number} gpuTextureStreamedMemory - The amount of texture data uploaded to the GPU in the last frame, in KB.
  *     <em>Read-only.</em>
  * @property {string} gpuTextureMemoryPressureState - The stats of the texture transfer engine.
  *     <ul>
@@ -334,6 +351,23 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} avatarSimulationTime - The time being spent simulating avatars each frame, in ms.
  *     <em>Read-only.</em>
+ * @property {number} avatarSortTime - The part of <code>avatarSimulationTime</code> spent sorting avatars by priority, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} avatarJointsTime - The part of <code>avatarSimulationTime</code> spent decoding avatar joints on the 
+ *     worker threads, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} avatarSkinningTime - The part of <code>avatarSimulationTime</code> spent computing avatar skinning 
+ *     matrices on the worker threads, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} physicsHarvestTime - The time spent harvesting changed and deactivated objects from the physics 
+ *     simulation each frame, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} blendRate - The number of model blendshape blends completed per second.
+ *     <em>Read-only.</em>
+ * @property {number} blendTime - The average time taken by a blendshape blend on a worker thread, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} queuedBlendCount - The number of models waiting for a blendshape blend.
+ *     <em>Read-only.</em>
  *
  * @property {number} stylusPicksCount - The number of stylus picks currently in effect.
  *     <em>Read-only.</em>
@@ -483,9 +517,15 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(QString, uxMode, QString())
     STATS_PROPERTY(int, heroAvatarCount, 0)
     STATS_PROPERTY(int, physicsObjectCount, 0)
+    STATS_PROPERTY(int, activePhysicsObjectCount, 0)
+    STATS_PROPERTY(int, sleepingPhysicsObjectCount, 0)
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
+    STATS_PROPERTY(int, simulatedAvatarCount, 0)
+    STATS_PROPERTY(int, fullAnimationLODAvatarCount, 0)
+    STATS_PROPERTY(int, reducedAnimationLODAvatarCount, 0)
+    STATS_PROPERTY(int, minimalAnimationLODAvatarCount, 0)
     STATS_PROPERTY(int, packetInCount, 0)
     STATS_PROPERTY(int, packetOutCount, 0)
     STATS_PROPERTY(float, mbpsIn, 0)
@@ -569,6 +609,7 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, gpuTextureResourceIdealMemory, 0)
     STATS_PROPERTY(int, gpuTextureResourcePopulatedMemory, 0)
     STATS_PROPERTY(int, gpuTextureExternalMemory, 0)
+    STATS_PROPERTY(int, gpuTextureStreamedMemory, 0)
     STATS_PROPERTY(QString, gpuTextureMemoryPressureState, QString())
     STATS_PROPERTY(int, gpuFreeMemory, 0)
     STATS_PROPERTY(QVector2D, gpuFrameSize, QVector2D(0,0))
@@ -577,6 +618,13 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(float, batchFrameTime, 0)
     STATS_PROPERTY(float, engineFrameTime, 0)
     STATS_PROPERTY(float, avatarSimulationTime, 0)
+    STATS_PROPERTY(float, avatarSortTime, 0)
+    STATS_PROPERTY(float, avatarJointsTime, 0)
+    STATS_PROPERTY(float, avatarSkinningTime, 0)
+    STATS_PROPERTY(float, physicsHarvestTime, 0)
+    STATS_PROPERTY(float, blendRate, 0)
+    STATS_PROPERTY(float, blendTime, 0)
+    STATS_PROPERTY(int, queuedBlendCount, 0)
 
     STATS_PROPERTY(int, stylusPicksCount, 0)
     STATS_PROPERTY(int, rayPicksCount, 0)
@@ -798,6 +846,20 @@ signals:
      */
     void physicsObjectCountChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>activePhysicsObjectCount</code> property changes.
+     * @function Stats.activePhysicsObjectCountChanged
+     * @returns {Signal}
+     */
+    void activePhysicsObjectCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>sleepingPhysicsObjectCount</code> property changes.
+     * @function Stats.sleepingPhysicsObjectCountChanged
+     * @returns {Signal}
+     */
+    void sleepingPhysicsObjectCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>updatedAvatarCount</code> property changes.
      * @function Stats.updatedAvatarCountChanged
@@ -819,6 +881,34 @@ signals:
      */
     void notUpdatedAvatarCountChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>simulatedAvatarCount</code> property changes.
+     * @function Stats.simulatedAvatarCountChanged
+     * @returns {Signal}
+     */
+    void simulatedAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>fullAnimationLODAvatarCount</code> property changes.
+     * @function Stats.fullAnimationLODAvatarCountChanged
+     * @returns {Signal}
+     */
+    void fullAnimationLODAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>reducedAnimationLODAvatarCount</code> property changes.
+     * @function Stats.reducedAnimationLODAvatarCountChanged
+     * @returns {Signal}
+     */
+    void reducedAnimationLODAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>minimalAnimationLODAvatarCount</code> property changes.
+     * @function Stats.minimalAnimationLODAvatarCountChanged
+     * @returns {Signal}
+     */
+    void minimalAnimationLODAvatarCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>packetInCount</code> property changes.
      * @function Stats.packetInCountChanged
@@ -1381,6 +1471,13 @@ signals:
      */
     void gpuTextureExternalMemoryChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>gpuTextureStreamedMemory</code> property changes.
+     * @function Stats.gpuTextureStreamedMemoryChanged
+     * @returns {Signal}
+     */
+    void gpuTextureStreamedMemoryChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>gpuTextureMemoryPressureState</code> property changes.
      * @function Stats.gpuTextureMemoryPressureStateChanged
@@ -1437,6 +1534,55 @@ signals:
      */
     void avatarSimulationTimeChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>avatarSortTime</code> property changes.
+     * @function Stats.avatarSortTimeChanged
+     * @returns {Signal}
+     */
+    void avatarSortTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>avatarJointsTime</code> property changes.
+     * @function Stats.avatarJointsTimeChanged
+     * @returns {Signal}
+     */
+    void avatarJointsTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>avatarSkinningTime</code> property changes.
+     * @function Stats.avatarSkinningTimeChanged
+     * @returns {Signal}
+     */
+    void avatarSkinningTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>physicsHarvestTime</code> property changes.
+     * @function Stats.physicsHarvestTimeChanged
+     * @returns {Signal}
+     */
+    void physicsHarvestTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>blendRate</code> property changes.
+     * @function Stats.blendRateChanged
+     * @returns {Signal}
+     */
+    void blendRateChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>blendTime</code> property changes.
+     * @function Stats.blendTimeChanged
+     * @returns {Signal}
+     */
+    void blendTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>queuedBlendCount</code> property changes.
+     * @function Stats.queuedBlendCountChanged
+     * @returns {Signal}
+     */
+    void queuedBlendCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>stylusPicksCount</code> property changes.
      * @function Stats.stylusPicksCountChanged
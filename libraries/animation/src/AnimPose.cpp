@@ -67,13 +67,27 @@ glm::vec3 AnimPose::xformVectorFast(const glm::vec3& rhs) const {
     return _rot * (_scale * rhs);
 }
 
+// true if the scale is the same positive value on every axis, which is the common case for skeleton joints.
+static bool isUniformPositiveScale(const glm::vec3& scale) {
+    return scale.x > 0.0f && scale.x == scale.y && scale.x == scale.z;
+}
+
 AnimPose AnimPose::operator*(const AnimPose& rhs) const {
+    // without shear the product can be composed directly, skipping the matrix multiply and decomposition.
+    if (isUniformPositiveScale(_scale) && rhs._scale.x > 0.0f && rhs._scale.y > 0.0f && rhs._scale.z > 0.0f) {
+        return AnimPose(_scale.x * rhs._scale, _rot * rhs._rot, _trans + _rot * (_scale.x * rhs._trans));
+    }
     glm::mat4 result;
     glm_mat4u_mul(*this, rhs, result);
     return AnimPose(result);
 }
 
 AnimPose AnimPose::inverse() const {
+    if (isUniformPositiveScale(_scale)) {
+        float invScale = 1.0f / _scale.x;
+        glm::quat invRot = glm::inverse(_rot);
+        return AnimPose(glm::vec3(invScale), invRot, invRot * (_trans * -invScale));
+    }
     return AnimPose(glm::inverse(static_cast<glm::mat4>(*this)));
 }
 
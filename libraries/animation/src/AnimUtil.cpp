@@ -13,8 +13,54 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// The SSE2 path below treats each AnimPose as ten packed floats: scale.xyz, rot.xyzw, trans.xyz.
+static_assert(sizeof(AnimPose) == 10 * sizeof(float), "AnimPose is expected to be ten packed floats");
+
+static inline __m128 horizontalSum(__m128 v) {
+    v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    const __m128 alphaV = _mm_set1_ps(alpha);
+    const __m128 oneMinusAlphaV = _mm_set1_ps(1.0f - alpha);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (size_t i = 0; i < numPoses; i++) {
+        const float* aPose = reinterpret_cast<const float*>(&a[i]);
+        const float* bPose = reinterpret_cast<const float*>(&b[i]);
+        float* resultPose = reinterpret_cast<float*>(&result[i]);
+
+        // floats 0-3 cover scale and 6-9 cover translation; the rotation lanes they overlap are rewritten below.
+        // everything is loaded before anything is stored, so result may alias a or b.
+        __m128 aLow = _mm_loadu_ps(aPose);
+        __m128 bLow = _mm_loadu_ps(bPose);
+        __m128 aHigh = _mm_loadu_ps(aPose + 6);
+        __m128 bHigh = _mm_loadu_ps(bPose + 6);
+        __m128 aRot = _mm_loadu_ps(aPose + 3);
+        __m128 bRot = _mm_loadu_ps(bPose + 3);
+
+        __m128 low = _mm_add_ps(_mm_mul_ps(aLow, oneMinusAlphaV), _mm_mul_ps(bLow, alphaV));
+        __m128 high = _mm_add_ps(_mm_mul_ps(aHigh, oneMinusAlphaV), _mm_mul_ps(bHigh, alphaV));
+
+        // same as safeLerp(): flip b into a's hemisphere, lerp, then normalize.
+        __m128 flip = _mm_and_ps(_mm_cmplt_ps(horizontalSum(_mm_mul_ps(aRot, bRot)), _mm_setzero_ps()), signMask);
+        bRot = _mm_xor_ps(bRot, flip);
+        __m128 rot = _mm_add_ps(_mm_mul_ps(aRot, oneMinusAlphaV), _mm_mul_ps(bRot, alphaV));
+        rot = _mm_mul_ps(rot, _mm_div_ps(one, _mm_sqrt_ps(horizontalSum(_mm_mul_ps(rot, rot)))));
+
+        _mm_storeu_ps(resultPose, low);
+        _mm_storeu_ps(resultPose + 6, high);
+        _mm_storeu_ps(resultPose + 3, rot);
+    }
+}
+
+#else
+
 // TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
@@ -26,6 +72,8 @@ void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, A
     }
 }
 
+#endif
+
 void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
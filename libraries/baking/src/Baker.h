@@ -13,6 +13,7 @@
 #define hifi_Baker_h
 
 #include <QtCore/QObject>
+#include <QtCore/QUrl>
 
 class Baker : public QObject {
     Q_OBJECT
@@ -29,6 +30,7 @@ public:
     QStringList getWarnings() const { return _warningList; }
 
     std::vector<QString> getOutputFiles() const { return _outputFiles; }
+    std::vector<QUrl> getDependencies() const { return _dependencies; }
 
     virtual void setIsFinished(bool isFinished);
     bool isFinished() const { return _isFinished.load(); }
@@ -55,6 +57,9 @@ protected:
     // include the .fbx, a .fst pointing to the fbx, and all of the fbx texture files.
     std::vector<QString> _outputFiles;
 
+    // Sources read during the bake other than the input itself, such as the textures of a model
+    std::vector<QUrl> _dependencies;
+
     QStringList _errorList;
     QStringList _warningList;
 
@@ -282,6 +282,9 @@ void ModelBaker::handleFinishedMaterialBaker() {
     auto baker = qobject_cast<MaterialBaker*>(sender());
 
     if (baker) {
+        for (auto& dependency : baker->getDependencies()) {
+            _dependencies.push_back(dependency);
+        }
         if (!baker->hasErrors()) {
             // this MaterialBaker is done and everything went according to plan
             qCDebug(model_baking) << "Adding baked material to FST mapping " << baker->getBakedMaterialData();
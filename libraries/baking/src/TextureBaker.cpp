@@ -62,6 +62,7 @@ void TextureBaker::bake() {
 
     if (_originalTexture.isEmpty()) {
         // first load the texture (either locally or remotely)
+        _dependencies.push_back(_textureURL);
         loadTexture();
     } else {
         // we already have a texture passed to us, use that
@@ -105,6 +105,11 @@ void FSTBaker::handleModelBakerEnded() {
         _outputFiles.push_back(outputFile);
     }
 
+    _dependencies.push_back(_modelBaker->getModelURL());
+    for (auto& dependency : _modelBaker->getDependencies()) {
+        _dependencies.push_back(dependency);
+    }
+
 }
 
 void FSTBaker::handleModelBakerAborted() {
@@ -25,8 +25,11 @@
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkRequest>
 
-#include <unordered_set>
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <type_traits>
+#include <unordered_set>
 #include <qfile.h>
 #include <qfileinfo.h>
 
@@ -425,6 +428,7 @@ bool GLTFSerializer::addBufferView(const QJsonObject& object) {
     getIntVal(object, "buffer", bufferview.buffer, bufferview.defined);
     getIntVal(object, "byteLength", bufferview.byteLength, bufferview.defined);
     getIntVal(object, "byteOffset", bufferview.byteOffset, bufferview.defined);
+    getIntVal(object, "byteStride", bufferview.byteStride, bufferview.defined);
     getIntVal(object, "target", bufferview.target, bufferview.defined);
 
     _file.bufferviews.push_back(bufferview);
@@ -1794,80 +1798,90 @@ void GLTFSerializer::setHFMMaterial(HFMMaterial& hfmMat, const GLTFMaterial& mat
 }
 
 template <typename T, typename L>
-bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int count, QVector<L>& outarray, int accessorType) {
-    QDataStream blobstream(bin);
-    blobstream.setByteOrder(QDataStream::LittleEndian);
-    blobstream.setVersion(QDataStream::Qt_5_9);
-    blobstream.setFloatingPointPrecision(QDataStream::FloatingPointPrecision::SinglePrecision);
-    blobstream.skipRawData(byteOffset);
-
+bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
+                               QVector<L>& outarray, int accessorType, bool normalized) {
     int bufferCount = 0;
     switch (accessorType) {
         case GLTFAccessorType::SCALAR:
-            bufferCount = 1;
-            break;
         case GLTFAccessorType::VEC2:
-            bufferCount = 2;
-            break;
         case GLTFAccessorType::VEC3:
-            bufferCount = 3;
-            break;
         case GLTFAccessorType::VEC4:
-            bufferCount = 4;
-            break;
         case GLTFAccessorType::MAT2:
-            bufferCount = 4;
-            break;
         case GLTFAccessorType::MAT3:
-            bufferCount = 9;
-            break;
         case GLTFAccessorType::MAT4:
-            bufferCount = 16;
+            bufferCount = GLTFAccessorType::count((GLTFAccessorType::Value)accessorType);
             break;
         default:
             qWarning(modelformat) << "Unknown accessorType: " << accessorType;
-            blobstream.setDevice(nullptr);
             return false;
     }
+
+    // Elements are either tightly packed or interleaved with other attributes in the same buffer view
+    const int elementSize = (int)sizeof(T) * bufferCount;
+    const int stride = byteStride > 0 ? byteStride : elementSize;
+    if (count <= 0) {
+        return true;
+    }
+    if (byteOffset < 0 || stride < elementSize ||
+        (qint64)byteOffset + (qint64)stride * (count - 1) + elementSize > (qint64)bin.size()) {
+        return false;
+    }
+
+    const char* src = bin.constData() + byteOffset;
+    const int outStart = outarray.size();
+    outarray.resize(outStart + count * bufferCount);
+    L* dst = outarray.data() + outStart;
+
+    // glTF data is little endian, as are all the platforms we ship on, so the components can be copied straight out
+    if (std::is_same<T, L>::value && stride == elementSize) {
+        memcpy(dst, src, (size_t)count * elementSize);
+        return true;
+    }
+
+    // Normalized integer components map onto [0, 1] (unsigned) or [-1, 1] (signed) per the glTF specification
+    const bool normalize = normalized && std::is_integral<T>::value && std::is_floating_point<L>::value;
+    const float scale = normalize ? 1.0f / (float)std::numeric_limits<T>::max() : 1.0f;
     for (int i = 0; i < count; ++i) {
+        const char* element = src + (size_t)i * stride;
         for (int j = 0; j < bufferCount; ++j) {
-            if (!blobstream.atEnd()) {
-                T value;
-                blobstream >> value;
-                outarray.push_back(value);
+            T value;
+            memcpy(&value, element + j * sizeof(T), sizeof(T));
+            if (normalize) {
+                *dst++ = (L)std::max((float)value * scale, -1.0f);
             } else {
-                blobstream.setDevice(nullptr);
-                return false;
+                *dst++ = (L)value;
             }
         }
     }
-
-    blobstream.setDevice(nullptr);
     return true;
 }
 template <typename T>
 bool GLTFSerializer::addArrayOfType(const hifi::ByteArray& bin,
                                     int byteOffset,
+                                    int byteStride,
                                     int count,
                                     QVector<T>& outarray,
                                     int accessorType,
-                                    int componentType) {
+                                    int componentType,
+                                    bool normalized) {
     switch (componentType) {
-        case GLTFAccessorComponentType::BYTE: {}
+        case GLTFAccessorComponentType::BYTE: {
+            return readArray<int8_t>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
+        }
         case GLTFAccessorComponentType::UNSIGNED_BYTE: {
-            return readArray<uchar>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<uchar>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
         }
         case GLTFAccessorComponentType::SHORT: {
-            return readArray<short>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<short>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
         }
         case GLTFAccessorComponentType::UNSIGNED_INT: {
-            return readArray<uint>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<uint>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
         }
         case GLTFAccessorComponentType::UNSIGNED_SHORT: {
-            return readArray<ushort>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<ushort>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
         }
         case GLTFAccessorComponentType::FLOAT: {
-            return readArray<float>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<float>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
         }
     }
     return false;
@@ -1991,14 +2005,13 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
         int accBoffset = accessor.defined["byteOffset"] ? accessor.byteOffset : 0;
 
-        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, accessor.count, outarray, accessor.type,
-                                 accessor.componentType);
+        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, bufferview.byteStride, accessor.count,
+                                 outarray, accessor.type, accessor.componentType, accessor.normalized);
     } else {
-        for (int i = 0; i < accessor.count; ++i) {
-            T value;
-            memset(&value, 0, sizeof(T));  // Make sure the dummy array is initalised to zero.
-            outarray.push_back(value);
-        }
+        // Make sure the dummy array is initalised to zero, leaving what was already in the output alone.
+        int oldSize = outarray.size();
+        outarray.resize(oldSize + accessor.count);
+        std::fill(outarray.begin() + oldSize, outarray.end(), T());
     }
 
     if (success) {
@@ -2010,9 +2023,9 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
             int accSIBoffset = accessor.sparse.indices.defined["byteOffset"] ? accessor.sparse.indices.byteOffset : 0;
 
-            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset,
+            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset, 0,
                                      accessor.sparse.count, out_sparse_indices_array, GLTFAccessorType::SCALAR,
-                                     accessor.sparse.indices.componentType);
+                                     accessor.sparse.indices.componentType, false);
             if (success) {
                 QVector<T> out_sparse_values_array;
 
@@ -2021,8 +2034,9 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
                 int accSVBoffset = accessor.sparse.values.defined["byteOffset"] ? accessor.sparse.values.byteOffset : 0;
 
-                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset,
-                                         accessor.sparse.count, out_sparse_values_array, accessor.type, accessor.componentType);
+                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset, 0,
+                                         accessor.sparse.count, out_sparse_values_array, accessor.type, accessor.componentType,
+                                         accessor.normalized);
 
                 if (success) {
                     for (int i = 0; i < accessor.sparse.count; ++i) {
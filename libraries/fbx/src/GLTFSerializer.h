@@ -208,6 +208,7 @@ struct GLTFBufferView {
     int buffer; //required
     int byteLength; //required
     int byteOffset { 0 };
+    int byteStride { 0 };
     int target;
     QMap<QString, bool> defined;
     void dump() {
@@ -220,6 +221,9 @@ struct GLTFBufferView {
         if (defined["byteOffset"]) {
             qCDebug(modelformat) << "byteOffset: " << byteOffset;
         }
+        if (defined["byteStride"]) {
+            qCDebug(modelformat) << "byteStride: " << byteStride;
+        }
         if (defined["target"]) {
             qCDebug(modelformat) << "target: " << target;
         }
@@ -885,12 +889,12 @@ private:
     bool readBinary(const QString& url, hifi::ByteArray& outdata);
 
     template<typename T, typename L>
-    bool readArray(const hifi::ByteArray& bin, int byteOffset, int count,
-                   QVector<L>& outarray, int accessorType);
+    bool readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
+                   QVector<L>& outarray, int accessorType, bool normalized);
 
     template<typename T>
-    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int count,
-                        QVector<T>& outarray, int accessorType, int componentType);
+    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
+                        QVector<T>& outarray, int accessorType, int componentType, bool normalized);
 
     template <typename T>
     bool addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& outarray);
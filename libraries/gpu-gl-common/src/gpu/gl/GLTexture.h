@@ -40,6 +40,12 @@ public:
     /// and incremental transfer
     void addMemoryManagedTexture(const TexturePointer& texturePointer);
 
+    /// Streaming priorities, higher values are processed first.  Promotion favors the most screen coverage
+    /// gained per byte, demotion the most bytes freed per screen coverage lost, so textures that are off screen
+    /// are promoted smallest first and demoted largest first.
+    static float evalPromotePriority(Size size, float screenCoverage);
+    static float evalDemotePriority(Size size, float screenCoverage);
+
 protected:
     // Fetch all the currently active textures as strong pointers, while clearing the 
     // empty weak pointers out of _registeredTextures
@@ -106,6 +112,11 @@ public:
     bool canDemote() const { return _allocatedMip < _maxAllocatedMip; }
     bool hasPendingTransfers() const { return _populatedMip > _allocatedMip; }
 
+    // Called once per frame with the coverage the renderer reported for the texture.  Decays rather than
+    // resets so a texture that briefly leaves the view keeps part of its priority.
+    void updateScreenCoverage(float reportedCoverage);
+    float screenCoverage() const { return _screenCoverage; }
+
     virtual size_t promote() = 0;
     virtual size_t demote() = 0;
 
@@ -123,6 +134,8 @@ protected:
     void decrementPopulatedSize(Size delta) const;
     mutable Size _populatedSize { 0 };
 
+    float _screenCoverage { 0.0f };
+
     // The allocated mip level, relative to the number of mips in the gpu::Texture object 
     // The relationship between a given glMip to the original gpu::Texture mip is always 
     // glMip + _allocatedMip
@@ -50,6 +50,11 @@ using ImmediateWorkQueue = std::priority_queue<ImmediateQueuePair, std::vector<I
 // A map of weak texture pointers to queues of work to be done to transfer their data from the backing store to the GPU
 using TransferMap = std::map<TextureWeakPointer, TransferQueue, std::owner_less<TextureWeakPointer>>;
 
+// Coverage credited to every texture, so that off screen textures still order by size
+static const float MIN_SCREEN_COVERAGE = 1.0e-4f;
+// Fraction of its coverage a texture keeps each frame it isn't drawn
+static const float SCREEN_COVERAGE_DECAY = 0.9f;
+
 class GLTextureTransferEngineDefault : public GLTextureTransferEngine {
     using Parent = GLTextureTransferEngine;
 
@@ -109,6 +114,8 @@ private:
     TextureBufferThread* _transferThread{ nullptr };
     // The amount of buffering work currently represented by the _activeBufferQueue
     std::atomic<size_t> _queuedBufferSize{ 0 };
+    // The amount of texture data uploaded to the GPU during the current frame
+    size_t _frameStreamedSize{ 0 };
     // This contains a map of all textures to queues of pending transfer jobs.  While in the transfer state, this map is used to
     // populate the _activeBufferQueue up to the limit specified in GLVariableAllocationTexture::MAX_BUFFER_SIZE
     TransferMap _pendingTransfersMap;
@@ -119,6 +126,18 @@ private:
 using namespace gpu;
 using namespace gpu::gl;
 
+float GLTextureTransferEngine::evalPromotePriority(Size size, float screenCoverage) {
+    return (screenCoverage + MIN_SCREEN_COVERAGE) / (float)std::max<Size>(size, 1);
+}
+
+float GLTextureTransferEngine::evalDemotePriority(Size size, float screenCoverage) {
+    return (float)size / (screenCoverage + MIN_SCREEN_COVERAGE);
+}
+
+void GLVariableAllocationSupport::updateScreenCoverage(float reportedCoverage) {
+    _screenCoverage = std::max(reportedCoverage, _screenCoverage * SCREEN_COVERAGE_DECAY);
+}
+
 void GLBackend::initTextureManagementStage() {
     _textureManagement._transferEngine = std::make_shared<GLTextureTransferEngineDefault>();
 }
@@ -166,6 +185,7 @@ void GLTextureTransferEngineDefault::manageMemory() {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
     // reset the count used to limit the number of textures created per frame
     resetFrameTextureCreated();
+    _frameStreamedSize = 0;
     // Determine the current memory management state.  It will be either idle (no work to do),
     // undersubscribed (need to do more allocation) or transfer (need to upload content from the
     // backing store to the GPU
@@ -177,6 +197,7 @@ void GLTextureTransferEngineDefault::manageMemory() {
         // If we're in transfer mode we need to manage the buffering and upload queues
         processTransferQueues();
     }
+    Backend::textureResourceStreamedGPUMemSize.set(_frameStreamedSize);
 }
 
 // Each frame we will check if our memory pressure state has changed.
@@ -200,6 +221,7 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vartexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         vartexture->sanityCheck();
+        vartexture->updateScreenCoverage(texture->takeScreenCoverage());
 
         // Track how much the texture thinks it should be using
         idealMemoryAllocation += texture->evalTotalSize();
@@ -255,8 +277,7 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
             GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
             GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
             if (MemoryPressureState::Undersubscribed == _memoryPressureState && vargltexture->canPromote()) {
-                // Promote smallest first
-                _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
+                _promoteQueue.push({ texture, evalPromotePriority(gltexture->size(), vargltexture->screenCoverage()) });
             } else if (MemoryPressureState::Transfer == _memoryPressureState && vargltexture->hasPendingTransfers()) {
                 populateTransferQueue(texture);
             }
@@ -300,6 +321,7 @@ void GLTextureTransferEngineDefault::processTransferQueues() {
             const auto& tranferJob = activeTransferJob.second;
             if (tranferJob->sourceMip() < vargltexture->populatedMip()) {
                 tranferJob->transfer(texturePointer);
+                _frameStreamedSize += tranferJob->size();
             }
             // The pop_front MUST be the last call since all of these varaibles in scope are
             // references that will be invalid after the pop
@@ -327,28 +349,31 @@ void GLTextureTransferEngineDefault::populateActiveBufferQueue() {
     ActiveTransferQueue newBufferJobs;
     size_t newTransferSize{ 0 };
 
+    // Drop finished or defunct entries, then visit the remaining textures in streaming priority order
+    // so that the limited buffer space goes to textures currently on screen
+    using PrioritizedTransfer = std::pair<TransferMap::iterator, float>;
+    std::vector<PrioritizedTransfer> prioritizedTransfers;
+    prioritizedTransfers.reserve(_pendingTransfersMap.size());
     for (auto itr = _pendingTransfersMap.begin(); itr != _pendingTransfersMap.end();) {
-        const auto& weakTexture = itr->first;
-        const auto texture = weakTexture.lock();
-
-        // Texture no longer exists, remove from the transfer map and move on
-        if (!texture) {
+        const auto texture = itr->first.lock();
+        // Texture no longer exists or has no pending transfers, remove from the transfer map and move on
+        if (!texture || itr->second.empty()) {
             itr = _pendingTransfersMap.erase(itr);
             continue;
         }
 
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
+        prioritizedTransfers.emplace_back(itr, evalPromotePriority(gltexture->size(), vargltexture->screenCoverage()));
+        ++itr;
+    }
+    std::stable_sort(prioritizedTransfers.begin(), prioritizedTransfers.end(),
+                     [](const PrioritizedTransfer& a, const PrioritizedTransfer& b) { return a.second > b.second; });
 
+    for (const auto& prioritizedTransfer : prioritizedTransfers) {
+        auto itr = prioritizedTransfer.first;
+        const auto texture = itr->first.lock();
         auto& textureTransferQueue = itr->second;
-        // Can't find any pending transfers, so move on
-        if (textureTransferQueue.empty()) {
-            if (vargltexture->hasPendingTransfers()) {
-                // qWarning(gpugllogging) << "Texture " << gltexture->_id << "(" << texture->source().c_str() << ") has no transfer jobs, but has pending transfers" ;
-            }
-            itr = _pendingTransfersMap.erase(itr);
-            continue;
-        }
 
         const auto& transferJob = textureTransferQueue.front();
         const auto& transferSize = transferJob->size();
@@ -363,7 +388,6 @@ void GLTextureTransferEngineDefault::populateActiveBufferQueue() {
         Q_ASSERT(newTransferSize <= MAX_BUFFER_SIZE);
         newBufferJobs.emplace_back(texture, transferJob);
         textureTransferQueue.pop();
-        ++itr;
     }
 
     {
@@ -445,8 +469,7 @@ void GLTextureTransferEngineDefault::processPromotes() {
         vartexture->promote();
         auto allocationDelta = gltexture->size() - originalSize;
         if (vartexture->canPromote()) {
-            // Promote smallest first
-            _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
+            _promoteQueue.push({ texture, evalPromotePriority(gltexture->size(), vartexture->screenCoverage()) });
         }
         allocatedBytes += allocationDelta;
         if (++allocations >= MAX_ALLOCATIONS_PER_FRAME) {
@@ -465,13 +488,13 @@ void GLTextureTransferEngineDefault::processPromotes() {
 }
 
 void GLTextureTransferEngineDefault::processDemotes(size_t reliefRequired, const std::vector<TexturePointer>& strongTextures) {
-    // Demote largest first
+    // Demote textures that are off screen first, largest first
     ImmediateWorkQueue demoteQueue;
     for (const auto& texture : strongTextures) {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         if (vargltexture->canDemote()) {
-            demoteQueue.push({ texture, (float)gltexture->size() });
+            demoteQueue.push({ texture, evalDemotePriority(gltexture->size(), vargltexture->screenCoverage()) });
         }
     }
 
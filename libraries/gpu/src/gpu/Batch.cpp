@@ -38,12 +38,12 @@ static const int MAX_NUM_UNIFORM_BUFFERS = 14;
 static const int MAX_NUM_RESOURCE_BUFFERS = 16;
 static const int MAX_NUM_RESOURCE_TEXTURES = 16;
 
-size_t Batch::_commandsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_commandOffsetsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_paramsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_dataMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_objectsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_drawCallInfosMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandOffsetsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_paramsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_dataMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_objectsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_drawCallInfosMax{ BATCH_PREALLOCATE_MIN };
 
 Batch::Batch(const std::string& name) {
     _name = name;
@@ -56,12 +56,22 @@ Batch::Batch(const std::string& name) {
 }
 
 Batch::~Batch() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    updateStorageMax();
+}
+
+void Batch::updateMax(std::atomic<size_t>& max, size_t size) {
+    size_t current = max.load(std::memory_order_relaxed);
+    while (size > current && !max.compare_exchange_weak(current, size, std::memory_order_relaxed)) {
+    }
+}
+
+void Batch::updateStorageMax() {
+    updateMax(_commandsMax, _commands.size());
+    updateMax(_commandOffsetsMax, _commandOffsets.size());
+    updateMax(_paramsMax, _params.size());
+    updateMax(_dataMax, _data.size());
+    updateMax(_objectsMax, _objects.size());
+    updateMax(_drawCallInfosMax, _drawCallInfos.size());
 }
 
 void Batch::setName(const std::string& name) {
@@ -69,12 +79,9 @@ void Batch::setName(const std::string& name) {
 }
 
 void Batch::clear() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    // NOTE: clear() keeps the capacity of every container, so a recycled batch records into the
+    // storage it grew on previous frames instead of reallocating it
+    updateStorageMax();
 
     _commands.clear();
     _commandOffsets.clear();
@@ -512,7 +519,7 @@ void Batch::setupNamedCalls(const std::string& instanceName, NamedBatchData::Fun
         instance.function = function;
     }
 
-    captureNamedDrawCallInfo(instanceName);
+    captureDrawCallInfoImpl(instance.drawCallInfos);
 }
 
 const BufferPointer& Batch::getNamedBuffer(const std::string& instanceName, uint8_t index) {
@@ -544,7 +551,7 @@ const Batch::DrawCallInfoBuffer& Batch::getDrawCallInfoBuffer() const {
     }
 }
 
-void Batch::captureDrawCallInfoImpl() {
+void Batch::captureDrawCallInfoImpl(DrawCallInfoBuffer& drawCallInfos) {
     if (_invalidModel) {
         TransformObject object;
         _currentModel.getMatrix(object._model);
@@ -561,7 +568,6 @@ void Batch::captureDrawCallInfoImpl() {
         _invalidModel = false;
     }
 
-    auto& drawCallInfos = getDrawCallInfoBuffer();
     drawCallInfos.emplace_back((uint16)_objects.size() - 1, _drawcallUniform);
     _drawcallUniform = _drawcallUniformReset;
 }
@@ -572,13 +578,11 @@ void Batch::captureDrawCallInfo() {
         return;
     }
 
-    captureDrawCallInfoImpl();
+    captureDrawCallInfoImpl(_drawCallInfos);
 }
 
-void Batch::captureNamedDrawCallInfo(std::string name) {
-    std::swap(_currentNamedCall, name);  // Set and save _currentNamedCall
-    captureDrawCallInfoImpl();
-    std::swap(_currentNamedCall, name);  // Restore _currentNamedCall
+void Batch::captureNamedDrawCallInfo(const std::string& name) {
+    captureDrawCallInfoImpl(_namedData[name].drawCallInfos);
 }
 
 // Debugging
@@ -12,6 +12,7 @@
 #define hifi_gpu_Batch_h
 
 #include <vector>
+#include <atomic>
 #include <mutex>
 #include <functional>
 #include <glm/gtc/type_ptr.hpp>
@@ -79,7 +80,7 @@ public:
     using NamedBatchDataMap = std::map<std::string, NamedBatchData>;
 
     DrawCallInfoBuffer _drawCallInfos;
-    static size_t _drawCallInfosMax;
+    static std::atomic<size_t> _drawCallInfosMax;
 
     mutable std::string _currentNamedCall;
 
@@ -87,7 +88,7 @@ public:
     DrawCallInfoBuffer& getDrawCallInfoBuffer();
 
     void captureDrawCallInfo();
-    void captureNamedDrawCallInfo(std::string name);
+    void captureNamedDrawCallInfo(const std::string& name);
 
     Batch(const std::string& name = "");
     // Disallow copy construction and assignement of batches
@@ -407,7 +408,7 @@ public:
         typedef T Data;
         Data _data;
         Cache<T>(const Data& data) : _data(data) {}
-        static size_t _max;
+        static std::atomic<size_t> _max;
 
         class Vector {
         public:
@@ -418,7 +419,7 @@ public:
             }
 
             ~Vector() {
-                _max = std::max(_items.size(), _max);
+                updateMax(_max, _items.size());
             }
 
 
@@ -435,6 +436,7 @@ public:
             }
 
             void clear() {
+                updateMax(_max, _items.size());
                 _items.clear();
             }
         };
@@ -484,16 +486,16 @@ public:
     }
 
     Commands _commands;
-    static size_t _commandsMax;
+    static std::atomic<size_t> _commandsMax;
 
     CommandOffsets _commandOffsets;
-    static size_t _commandOffsetsMax;
+    static std::atomic<size_t> _commandOffsetsMax;
 
     Params _params;
-    static size_t _paramsMax;
+    static std::atomic<size_t> _paramsMax;
 
     Bytes _data;
-    static size_t _dataMax;
+    static std::atomic<size_t> _dataMax;
 
     // SSBO class... layout MUST match the layout in Transform.slh
     class TransformObject {
@@ -506,7 +508,7 @@ public:
     bool _invalidModel { true };
     Transform _currentModel;
     TransformObjects _objects;
-    static size_t _objectsMax;
+    static std::atomic<size_t> _objectsMax;
 
     BufferCaches _buffers;
     TextureCaches _textures;
@@ -548,13 +550,17 @@ protected:
     void startNamedCall(const std::string& name);
     void stopNamedCall();
 
+    // Batches are recycled (see Context::acquireBatch()) and may be recorded on any thread, so the sizes new batches
+    // preallocate are tracked as lock-free high-water marks
+    static void updateMax(std::atomic<size_t>& max, size_t size);
+    void updateStorageMax();
 
 
-    void captureDrawCallInfoImpl();
+    void captureDrawCallInfoImpl(DrawCallInfoBuffer& drawCallInfos);
 };
 
 template <typename T>
-size_t Batch::Cache<T>::_max = BATCH_PREALLOCATE_MIN;
+std::atomic<size_t> Batch::Cache<T>::_max { BATCH_PREALLOCATE_MIN };
 
 }
 
@@ -284,6 +284,7 @@ ContextMetricSize  Backend::texturePendingGPUTransferMemSize;
 
 ContextMetricSize  Backend::textureResourcePopulatedGPUMemSize;
 ContextMetricSize  Backend::textureResourceIdealGPUMemSize;
+ContextMetricSize  Backend::textureResourceStreamedGPUMemSize;
 
 Size Context::getFreeGPUMemSize() {
     return Backend::freeGPUMemSize.getValue();
@@ -359,6 +360,10 @@ Size Context::getTextureResourceIdealGPUMemSize() {
     return Backend::textureResourceIdealGPUMemSize.getValue();
 }
 
+Size Context::getTextureResourceStreamedGPUMemSize() {
+    return Backend::textureResourceStreamedGPUMemSize.getValue();
+}
+
 void Context::pushProgramsToSync(const std::vector<uint32_t>& programIDs, std::function<void()> callback, size_t rate) {
     std::vector<gpu::ShaderPointer> programs;
     for (auto programID : programIDs) {
@@ -394,7 +399,7 @@ void Context::processProgramsToSync() {
 }
 
 std::mutex Context::_batchPoolMutex;
-std::list<Batch*> Context::_batchPool;
+std::vector<Batch*> Context::_batchPool;
 
 void Context::clearBatches() {
     for (auto batch : _batchPool) {
@@ -407,9 +412,10 @@ BatchPointer Context::acquireBatch(const char* name) {
     Batch* rawBatch = nullptr;
     {
         Lock lock(_batchPoolMutex);
+        // last in first out: the most recently released batch has the warmest storage
         if (!_batchPool.empty()) {
-            rawBatch = _batchPool.front();
-            _batchPool.pop_front();
+            rawBatch = _batchPool.back();
+            _batchPool.pop_back();
         }
     }
     if (!rawBatch) {
@@ -117,6 +117,7 @@ public:
     static ContextMetricSize texturePendingGPUTransferMemSize;
     static ContextMetricSize textureResourcePopulatedGPUMemSize;
     static ContextMetricSize textureResourceIdealGPUMemSize;
+    static ContextMetricSize textureResourceStreamedGPUMemSize;
 
     virtual bool isStereo() const {
         return _stereo.isStereo();
@@ -255,6 +256,7 @@ public:
 
     static Size getTextureResourcePopulatedGPUMemSize();
     static Size getTextureResourceIdealGPUMemSize();
+    static Size getTextureResourceStreamedGPUMemSize();
 
     struct ProgramsToSync {
         ProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate) :
@@ -293,7 +295,7 @@ protected:
     // Should probably move this functionality to Batch
     static void clearBatches();
     static std::mutex _batchPoolMutex;
-    static std::list<Batch*> _batchPool;
+    static std::vector<Batch*> _batchPool;
 
     friend class Shader;
     friend class Backend;
@@ -941,6 +941,12 @@ Texture::ExternalUpdates Texture::getUpdates() const {
     return result;
 }
 
+void Texture::noteScreenCoverage(float coverage) const {
+    float current = _screenCoverage.load();
+    while (coverage > current && !_screenCoverage.compare_exchange_weak(current, coverage)) {
+    }
+}
+
 void Texture::setStorage(std::unique_ptr<Storage>& newStorage) {
     _storage.swap(newStorage);
 }
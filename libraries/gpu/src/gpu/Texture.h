@@ -575,6 +575,11 @@ public:
 
     ExternalUpdates getUpdates() const;
 
+    // Largest fraction of the view covered by an item drawn with this texture since the backend last asked,
+    // as reported by the renderer. Texture streaming loads the textures covering the most screen first.
+    void noteScreenCoverage(float coverage) const;
+    float takeScreenCoverage() const { return _screenCoverage.exchange(0.0f); }
+
     // Serialize a texture into a KTX file
     static ktx::KTXUniquePointer serialize(const Texture& texture);
 
@@ -594,6 +599,7 @@ protected:
     mutable std::list<ExternalIdAndFence> _externalUpdates;
     ExternalRecycler _externalRecycler;
 
+    mutable std::atomic<float> _screenCoverage { 0.0f };
 
     std::weak_ptr<Texture> _fallback;
     // Not strictly necessary, but incredibly useful for debugging
@@ -52,3 +52,12 @@ TextureTable::Array TextureTable::getTextures() const {
      }
      return result; 
 }
+
+void TextureTable::noteScreenCoverage(float coverage) const {
+    Lock lock(_mutex);
+    for (const auto& texture : _textures) {
+        if (texture) {
+            texture->noteScreenCoverage(coverage);
+        }
+    }
+}
@@ -31,6 +31,8 @@ public:
     void setTexture(size_t index, const TextureView& texturePointer);
 
     Array getTextures() const;
+    // Forwards to Texture::noteScreenCoverage for every texture in the table
+    void noteScreenCoverage(float coverage) const;
     Stamp getStamp() const { return _stamp; }
 
 private:
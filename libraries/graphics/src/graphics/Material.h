@@ -536,6 +536,9 @@ public:
         }
     };
 
+    // The layers in queue storage order, which is the same for any two MultiMaterials built with the same pushes
+    const std::vector<MaterialLayer>& getLayers() const { return c; }
+
     gpu::BufferView& getSchemaBuffer() { return _schemaBuffer; }
     graphics::MaterialKey getMaterialKey() const { return graphics::MaterialKey(_schemaBuffer.get<graphics::MultiMaterial::Schema>()._key); }
     const gpu::TextureTablePointer& getTextureTable() const { return _textureTable; }
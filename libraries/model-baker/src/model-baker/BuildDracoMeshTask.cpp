@@ -24,6 +24,7 @@
 
 
 #ifndef Q_OS_ANDROID
+#include <TBBHelpers.h>
 #include <draco/compression/encode.h>
 #include <draco/mesh/triangle_soup_mesh_builder.h>
 #endif
@@ -252,22 +253,22 @@ void BuildDracoMeshTask::run(const baker::BakeContextPointer& context, const Inp
     std::vector<std::vector<uint16_t>> partMaterialIndicesPerMesh;
     createMaterialLists(shapes, meshes, materials, materialLists, partMaterialIndicesPerMesh);
 
-    dracoBytesPerMesh.reserve(meshes.size());
-    // vector<bool> is an exception to the std::vector conventions as it is a bit field
-    // So a bool reference to an element doesn't work
-    dracoErrorsPerMesh.resize(meshes.size());
-    for (size_t i = 0; i < meshes.size(); i++) {
+    // Meshes are encoded in parallel, each into its own pre-allocated slot
+    dracoBytesPerMesh.resize(meshes.size());
+    // vector<bool> is an exception to the std::vector conventions as it is a bit field,
+    // so neighbouring elements can't be written from different threads
+    std::vector<uint8_t> dracoErrors(meshes.size(), 0);
+    tbb::parallel_for((size_t)0, meshes.size(), [&](size_t i) {
         const auto& mesh = meshes[i];
         const auto& normals = baker::safeGet(normalsPerMesh, i);
         const auto& tangents = baker::safeGet(tangentsPerMesh, i);
-        dracoBytesPerMesh.emplace_back();
-        auto& dracoBytes = dracoBytesPerMesh.back();
+        auto& dracoBytes = dracoBytesPerMesh[i];
         const auto& partMaterialIndices = partMaterialIndicesPerMesh[i];
 
         bool dracoError;
         std::unique_ptr<draco::Mesh> dracoMesh;
         std::tie(dracoMesh, dracoError) = createDracoMesh(mesh, normals, tangents, partMaterialIndices);
-        dracoErrorsPerMesh[i] = dracoError;
+        dracoErrors[i] = dracoError;
 
         if (dracoMesh) {
             draco::Encoder encoder;
@@ -282,6 +283,7 @@ void BuildDracoMeshTask::run(const baker::BakeContextPointer& context, const Inp
 
             dracoBytes = hifi::ByteArray(buffer.data(), (int)buffer.size());
         }
-    }
+    });
+    dracoErrorsPerMesh.assign(dracoErrors.begin(), dracoErrors.end());
 #endif // not Q_OS_ANDROID
 }
@@ -14,6 +14,7 @@
 #include <glm/gtc/packing.hpp>
 
 #include <LogHandler.h>
+#include <TBBHelpers.h>
 #include "ModelBakerLogging.h"
 #include <hfm/HFMModelMath.h>
 #include "ModelMath.h"
@@ -391,9 +392,10 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
 
     auto& graphicsMeshes = output;
 
+    // Each mesh writes only to its own output slot, so the meshes can be built in parallel
     int n = (int)meshes.size();
-    for (int i = 0; i < n; i++) {
-        graphicsMeshes.emplace_back();
+    graphicsMeshes.resize(n);
+    tbb::parallel_for(0, n, [&](int i) {
         auto& graphicsMesh = graphicsMeshes[i];
 
         uint16_t numDeformerControllers = 0;
@@ -413,5 +415,5 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
                 graphicsMesh->modelName = meshIndicesToModelNames[i].toStdString();
             }
         }
-    }
+    });
 }
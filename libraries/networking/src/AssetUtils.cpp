@@ -11,6 +11,8 @@
 
 #include "AssetUtils.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 #include <QtCore/QCryptographicHash>
@@ -128,4 +130,58 @@ QString bakingStatusToString(BakingStatus status) {
     }
 }
 
+// A boundary is declared when the top 16 bits of the rolling hash are all zero, giving a 64 KB average chunk
+// past the minimum size. The gear hash shifts left every byte, so the top bits depend on the last 64 bytes only.
+static const uint64_t CHUNK_BOUNDARY_MASK = 0xFFFFull << 48;
+
+static std::array<uint64_t, 256> createGearTable() {
+    // The table only needs to be random looking and identical across runs and platforms, so use a fixed seed
+    std::array<uint64_t, 256> table;
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (auto& entry : table) {
+        // splitmix64
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        entry = z ^ (z >> 31);
+    }
+    return table;
+}
+
+static const std::array<uint64_t, 256> GEAR_TABLE = createGearTable();
+
+std::vector<int> findChunkBoundaries(const QByteArray& data) {
+    std::vector<int> boundaries;
+    const auto bytes = reinterpret_cast<const uint8_t*>(data.constData());
+    const int size = data.size();
+
+    int chunkStart = 0;
+    while (chunkStart < size) {
+        int remaining = size - chunkStart;
+        if (remaining <= MIN_CHUNK_SIZE) {
+            boundaries.push_back(size);
+            break;
+        }
+
+        int chunkEnd = chunkStart + std::min(remaining, MAX_CHUNK_SIZE);
+        uint64_t hash = 0;
+        // Bytes before the minimum size can't end a chunk, but they still need to prime the rolling hash
+        int i = chunkStart + MIN_CHUNK_SIZE - 64;
+        for (; i < chunkStart + MIN_CHUNK_SIZE; ++i) {
+            hash = (hash << 1) + GEAR_TABLE[bytes[i]];
+        }
+        for (; i < chunkEnd; ++i) {
+            hash = (hash << 1) + GEAR_TABLE[bytes[i]];
+            if ((hash & CHUNK_BOUNDARY_MASK) == 0) {
+                chunkEnd = i + 1;
+                break;
+            }
+        }
+
+        boundaries.push_back(chunkEnd);
+        chunkStart = chunkEnd;
+    }
+    return boundaries;
+}
+
 } // namespace AssetUtils
@@ -15,6 +15,7 @@
 #include <cstdint>
 
 #include <map>
+#include <vector>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QUrl>
@@ -37,6 +38,11 @@ const QString ASSET_HASH_REGEX_STRING = QString("^[a-fA-F0-9]{%1}$").arg(SHA256_
 
 const QString HIDDEN_BAKED_CONTENT_FOLDER = "/.baked/";
 
+// Chunk size limits for content-defined chunking, see findChunkBoundaries
+const int MIN_CHUNK_SIZE = 16 * 1024;
+const int AVERAGE_CHUNK_SIZE = 64 * 1024;
+const int MAX_CHUNK_SIZE = 256 * 1024;
+
 enum AssetServerError : uint8_t {
     NoError = 0,
     AssetNotFound,
@@ -90,6 +96,10 @@ bool isValidHash(const QString& hashString);
 
 QString bakingStatusToString(BakingStatus status);
 
+// Returns the end offset of every chunk of data. Boundaries are picked by a gear rolling hash over the data itself,
+// so inserting or changing bytes only moves the boundaries around the edit.
+std::vector<int> findChunkBoundaries(const QByteArray& data);
+
 } // namespace AssetUtils
 
 #endif // hifi_AssetUtils_h
@@ -108,6 +108,14 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     connect(this, &LimitedNodeList::nodeAdded, this, &NodeList::startNodeHolePunch);
     connect(this, &LimitedNodeList::nodeSocketUpdated, this, &NodeList::startNodeHolePunch);
 
+    // a node killed for any other reason than the domain-server telling us about it means
+    // our node list no longer matches the domain list version we acked, so ask for a full list
+    connect(this, &LimitedNodeList::nodeKilled, this, [this] {
+        if (!_isApplyingDomainListRemovals) {
+            _domainListVersion = 0;
+        }
+    });
+
     // anytime we get a new node we may need to re-send our set of ignored node IDs to it
     connect(this, &LimitedNodeList::nodeActivated, this, &NodeList::maybeSendIgnoreSetToNode);
 
@@ -196,6 +204,8 @@ void NodeList::timePingReply(ReceivedMessage& message, const SharedNodePointer&
     sendingNode->setPingMs(pingTime / 1000);
     sendingNode->updateClockSkewUsec(clockSkew);
 
+    emit pingReplyReceived(sendingNode, ourOriginalTime, (quint64)pingTime);
+
     const bool wantDebug = false;
 
     if (wantDebug) {
@@ -265,6 +275,8 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
     }
     LimitedNodeList::reset(reason);
 
+    _domainListVersion = 0;
+
     // lock and clear our set of ignored IDs
     _ignoredSetLock.lockForWrite();
     _ignoredNodeIDs.clear();
@@ -466,6 +478,10 @@ void NodeList::sendDomainServerCheckIn() {
         packetStream << _ownerType.load() << publicSockAddr << localSockAddr << _nodeTypesOfInterest.values();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainPacketType == PacketType::DomainListRequest) {
+            packetStream << _domainListVersion;
+        }
+
         if (!domainIsConnected) {
             DataServerAccountInfo& accountInfo = accountManager->getAccountInfo();
             packetStream << accountInfo.getUsername();
@@ -707,6 +723,16 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     bool newConnection;
     packetStream >> newConnection;
 
+    // the domain list is either complete, or only what changed since the version we acked
+    quint32 domainListVersion;
+    packetStream >> domainListVersion;
+    bool isDelta;
+    packetStream >> isDelta;
+    quint32 deltaBaseVersion;
+    packetStream >> deltaBaseVersion;
+    quint32 numRemovedNodes;
+    packetStream >> numRemovedNodes;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -786,10 +812,28 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
+    // a delta starts with the nodes removed since the version we acked
+    _isApplyingDomainListRemovals = true;
+    for (quint32 i = 0; i < numRemovedNodes; ++i) {
+        QUuid removedUUID;
+        packetStream >> removedUUID;
+        killNodeWithUUID(removedUUID);
+        removeDelayedAdd(removedUUID);
+    }
+    _isApplyingDomainListRemovals = false;
+
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
         parseNodeFromPacketStream(packetStream);
     }
+
+    // a delta against a version older than ours only repeats what we already have, and one against a version
+    // newer than ours (we were reset since acking it) leaves us missing nodes, so keep asking for a full list
+    if (!isDelta) {
+        _domainListVersion = domainListVersion;
+    } else if (deltaBaseVersion <= _domainListVersion && _domainListVersion != 0) {
+        _domainListVersion = std::max(_domainListVersion, domainListVersion);
+    }
 }
 
 void NodeList::processDomainServerAddedNode(QSharedPointer<ReceivedMessage> message) {
@@ -804,7 +848,9 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     // read the UUID from the packet, remove it if it exists
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
+    _isApplyingDomainListRemovals = true;
     killNodeWithUUID(nodeUUID);
+    _isApplyingDomainListRemovals = false;
     removeDelayedAdd(nodeUUID);
 }
 
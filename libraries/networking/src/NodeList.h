@@ -133,6 +133,9 @@ signals:
     void ignoreRadiusEnabledChanged(bool isIgnored);
     void usernameFromIDReply(const QString& nodeID, const QString& username, const QString& machineFingerprint, bool isAdmin);
 
+    // emitted for every timed ping reply, with the send timestamp the ping carried
+    void pingReplyReceived(SharedNodePointer sendingNode, quint64 originalTimestamp, quint64 pingUsecs);
+
 private slots:
     void stopKeepalivePingTimer();
     void sendPendingDSPathQuery();
@@ -174,6 +177,11 @@ private:
     QTimer _keepAlivePingTimer;
     bool _requestsDomainListData { false };
 
+    // the domain list version we last received, acked with each check-in so the domain-server can send only what changed.
+    // Reset whenever our node list stops matching it, which gets us a full list again.
+    quint32 _domainListVersion { 0 };
+    bool _isApplyingDomainListRemovals { false };
+
     bool _sendDomainServerCheckInEnabled { true };
 
     mutable QReadWriteLock _ignoredSetLock;
@@ -381,7 +381,13 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasDeltas
+};
+
+enum class DomainListRequestVersion : PacketVersion {
+    PreDomainListVersion = 22,
+    HasDomainListVersion
 };
 
 enum class AudioVersion : PacketVersion {
@@ -11,9 +11,11 @@
 
 #include "PhysicsEngine.h"
 
+#include <algorithm>
 #include <functional>
 
 #include <QFile>
+#include <QThread>
 
 #include <PerfStat.h>
 #include <PhysicsCollisionGroups.h>
@@ -24,9 +26,15 @@
 #include "ObjectMotionState.h"
 #include "PhysicsHelpers.h"
 #include "PhysicsDebugDraw.h"
+#include "PhysicsTaskScheduler.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "PhysicsLogging.h"
 
+#if BT_THREADSAFE
+// number of collision pairs handed to each narrowphase task
+const int COLLISION_DISPATCH_GRAIN_SIZE = 40;
+#endif
+
 PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
         _originOffset(offset),
         _myAvatarController(nullptr) {
@@ -39,16 +47,30 @@ PhysicsEngine::~PhysicsEngine() {
     delete _broadphaseFilter;
     delete _constraintSolver;
     delete _dynamicsWorld;
+#if BT_THREADSAFE
+    delete _constraintSolverPool;
+#endif
     delete _ghostPairCallback;
 }
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
+#if BT_THREADSAFE
+        // leave half of the cores to the render, audio and network threads
+        int numThreads = std::max(1, QThread::idealThreadCount() / 2);
+        PhysicsTaskScheduler::install(numThreads);
+        _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig, COLLISION_DISPATCH_GRAIN_SIZE);
+        _constraintSolverPool = new btConstraintSolverPoolMt(numThreads);
+        _constraintSolver = new btSequentialImpulseConstraintSolverMt;
+        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolverPool,
+                                                     _constraintSolver, _collisionConfig);
+#else
+        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+#endif
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -78,6 +100,14 @@ int32_t PhysicsEngine::getNumCollisionObjects() const {
     return _dynamicsWorld ? _dynamicsWorld->getNumCollisionObjects() : 0;
 }
 
+int32_t PhysicsEngine::getNumActiveBodies() const {
+    return _dynamicsWorld ? _dynamicsWorld->getNumActiveBodies() : 0;
+}
+
+int32_t PhysicsEngine::getNumSleepingBodies() const {
+    return _dynamicsWorld ? _dynamicsWorld->getNumSleepingBodies() : 0;
+}
+
 // private
 void PhysicsEngine::addObjectToDynamicsWorld(ObjectMotionState* motionState) {
     assert(motionState);
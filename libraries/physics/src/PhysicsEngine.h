@@ -98,6 +98,8 @@ public:
 
     uint32_t getNumSubsteps() const;
     int32_t getNumCollisionObjects() const;
+    int32_t getNumActiveBodies() const;
+    int32_t getNumSleepingBodies() const;
 
     void removeObjects(const VectorOfMotionStates& objects);
     void removeSetOfObjects(const SetOfMotionStates& objects); // only called during teardown
@@ -173,6 +175,9 @@ private:
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
     btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+#if BT_THREADSAFE
+    btConstraintSolverPoolMt* _constraintSolverPool = NULL;
+#endif
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
@@ -0,0 +1,66 @@
+//
+//  PhysicsTaskScheduler.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsTaskScheduler.h"
+
+#if BT_THREADSAFE
+
+#include <algorithm>
+#include <functional>
+
+#include <TBBHelpers.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+
+PhysicsTaskScheduler::PhysicsTaskScheduler(int numThreads) : btITaskScheduler("PhysicsTaskScheduler") {
+    setNumThreads(numThreads);
+}
+
+PhysicsTaskScheduler::~PhysicsTaskScheduler() {
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const {
+    return BT_MAX_THREAD_COUNT;
+}
+
+void PhysicsTaskScheduler::setNumThreads(int numThreads) {
+    _numThreads = std::max(1, std::min(numThreads, (int)BT_MAX_THREAD_COUNT));
+    _arena.reset(new tbb::task_arena(_numThreads));
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    btPushThreadsAreRunning();
+    _arena->execute([&] {
+        tbb::parallel_for(tbb::blocked_range<int>(iBegin, iEnd, grainSize), [&](const tbb::blocked_range<int>& range) {
+            body.forLoop(range.begin(), range.end());
+        }, tbb::simple_partitioner());
+    });
+    btPopThreadsAreRunning();
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    btPushThreadsAreRunning();
+    btScalar sum = _arena->execute([&] {
+        return tbb::parallel_reduce(tbb::blocked_range<int>(iBegin, iEnd, grainSize), btScalar(0.0f),
+            [&](const tbb::blocked_range<int>& range, btScalar partialSum) {
+                return partialSum + body.sumLoop(range.begin(), range.end());
+            }, std::plus<btScalar>(), tbb::simple_partitioner());
+    });
+    btPopThreadsAreRunning();
+    return sum;
+}
+
+void PhysicsTaskScheduler::install(int numThreads) {
+    static PhysicsTaskScheduler scheduler(numThreads);
+    scheduler.setNumThreads(numThreads);
+    btSetTaskScheduler(&scheduler);
+}
+
+#endif // BT_THREADSAFE
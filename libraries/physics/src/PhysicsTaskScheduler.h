@@ -0,0 +1,47 @@
+//
+//  PhysicsTaskScheduler.h
+//  libraries/physics/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsTaskScheduler_h
+#define hifi_PhysicsTaskScheduler_h
+
+#include <memory>
+
+#include <LinearMath/btThreads.h>
+
+#if BT_THREADSAFE
+
+namespace tbb {
+    class task_arena;
+}
+
+// Runs Bullet's parallel loops (narrowphase, island solving, integration) on the TBB worker pool,
+// confined to an arena so that physics never takes more than its share of the cores.
+class PhysicsTaskScheduler : public btITaskScheduler {
+public:
+    explicit PhysicsTaskScheduler(int numThreads);
+    ~PhysicsTaskScheduler();
+
+    int getMaxNumThreads() const override;
+    int getNumThreads() const override { return _numThreads; }
+    void setNumThreads(int numThreads) override;
+    void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+    btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+    // installs a process-wide scheduler with numThreads threads as Bullet's current task scheduler
+    static void install(int numThreads);
+
+private:
+    int _numThreads { 1 };
+    std::unique_ptr<tbb::task_arena> _arena;
+};
+
+#endif // BT_THREADSAFE
+
+#endif // hifi_PhysicsTaskScheduler_h
@@ -21,6 +21,16 @@
 
 #include "Profile.h"
 
+#if BT_THREADSAFE
+ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
+        btDispatcher* dispatcher,
+        btBroadphaseInterface* pairCache,
+        btConstraintSolverPoolMt* constraintSolverPool,
+        btConstraintSolver* constraintSolverMt,
+        btCollisionConfiguration* collisionConfiguration)
+    :   btDiscreteDynamicsWorldMt(dispatcher, pairCache, constraintSolverPool, constraintSolverMt, collisionConfiguration) {
+}
+#else
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
@@ -28,6 +38,7 @@ ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btCollisionConfiguration* collisionConfiguration)
     :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
 }
+#endif
 
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
                                                                btScalar fixedTimeStep, SubStepCallback onSubStep) {
@@ -135,29 +146,74 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
             }
         }
     } else  {
-        //iterate over all active rigid bodies
-        // TODO? if this becomes a performance bottleneck we could derive our own SimulationIslandManager
-        // that remembers a list of objects deactivated last step
+        // only visit bodies that were awake at the end of the last substep (see updateActivationState())
+        // rather than walking every non-static body: resting objects cost nothing here
         _activeStates.clear();
         _deactivatedStates.clear();
-        for (int i=0;i<m_nonStaticRigidBodies.size();i++) {
-            btRigidBody* body = m_nonStaticRigidBodies[i];
+        for (int i = 0; i < _activeBodies.size(); ++i) {
+            btRigidBody* body = _activeBodies[i];
             ObjectMotionState* motionState = static_cast<ObjectMotionState*>(body->getMotionState());
-            if (motionState) {
-                if (body->isActive()) {
-                    synchronizeMotionState(body);
-                    _changedMotionStates.push_back(motionState);
-                    _activeStates.insert(motionState);
-                } else if (_lastActiveStates.find(motionState) != _lastActiveStates.end()) {
-                    // this object was active last frame but is no longer
-                    _deactivatedStates.push_back(motionState);
-                }
+            if (motionState && body->isActive()) {
+                synchronizeMotionState(body);
+                _changedMotionStates.push_back(motionState);
+                _activeStates.insert(motionState);
+            }
+        }
+        // anything that was active last frame but is no longer has fallen asleep
+        for (ObjectMotionState* motionState : _lastActiveStates) {
+            if (!_activeStates.contains(motionState)) {
+                _deactivatedStates.push_back(motionState);
             }
         }
     }
     _activeStates.swap(_lastActiveStates);
 }
 
+void ThreadSafeDynamicsWorld::updateActivationState(btScalar timeStep) {
+    BT_PROFILE("updateActivationState");
+    _activeBodies.resize(0);
+    for (int i = 0; i < m_nonStaticRigidBodies.size(); i++) {
+        btRigidBody* body = m_nonStaticRigidBodies[i];
+        if (body) {
+            body->updateDeactivation(timeStep);
+
+            if (body->wantsSleeping()) {
+                if (body->isStaticOrKinematicObject()) {
+                    body->setActivationState(ISLAND_SLEEPING);
+                } else {
+                    if (body->getActivationState() == ACTIVE_TAG) {
+                        body->setActivationState(WANTS_DEACTIVATION);
+                    }
+                    if (body->getActivationState() == ISLAND_SLEEPING) {
+                        body->setAngularVelocity(btVector3(0, 0, 0));
+                        body->setLinearVelocity(btVector3(0, 0, 0));
+                    }
+                }
+            } else {
+                if (body->getActivationState() != DISABLE_DEACTIVATION) {
+                    body->setActivationState(ACTIVE_TAG);
+                }
+            }
+
+            // islands were put to sleep (or woken) earlier in this substep so isActive() is final here
+            if (body->isActive()) {
+                _activeBodies.push_back(body);
+            }
+        }
+    }
+}
+
+void ThreadSafeDynamicsWorld::removeRigidBody(btRigidBody* body) {
+    // forget the body so we never touch it (or its MotionState) again after it leaves the world
+    _activeBodies.remove(body);
+    ObjectMotionState* motionState = static_cast<ObjectMotionState*>(body->getMotionState());
+    if (motionState) {
+        _activeStates.remove(motionState);
+        _lastActiveStates.remove(motionState);
+    }
+    DynamicsWorldBase::removeRigidBody(body);
+}
+
 void ThreadSafeDynamicsWorld::saveKinematicState(btScalar timeStep) {
     DETAILED_PROFILE_RANGE(simulation_physics, "saveKinematicState");
     BT_PROFILE("saveKinematicState");
@@ -20,6 +20,19 @@
 
 #include <BulletDynamics/Dynamics/btRigidBody.h>
 #include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
+#include <LinearMath/btThreads.h>
+
+#if BT_THREADSAFE
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+
+// when Bullet is built thread-safe the world runs its narrowphase, island solving and integration as parallel loops
+// on whatever btITaskScheduler is installed (see PhysicsTaskScheduler)
+using DynamicsWorldBase = btDiscreteDynamicsWorldMt;
+#else
+using DynamicsWorldBase = btDiscreteDynamicsWorld;
+#endif
 
 #include "ObjectMotionState.h"
 
@@ -27,15 +40,24 @@
 
 using SubStepCallback = std::function<void()>;
 
-ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorld {
+ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public DynamicsWorldBase {
 public:
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
+#if BT_THREADSAFE
+    ThreadSafeDynamicsWorld(
+            btDispatcher* dispatcher,
+            btBroadphaseInterface* pairCache,
+            btConstraintSolverPoolMt* constraintSolverPool,
+            btConstraintSolver* constraintSolverMt,
+            btCollisionConfiguration* collisionConfiguration);
+#else
     ThreadSafeDynamicsWorld(
             btDispatcher* dispatcher,
             btBroadphaseInterface* pairCache,
             btConstraintSolver* constraintSolver,
             btCollisionConfiguration* collisionConfiguration);
+#endif
 
     int getNumSubsteps() const { return _numSubsteps; }
     int stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps = 1,
@@ -43,6 +65,7 @@ public:
                                           SubStepCallback onSubStep = []() { });
     virtual void synchronizeMotionStates() override;
     virtual void saveKinematicState(btScalar timeStep) override;
+    virtual void removeRigidBody(btRigidBody* body) override;
 
     // btDiscreteDynamicsWorld::m_localTime is the portion of real-time that has not yet been simulated
     // but is used for MotionState::setWorldTransform() extrapolation (a feature that Bullet uses to provide
@@ -53,8 +76,18 @@ public:
     const VectorOfMotionStates& getDeactivatedMotionStates() const { return _deactivatedStates; }
 
     void addChangedMotionState(ObjectMotionState* motionState) { _changedMotionStates.push_back(motionState); }
+
+    // bodies in awake islands as of the end of the last substep, and the non-static remainder that is asleep
+    int getNumActiveBodies() const { return _activeBodies.size(); }
+    int getNumSleepingBodies() const { return m_nonStaticRigidBodies.size() - _activeBodies.size(); }
+
     virtual void debugDrawObject(const btTransform& worldTransform, const btCollisionShape* shape, const btVector3& color) override;
 
+protected:
+    // same as btDiscreteDynamicsWorld::updateActivationState() but also collects the bodies that remain awake
+    // so synchronizeMotionStates() only has to visit those rather than every non-static body
+    virtual void updateActivationState(btScalar timeStep) override;
+
 private:
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
@@ -65,6 +98,7 @@ private:
     VectorOfMotionStates _deactivatedStates;
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
+    btAlignedObjectArray<btRigidBody*> _activeBodies;
     int _numSubsteps { 0 };
 };
 
@@ -47,6 +47,7 @@ public:
     virtual void skipFrame() = 0;
     virtual void addFrame(FrameConstPointer) = 0;
 
+    // writes the chunked, compressed format, see impl/ChunkedClip.h
     bool write(QIODevice& output);
 
     static Pointer fromFile(const QString& filePath);
@@ -7,13 +7,12 @@
 //
 
 #include "Deck.h"
- 
-#include <QtCore/QThread>
 
 #include <NumericalConstants.h>
 #include <SharedUtil.h>
 
 #include "Clip.h"
+#include "DeckScheduler.h"
 #include "Frame.h"
 #include "Logging.h"
 #include "impl/OffsetClip.h"
@@ -23,6 +22,12 @@ using namespace recording;
 Deck::Deck(QObject* parent) 
     : QObject(parent) {}
 
+Deck::~Deck() {
+    if (!_pause) {
+        DeckScheduler::getInstance().removeDeck(this);
+    }
+}
+
 void Deck::queueClip(ClipPointer clip, float timeOffset) {
     Locker lock(_mutex);
 
@@ -51,7 +56,7 @@ void Deck::play() {
         _pause = false;
         _startEpoch = Frame::epochForFrameTime(_position);
         emit playbackStateChanged();
-        processFrames();
+        DeckScheduler::getInstance().addDeck(this);
     }
 }
 
@@ -59,11 +64,12 @@ void Deck::pause() {
     Locker lock(_mutex);
     if (!_pause) {
         _pause = true;
+        DeckScheduler::getInstance().removeDeck(this);
         emit playbackStateChanged();
     }
 }
 
-Clip::Pointer Deck::getNextClip() {
+Clip::Pointer Deck::getNextClip() const {
     Clip::Pointer result;
     auto soonestFramePosition = Frame::INVALID_TIME;
     for (const auto& clip : _clips) {
@@ -89,8 +95,7 @@ void Deck::seek(float position) {
     }
 
     if (!_pause) {
-        // FIXME what if the timer is already running?
-        processFrames();
+        DeckScheduler::getInstance().wake();
     }
 }
 
@@ -110,12 +115,20 @@ void Deck::setVolume(float volume) {
 static const Frame::Time MIN_FRAME_WAIT_INTERVAL = Frame::secondsToFrameTime(0.001f);
 static const Frame::Time MAX_FRAME_PROCESSING_TIME = Frame::secondsToFrameTime(0.004f);
 
-void Deck::processFrames() {
-    if (qApp->thread() != QThread::currentThread()) {
-        qWarning() << "Processing frames must only happen on the main thread.";
-        return;
-    }
+void Deck::setFrameHandler(FrameType type, Frame::Handler handler) {
     Locker lock(_mutex);
+    _frameHandlers[type] = handler;
+}
+
+void Deck::clearFrameHandler(FrameType type) {
+    Locker lock(_mutex);
+    _frameHandlers.remove(type);
+}
+
+void Deck::collectFrames() {
+    Locker lock(_mutex);
+    _dueFrames.clear();
+    _reachedEnd = false;
     if (_pause) {
         return;
     }
@@ -126,7 +139,6 @@ void Deck::processFrames() {
     // FIXME add code to start dropping frames if we fall behind.
     // Alternatively, add code to cache frames here and then process only the last frame of a given type
     // ... the latter will work for Avatar, but not well for audio I suspect.
-    bool overLimit = false;
     for (nextClip = getNextClip(); nextClip; nextClip = getNextClip()) {
         auto currentPosition = Frame::frameTimeFromEpoch(_startEpoch);
         if ((currentPosition - startingPosition) >= MAX_FRAME_PROCESSING_TIME) {
@@ -136,7 +148,6 @@ void Deck::processFrames() {
             qCDebug(recordingLog) << "Current:  " << startingPosition;
             qCDebug(recordingLog) << "Trigger:  " << triggerPosition;
 #endif
-            overLimit = true;
             break;
         }
 
@@ -145,11 +156,36 @@ void Deck::processFrames() {
         if (framePosition > triggerPosition) {
             break;
         }
-        // Handle the frame and advance the clip
-        Frame::handleFrame(nextClip->nextFrame());
+        // Take the frame and advance the clip
+        _dueFrames.push_back(nextClip->nextFrame());
     }
 
-    if (!nextClip) {
+    _reachedEnd = !nextClip;
+    if (!_reachedEnd) {
+        _position = Frame::frameTimeFromEpoch(_startEpoch);
+    }
+}
+
+void Deck::dispatchFrames() {
+    Locker lock(_mutex);
+    // another deck's frame handlers may have paused us since the frames were collected
+    if (_pause) {
+        _dueFrames.clear();
+        return;
+    }
+
+    for (const auto& frame : _dueFrames) {
+        auto handler = _frameHandlers.find(frame->type);
+        if (handler != _frameHandlers.end()) {
+            (*handler)(frame);
+        } else {
+            Frame::handleFrame(frame);
+        }
+    }
+    _dueFrames.clear();
+
+    if (_reachedEnd) {
+        _reachedEnd = false;
         // No more frames available, so handle the end of playback
         if (_loop) {
             // If we have looping enabled, start the playback over
@@ -161,30 +197,25 @@ void Deck::processFrames() {
             // otherwise stop playback
             stop();
         }
-        return;
-    } 
-
-    // If we have more clip frames available, set the timer for the next one
-    _position = Frame::frameTimeFromEpoch(_startEpoch);
-    int nextInterval = 1;
-    if (!overLimit) {
-        auto nextFrameTime = nextClip->positionFrameTime();
-        nextInterval = (int)Frame::frameTimeToMilliseconds(nextFrameTime - _position);
-        if (nextInterval < 0) {
-            qCWarning(recordingLog) << "Unexpected nextInterval < 0 nextFrameTime:" << nextFrameTime 
-                                    << "_position:" << _position << "-- setting nextInterval to 0";
-            nextInterval = 0;
-        }
+    }
+}
 
-#ifdef WANT_RECORDING_DEBUG
-        qCDebug(recordingLog) << "Now " << _position;
-        qCDebug(recordingLog) << "Next frame time " << nextInterval;
-#endif
+int Deck::getNextFrameInterval() const {
+    Locker lock(_mutex);
+    if (_pause) {
+        return -1;
     }
-#ifdef WANT_RECORDING_DEBUG
-    qCDebug(recordingLog) << "Setting timer for next processing " << nextInterval;
-#endif
-    _timer.singleShot(nextInterval, this, &Deck::processFrames);
+
+    auto nextClip = getNextClip();
+    if (!nextClip) {
+        return 0;
+    }
+    auto currentPosition = Frame::frameTimeFromEpoch(_startEpoch);
+    auto nextFrameTime = nextClip->positionFrameTime();
+    if (nextFrameTime <= currentPosition) {
+        return 0;
+    }
+    return (int)Frame::frameTimeToMilliseconds(nextFrameTime - currentPosition);
 }
 
 void Deck::removeClip(const ClipConstPointer& clip) {
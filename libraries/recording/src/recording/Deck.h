@@ -13,10 +13,11 @@
 #include <utility>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
 #include <QtCore/QList>
+#include <QtCore/QMap>
 
 #include <DependencyManager.h>
 
@@ -33,6 +34,7 @@ public:
     using Pointer = std::shared_ptr<Deck>;
 
     Deck(QObject* parent = nullptr);
+    ~Deck();
 
     // Place a clip on the deck for recording or playback
     void queueClip(ClipPointer clip, float timeOffset = 0.0f);
@@ -60,20 +62,34 @@ public:
     float getVolume() const { return _volume; }
     void setVolume(float volume);
 
+    // Frames of this type go to the handler instead of the one registered with Frame, so that
+    // each of many decks can drive its own avatar
+    void setFrameHandler(FrameType type, Frame::Handler handler);
+    void clearFrameHandler(FrameType type);
+
 signals:
     void playbackStateChanged();
     void looped();
 
 private:
+    friend class DeckScheduler;
     using Mutex = std::recursive_mutex;
     using Locker = std::unique_lock<Mutex>;
 
-    ClipPointer getNextClip();
-    void processFrames();
+    ClipPointer getNextClip() const;
+
+    // Playback is driven by the DeckScheduler: it collects the frames that are due from every playing
+    // deck, possibly on worker threads, then dispatches them on the main thread
+    void collectFrames();
+    void dispatchFrames();
+    // milliseconds until the next frame is due, -1 if not playing
+    int getNextFrameInterval() const;
 
     mutable Mutex _mutex;
-    QTimer _timer;
     ClipList _clips;
+    std::vector<FrameConstPointer> _dueFrames;
+    bool _reachedEnd { false };
+    QMap<FrameType, Frame::Handler> _frameHandlers;
     quint64 _startEpoch { 0 };
     Frame::Time _position { 0 };
     bool _pause { true };
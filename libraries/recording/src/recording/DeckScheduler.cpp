@@ -0,0 +1,113 @@
+//
+//  DeckScheduler.cpp
+//  libraries/recording/src/recording
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DeckScheduler.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+#include "Deck.h"
+#include "Logging.h"
+
+using namespace recording;
+
+// the longest we sleep between ticks while any deck is playing
+static const int MAX_TICK_INTERVAL_MSECS = 1000;
+
+DeckScheduler& DeckScheduler::getInstance() {
+    static DeckScheduler instance;
+    return instance;
+}
+
+DeckScheduler::DeckScheduler() {
+    if (qApp) {
+        moveToThread(qApp->thread());
+    }
+    _timer.setSingleShot(true);
+    _timer.setTimerType(Qt::PreciseTimer);
+    _timer.moveToThread(thread());
+    connect(&_timer, &QTimer::timeout, this, &DeckScheduler::tick);
+}
+
+void DeckScheduler::addDeck(Deck* deck) {
+    {
+        Locker lock(_mutex);
+        if (std::find(_decks.begin(), _decks.end(), deck) == _decks.end()) {
+            _decks.push_back(deck);
+        }
+    }
+    wake();
+}
+
+void DeckScheduler::removeDeck(Deck* deck) {
+    Locker lock(_mutex);
+    _decks.erase(std::remove(_decks.begin(), _decks.end(), deck), _decks.end());
+}
+
+size_t DeckScheduler::getPlayingDeckCount() const {
+    Locker lock(_mutex);
+    return _decks.size();
+}
+
+void DeckScheduler::wake() {
+    QMetaObject::invokeMethod(&_timer, "start", Q_ARG(int, 0));
+}
+
+void DeckScheduler::tick() {
+    if (QThread::currentThread() != qApp->thread()) {
+        qCWarning(recordingLog) << "Processing frames must only happen on the main thread.";
+        return;
+    }
+
+    // decks can be stopped or deleted by the frame handlers of the ones before them
+    std::vector<QPointer<Deck>> decks;
+    {
+        Locker lock(_mutex);
+        decks.assign(_decks.begin(), _decks.end());
+    }
+    if (decks.empty()) {
+        return;
+    }
+
+    auto collect = [](const QPointer<Deck>& deck) {
+        if (deck) {
+            deck->collectFrames();
+        }
+    };
+    if (decks.size() >= MIN_PARALLEL_DECKS && QThreadPool::globalInstance()->maxThreadCount() > 1) {
+        QtConcurrent::blockingMap(decks, collect);
+    } else {
+        std::for_each(decks.begin(), decks.end(), collect);
+    }
+
+    for (const auto& deck : decks) {
+        if (deck) {
+            deck->dispatchFrames();
+        }
+    }
+
+    // decks that were paused return no interval, and ones that started since will have woken us anyway
+    int nextInterval = -1;
+    for (const auto& deck : decks) {
+        int deckInterval = deck ? deck->getNextFrameInterval() : -1;
+        if (deckInterval >= 0 && (nextInterval < 0 || deckInterval < nextInterval)) {
+            nextInterval = deckInterval;
+        }
+    }
+    if (nextInterval >= 0) {
+        _timer.start(std::min(nextInterval, MAX_TICK_INTERVAL_MSECS));
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  DeckScheduler.h
+//  libraries/recording/src/recording
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_Recording_DeckScheduler_h
+#define hifi_Recording_DeckScheduler_h
+
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include "Forward.h"
+
+namespace recording {
+
+// Plays every deck in the process off one timer.  Each tick pulls the frames that have come due out of all
+// the playing decks' clips, spread over the global thread pool when there are enough decks to be worth it,
+// then hands them to their handlers on the main thread, deck by deck.
+class DeckScheduler : public QObject {
+    Q_OBJECT
+public:
+    static DeckScheduler& getInstance();
+
+    void addDeck(Deck* deck);
+    void removeDeck(Deck* deck);
+
+    // run a tick as soon as possible, after a deck started or moved
+    void wake();
+
+    size_t getPlayingDeckCount() const;
+
+    // fewer playing decks than this are collected on the main thread
+    static const size_t MIN_PARALLEL_DECKS = 16;
+
+private slots:
+    void tick();
+
+private:
+    using Mutex = std::mutex;
+    using Locker = std::unique_lock<Mutex>;
+
+    DeckScheduler();
+
+    mutable Mutex _mutex;
+    std::vector<Deck*> _decks;
+    QTimer _timer;
+};
+
+}
+
+#endif
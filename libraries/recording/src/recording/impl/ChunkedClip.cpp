@@ -0,0 +1,502 @@
+//
+//  ChunkedClip.cpp
+//  libraries/recording/src/recording/impl
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ChunkedClip.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QCborArray>
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#include <QtCore/QHash>
+#include <QtCore/QIODevice>
+#include <QtCore/QJsonObject>
+
+#include "../Frame.h"
+#include "../Logging.h"
+#include "PointerClip.h"
+
+using namespace recording;
+
+static const char CHUNKED_MAGIC[4] = { 'H', 'F', 'R', 'C' };
+static const quint32 CHUNKED_VERSION = 1;
+static const size_t PREAMBLE_SIZE = sizeof(CHUNKED_MAGIC) + sizeof(quint32) + sizeof(quint32);
+static const size_t TRAILER_SIZE = sizeof(quint64) + sizeof(quint32) + sizeof(CHUNKED_MAGIC);
+static const QString SIGNIFICANT_BITS_KEY = QStringLiteral("significantBits");
+
+// per frame, inside a decompressed chunk: type, time, flags, size, data
+static const size_t RECORD_HEADER_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(quint8) + sizeof(quint32);
+static const quint8 RECORD_FLAG_PACKED = 0x1;  // CBOR with single precision values, expand back to doubles
+static const quint8 RECORD_FLAG_DELTA = 0x2;   // XOR'd against the previous frame of the same type
+
+// fields of each chunk's entry in the index
+enum ChunkIndexField {
+    INDEX_FIRST_TIME = 0,
+    INDEX_LAST_TIME,
+    INDEX_FILE_OFFSET,
+    INDEX_SIZE,
+    INDEX_TYPE_COUNTS
+};
+
+const Frame::Time ChunkedClip::CHUNK_DURATION = Frame::secondsToFrameTime(1.0f);
+
+static float roundMantissa(float value, int significantBits) {
+    const int FLOAT_MANTISSA_BITS = 23;
+    if (significantBits >= FLOAT_MANTISSA_BITS || !std::isfinite(value)) {
+        return value;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int droppedBits = FLOAT_MANTISSA_BITS - std::max(significantBits, 0);
+    bits = (bits + (1u << (droppedBits - 1))) & ~((1u << droppedBits) - 1);
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return std::isfinite(result) ? result : value;
+}
+
+static QCborValue packValue(const QCborValue& value, int significantBits) {
+    if (value.isDouble()) {
+        double number = value.toDouble();
+        float single = (float)number;
+        if ((double)single != number) {
+            // needs double precision, leave it alone
+            return value;
+        }
+        return QCborValue((double)roundMantissa(single, significantBits));
+    }
+    if (value.isArray()) {
+        QCborArray result;
+        for (const auto& element : value.toArray()) {
+            result.append(packValue(element, significantBits));
+        }
+        return result;
+    }
+    if (value.isMap()) {
+        QCborMap map = value.toMap();
+        QCborMap result;
+        for (auto itr = map.constBegin(); itr != map.constEnd(); ++itr) {
+            result.insert(itr.key(), packValue(itr.value(), significantBits));
+        }
+        return result;
+    }
+    return value;
+}
+
+// Frames that are CBOR documents (avatar frames are) get their single precision values stored as floats rather
+// than doubles, with the mantissa rounded to the bits asked for.  Anything else, like audio, is stored as is.
+static bool packFrameData(const QByteArray& data, int significantBits, QByteArray& packed) {
+    if (data.isEmpty()) {
+        return false;
+    }
+
+    QCborParserError error;
+    QCborValue value = QCborValue::fromCbor(data, &error);
+    if (error.error != QCborError::NoError || !(value.isMap() || value.isArray()) || value.toCbor() != data) {
+        return false;
+    }
+
+    QCborValue quantized = packValue(value, significantBits);
+    packed = quantized.toCbor(QCborValue::UseFloat);
+
+    // only keep the packed form if the reader will expand it back to exactly what we meant
+    QCborValue unpacked = QCborValue::fromCbor(packed);
+    return unpacked.toCbor() == quantized.toCbor();
+}
+
+static void xorBytes(QByteArray& target, const QByteArray& reference) {
+    char* targetData = target.data();
+    const char* referenceData = reference.constData();
+    for (int i = 0; i < target.size(); ++i) {
+        targetData[i] ^= referenceData[i];
+    }
+}
+
+static bool writeBytes(QIODevice& output, const char* data, qint64 size, quint64& written) {
+    if (output.write(data, size) != size) {
+        return false;
+    }
+    written += size;
+    return true;
+}
+
+template <typename T>
+static void appendValue(QByteArray& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static T readValue(const uchar*& current) {
+    T result;
+    memcpy(&result, current, sizeof(T));
+    current += sizeof(T);
+    return result;
+}
+
+bool ChunkedClip::isChunked(const uchar* data, size_t size) {
+    return data && size >= PREAMBLE_SIZE + TRAILER_SIZE && 0 == memcmp(data, CHUNKED_MAGIC, sizeof(CHUNKED_MAGIC));
+}
+
+bool ChunkedClip::write(QIODevice& output, Clip& clip, int significantBits) {
+    auto frameTypes = Frame::getFrameTypes();
+    auto frameTypeNames = Frame::getFrameTypeNames();
+    QJsonObject frameTypeObj;
+    for (const auto& frameTypeName : frameTypes.keys()) {
+        frameTypeObj[frameTypeName] = frameTypes[frameTypeName];
+    }
+
+    QJsonObject rootObject;
+    rootObject.insert(FRAME_TYPE_MAP, frameTypeObj);
+    rootObject.insert(SIGNIFICANT_BITS_KEY, significantBits);
+    QByteArray headerData = QCborValue::fromVariant(rootObject).toCbor();
+
+    quint64 written = 0;
+    quint32 headerSize = headerData.size();
+    if (!writeBytes(output, CHUNKED_MAGIC, sizeof(CHUNKED_MAGIC), written) ||
+        !writeBytes(output, (const char*)&CHUNKED_VERSION, sizeof(CHUNKED_VERSION), written) ||
+        !writeBytes(output, (const char*)&headerSize, sizeof(headerSize), written) ||
+        !writeBytes(output, headerData.constData(), headerSize, written)) {
+        return false;
+    }
+
+    QCborArray index;
+    QByteArray chunk;
+    Frame::Time chunkFirstTime { 0 };
+    Frame::Time chunkLastTime { 0 };
+    QCborMap chunkTypeCounts;
+    QHash<FrameType, QByteArray> previousFrames;
+
+    auto flushChunk = [&]() -> bool {
+        if (chunk.isEmpty()) {
+            return true;
+        }
+        QByteArray compressed = qCompress(chunk);
+        QCborArray entry;
+        entry.append((qint64)chunkFirstTime);
+        entry.append((qint64)chunkLastTime);
+        entry.append((qint64)written);
+        entry.append((qint64)compressed.size());
+        entry.append(chunkTypeCounts);
+        index.append(entry);
+
+        chunk.clear();
+        chunkTypeCounts = QCborMap();
+        previousFrames.clear();
+        return writeBytes(output, compressed.constData(), compressed.size(), written);
+    };
+
+    clip.seek(0);
+    for (auto frame = clip.nextFrame(); frame; frame = clip.nextFrame()) {
+        // a reader could never tell what these were
+        if (frame->type == Frame::TYPE_INVALID || !frameTypeNames.contains(frame->type)) {
+            continue;
+        }
+
+        if (!chunk.isEmpty() &&
+            (frame->timeOffset - chunkFirstTime >= CHUNK_DURATION || chunk.size() >= MAX_CHUNK_SIZE)) {
+            if (!flushChunk()) {
+                return false;
+            }
+        }
+        if (chunk.isEmpty()) {
+            chunkFirstTime = frame->timeOffset;
+        }
+        chunkLastTime = frame->timeOffset;
+        chunkTypeCounts[(qint64)frame->type] = chunkTypeCounts.value((qint64)frame->type).toInteger() + 1;
+
+        quint8 flags = 0;
+        QByteArray data;
+        if (packFrameData(frame->data, significantBits, data)) {
+            flags |= RECORD_FLAG_PACKED;
+            QByteArray packed = data;
+            auto previous = previousFrames.find(frame->type);
+            if (previous != previousFrames.end() && previous.value().size() == data.size()) {
+                flags |= RECORD_FLAG_DELTA;
+                xorBytes(data, previous.value());
+            }
+            previousFrames[frame->type] = packed;
+        } else {
+            data = frame->data;
+        }
+
+        appendValue(chunk, frame->type);
+        appendValue(chunk, frame->timeOffset);
+        appendValue(chunk, flags);
+        appendValue(chunk, (quint32)data.size());
+        chunk.append(data);
+    }
+    if (!flushChunk()) {
+        return false;
+    }
+
+    QByteArray indexData = QCborValue(index).toCbor();
+    quint64 indexOffset = written;
+    quint32 indexSize = indexData.size();
+    return writeBytes(output, indexData.constData(), indexSize, written) &&
+        writeBytes(output, (const char*)&indexOffset, sizeof(indexOffset), written) &&
+        writeBytes(output, (const char*)&indexSize, sizeof(indexSize), written) &&
+        writeBytes(output, CHUNKED_MAGIC, sizeof(CHUNKED_MAGIC), written);
+}
+
+void ChunkedClip::reset() {
+    _header = QJsonDocument();
+    _data = nullptr;
+    _size = 0;
+    _translationMap.clear();
+    _chunks.clear();
+    _frameCount = 0;
+    _lastFrameTime = 0;
+    _frameIndex = 0;
+    _decodedChunk = SIZE_MAX;
+    _decodedFrames.clear();
+}
+
+bool ChunkedClip::init(const uchar* data, size_t size) {
+    Locker lock(_mutex);
+    reset();
+
+    if (!isChunked(data, size)) {
+        qCWarning(recordingLog) << "Not a chunked recording";
+        return false;
+    }
+
+    const uchar* current = data + sizeof(CHUNKED_MAGIC);
+    auto version = readValue<quint32>(current);
+    if (version != CHUNKED_VERSION) {
+        qCWarning(recordingLog) << "Unsupported chunked recording version" << version;
+        return false;
+    }
+
+    auto headerSize = readValue<quint32>(current);
+    if (headerSize > size - PREAMBLE_SIZE - TRAILER_SIZE) {
+        qCWarning(recordingLog) << "Truncated chunked recording header";
+        return false;
+    }
+    QByteArray headerData = QByteArray::fromRawData((const char*)current, headerSize);
+    _header = QJsonDocument::fromVariant(QCborValue::fromCbor(headerData).toVariant());
+    _translationMap = parseTranslationMap(_header);
+    if (_translationMap.empty()) {
+        qCWarning(recordingLog) << "Header missing frame type map, invalid file";
+        reset();
+        return false;
+    }
+
+    current = data + size - TRAILER_SIZE;
+    auto indexOffset = readValue<quint64>(current);
+    auto indexSize = readValue<quint32>(current);
+    if (0 != memcmp(current, CHUNKED_MAGIC, sizeof(CHUNKED_MAGIC)) ||
+        indexOffset < PREAMBLE_SIZE + headerSize || indexOffset + indexSize > size - TRAILER_SIZE) {
+        qCWarning(recordingLog) << "Missing chunk index, truncated recording?";
+        reset();
+        return false;
+    }
+
+    QByteArray indexData = QByteArray::fromRawData((const char*)data + indexOffset, indexSize);
+    QCborArray index = QCborValue::fromCbor(indexData).toArray();
+    _chunks.reserve(index.size());
+    for (const auto& entryValue : index) {
+        QCborArray entry = entryValue.toArray();
+        Chunk chunk;
+        chunk.firstTime = (Frame::Time)entry[INDEX_FIRST_TIME].toInteger();
+        chunk.lastTime = (Frame::Time)entry[INDEX_LAST_TIME].toInteger();
+        chunk.fileOffset = (quint64)entry[INDEX_FILE_OFFSET].toInteger();
+        chunk.size = (quint32)entry[INDEX_SIZE].toInteger();
+        chunk.firstFrame = _frameCount;
+        chunk.frameCount = 0;
+        if (chunk.fileOffset + chunk.size > indexOffset) {
+            qCWarning(recordingLog) << "Chunk outside of recording, invalid file";
+            reset();
+            return false;
+        }
+
+        QCborMap typeCounts = entry[INDEX_TYPE_COUNTS].toMap();
+        for (auto itr = typeCounts.constBegin(); itr != typeCounts.constEnd(); ++itr) {
+            if (_translationMap.contains((FrameType)itr.key().toInteger())) {
+                chunk.frameCount += (size_t)itr.value().toInteger();
+            }
+        }
+
+        // skip chunks holding nothing we can play
+        if (chunk.frameCount > 0) {
+            _frameCount += chunk.frameCount;
+            _chunks.push_back(chunk);
+        }
+    }
+
+    _data = data;
+    _size = size;
+
+    if (!_chunks.empty()) {
+        const auto& lastChunkFrames = decodeChunk(_chunks.size() - 1);
+        if (lastChunkFrames.size() != _chunks.back().frameCount) {
+            qCWarning(recordingLog) << "Corrupt final chunk, invalid file";
+            reset();
+            return false;
+        }
+        _lastFrameTime = lastChunkFrames.back()->timeOffset;
+    }
+
+    qCDebug(recordingLog) << "Indexed" << _frameCount << "frames in" << _chunks.size() << "chunks";
+    return true;
+}
+
+size_t ChunkedClip::findChunk(size_t frameIndex) const {
+    auto itr = std::upper_bound(_chunks.begin(), _chunks.end(), frameIndex, [](size_t index, const Chunk& chunk) {
+        return index < chunk.firstFrame;
+    });
+    return (itr - _chunks.begin()) - 1;
+}
+
+// Internal only function, needs no locking
+const std::vector<FrameConstPointer>& ChunkedClip::decodeChunk(size_t chunkIndex) const {
+    if (chunkIndex == _decodedChunk) {
+        return _decodedFrames;
+    }
+
+    _decodedChunk = chunkIndex;
+    _decodedFrames.clear();
+
+    const auto& chunk = _chunks[chunkIndex];
+    _decodedFrames.reserve(chunk.frameCount);
+    QByteArray chunkData = qUncompress(QByteArray::fromRawData((const char*)_data + chunk.fileOffset, chunk.size));
+
+    QHash<FrameType, QByteArray> previousFrames;
+    const uchar* current = (const uchar*)chunkData.constData();
+    const uchar* end = current + chunkData.size();
+    while ((size_t)(end - current) >= RECORD_HEADER_SIZE) {
+        auto type = readValue<FrameType>(current);
+        auto timeOffset = readValue<Frame::Time>(current);
+        auto flags = readValue<quint8>(current);
+        auto size = readValue<quint32>(current);
+        if ((size_t)(end - current) < size) {
+            qCWarning(recordingLog) << "Truncated frame in chunk" << chunkIndex;
+            break;
+        }
+
+        QByteArray data((const char*)current, size);
+        current += size;
+        if (flags & RECORD_FLAG_DELTA) {
+            auto previous = previousFrames.find(type);
+            if (previous == previousFrames.end() || previous.value().size() != data.size()) {
+                qCWarning(recordingLog) << "Delta frame without a key frame in chunk" << chunkIndex;
+                break;
+            }
+            xorBytes(data, previous.value());
+        }
+        if (flags & RECORD_FLAG_PACKED) {
+            previousFrames[type] = data;
+            QCborValue value = QCborValue::fromCbor(data);
+            data = value.toCbor();
+        }
+
+        auto translated = _translationMap.find(type);
+        if (translated == _translationMap.end()) {
+            continue;
+        }
+        auto frame = std::make_shared<Frame>();
+        frame->type = translated.value();
+        frame->timeOffset = timeOffset;
+        frame->data = data;
+        _decodedFrames.push_back(frame);
+    }
+
+    return _decodedFrames;
+}
+
+// Internal only function, needs no locking
+FrameConstPointer ChunkedClip::readFrame(size_t frameIndex) const {
+    FrameConstPointer result;
+    if (frameIndex < _frameCount) {
+        auto chunkIndex = findChunk(frameIndex);
+        const auto& frames = decodeChunk(chunkIndex);
+        auto localIndex = frameIndex - _chunks[chunkIndex].firstFrame;
+        if (localIndex < frames.size()) {
+            result = frames[localIndex];
+        }
+    }
+    return result;
+}
+
+Clip::Pointer ChunkedClip::duplicate() const {
+    auto result = newClip();
+    Locker lock(_mutex);
+    for (size_t i = 0; i < _chunks.size(); ++i) {
+        for (const auto& frame : decodeChunk(i)) {
+            result->addFrame(frame);
+        }
+    }
+    return result;
+}
+
+float ChunkedClip::duration() const {
+    Locker lock(_mutex);
+    return Frame::frameTimeToSeconds(_lastFrameTime);
+}
+
+size_t ChunkedClip::frameCount() const {
+    Locker lock(_mutex);
+    return _frameCount;
+}
+
+void ChunkedClip::seekFrameTime(Frame::Time offset) {
+    Locker lock(_mutex);
+    // the first chunk that runs to at least the offset holds the frame, unless only unreadable frames got there
+    auto itr = std::lower_bound(_chunks.begin(), _chunks.end(), offset, [](const Chunk& chunk, Frame::Time time) {
+        return chunk.lastTime < time;
+    });
+    if (itr == _chunks.end()) {
+        _frameIndex = _frameCount;
+        return;
+    }
+
+    const auto& frames = decodeChunk(itr - _chunks.begin());
+    auto frameItr = std::lower_bound(frames.begin(), frames.end(), offset,
+        [](const FrameConstPointer& frame, Frame::Time time) {
+            return frame->timeOffset < time;
+        }
+    );
+    _frameIndex = itr->firstFrame + (frameItr - frames.begin());
+}
+
+Frame::Time ChunkedClip::positionFrameTime() const {
+    Locker lock(_mutex);
+    Frame::Time result = Frame::INVALID_TIME;
+    auto frame = readFrame(_frameIndex);
+    if (frame) {
+        result = frame->timeOffset;
+    }
+    return result;
+}
+
+FrameConstPointer ChunkedClip::peekFrame() const {
+    Locker lock(_mutex);
+    return readFrame(_frameIndex);
+}
+
+FrameConstPointer ChunkedClip::nextFrame() {
+    Locker lock(_mutex);
+    FrameConstPointer result;
+    if (_frameIndex < _frameCount) {
+        result = readFrame(_frameIndex++);
+    }
+    return result;
+}
+
+void ChunkedClip::skipFrame() {
+    Locker lock(_mutex);
+    if (_frameIndex < _frameCount) {
+        ++_frameIndex;
+    }
+}
+
+void ChunkedClip::addFrame(FrameConstPointer) {
+    throw std::runtime_error("Chunked clips are read only, use duplicate to create a read/write clip");
+}
@@ -0,0 +1,102 @@
+//
+//  ChunkedClip.h
+//  libraries/recording/src/recording/impl
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_Recording_Impl_ChunkedClip_h
+#define hifi_Recording_Impl_ChunkedClip_h
+
+#include "../Clip.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMap>
+#include <QtCore/QUuid>
+
+namespace recording {
+
+// A read only clip over a recording in the chunked format:
+//
+//   magic, version, header size, CBOR header
+//   chunks, each a qCompress'd run of about a second of frames
+//   CBOR index of the chunks
+//   index offset, index size, magic
+//
+// The first CBOR frame of each type in a chunk is stored whole, the ones that follow it XOR'd against the
+// frame before them, so every chunk decodes on its own and seeking only touches the index and one chunk.
+// Only the chunk being played is kept decoded.
+class ChunkedClip : public Clip {
+public:
+    using Pointer = std::shared_ptr<ChunkedClip>;
+
+    ChunkedClip() {};
+    ChunkedClip(const uchar* data, size_t size) { init(data, size); }
+
+    static bool isChunked(const uchar* data, size_t size);
+    static bool write(QIODevice& output, Clip& clip, int significantBits = DEFAULT_SIGNIFICANT_BITS);
+
+    bool init(const uchar* data, size_t size);
+    const QJsonDocument& getHeader() const { return _header; }
+
+    virtual Clip::Pointer duplicate() const override;
+    virtual QString getName() const override { return _name; }
+
+    virtual float duration() const override;
+    virtual size_t frameCount() const override;
+
+    virtual void seekFrameTime(Frame::Time offset) override;
+    virtual Frame::Time positionFrameTime() const override;
+
+    virtual FrameConstPointer peekFrame() const override;
+    virtual FrameConstPointer nextFrame() override;
+    virtual void skipFrame() override;
+    virtual void addFrame(FrameConstPointer) override;
+
+    // mantissa bits kept of the single precision values in CBOR frames, 23 keeps them all
+    static const int FULL_SIGNIFICANT_BITS = 23;
+    static const int DEFAULT_SIGNIFICANT_BITS = 16;
+    static const Frame::Time CHUNK_DURATION;
+    static const int MAX_CHUNK_SIZE = 1024 * 1024;
+
+protected:
+    virtual void reset() override;
+
+private:
+    struct Chunk {
+        Frame::Time firstTime;
+        Frame::Time lastTime;
+        quint64 fileOffset;
+        quint32 size;
+        size_t firstFrame;     // index of the chunk's first readable frame in the clip
+        size_t frameCount;     // readable frames, those of types this process knows about
+    };
+
+    size_t findChunk(size_t frameIndex) const;
+    const std::vector<FrameConstPointer>& decodeChunk(size_t chunkIndex) const;
+    FrameConstPointer readFrame(size_t frameIndex) const;
+
+    QString _name { QUuid().toString() };
+    QJsonDocument _header;
+    const uchar* _data { nullptr };
+    size_t _size { 0 };
+    QMap<FrameType, FrameType> _translationMap;
+    std::vector<Chunk> _chunks;
+    size_t _frameCount { 0 };
+    Frame::Time _lastFrameTime { 0 };
+    size_t _frameIndex { 0 };
+
+    mutable size_t _decodedChunk { SIZE_MAX };
+    mutable std::vector<FrameConstPointer> _decodedFrames;
+};
+
+}
+
+#endif
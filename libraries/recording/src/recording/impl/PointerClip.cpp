@@ -20,13 +20,12 @@
 #include "../Frame.h"
 #include "../Logging.h"
 #include "BufferClip.h"
+#include "ChunkedClip.h"
 
 
 using namespace recording;
 
-using FrameTranslationMap = QMap<FrameType, FrameType>;
-
-FrameTranslationMap parseTranslationMap(const QJsonDocument& doc) {
+FrameTranslationMap recording::parseTranslationMap(const QJsonDocument& doc) {
     FrameTranslationMap results;
     auto headerObj = doc.object();
     if (headerObj.contains(Clip::FRAME_TYPE_MAP)) {
@@ -80,6 +79,7 @@ void PointerClip::reset() {
     _data = nullptr;
     _size = 0;
     _header = QJsonDocument();
+    _chunkedClip.reset();
 }
 
 void PointerClip::init(uchar* data, size_t size) {
@@ -88,6 +88,16 @@ void PointerClip::init(uchar* data, size_t size) {
     _data = data;
     _size = size;
 
+    if (ChunkedClip::isChunked(data, size)) {
+        auto chunkedClip = std::make_shared<ChunkedClip>();
+        if (chunkedClip->init(data, size)) {
+            _chunkedClip = chunkedClip;
+        } else {
+            reset();
+        }
+        return;
+    }
+
     auto parsedFrameHeaders = parseFrameHeaders(data, size);
     // Verify that at least one frame exists and that the first frame is a header
     if (0 == parsedFrameHeaders.size()) {
@@ -160,3 +170,47 @@ FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
 void PointerClip::addFrame(FrameConstPointer) {
     throw std::runtime_error("Pointer clips are read only, use duplicate to create a read/write clip");
 }
+
+const QJsonDocument& PointerClip::getHeader() const {
+    return _chunkedClip ? _chunkedClip->getHeader() : _header;
+}
+
+Clip::Pointer PointerClip::duplicate() const {
+    return _chunkedClip ? _chunkedClip->duplicate() : ArrayClip::duplicate();
+}
+
+float PointerClip::duration() const {
+    return _chunkedClip ? _chunkedClip->duration() : ArrayClip::duration();
+}
+
+size_t PointerClip::frameCount() const {
+    return _chunkedClip ? _chunkedClip->frameCount() : ArrayClip::frameCount();
+}
+
+void PointerClip::seekFrameTime(Frame::Time offset) {
+    if (_chunkedClip) {
+        _chunkedClip->seekFrameTime(offset);
+    } else {
+        ArrayClip::seekFrameTime(offset);
+    }
+}
+
+Frame::Time PointerClip::positionFrameTime() const {
+    return _chunkedClip ? _chunkedClip->positionFrameTime() : ArrayClip::positionFrameTime();
+}
+
+FrameConstPointer PointerClip::peekFrame() const {
+    return _chunkedClip ? _chunkedClip->peekFrame() : ArrayClip::peekFrame();
+}
+
+FrameConstPointer PointerClip::nextFrame() {
+    return _chunkedClip ? _chunkedClip->nextFrame() : ArrayClip::nextFrame();
+}
+
+void PointerClip::skipFrame() {
+    if (_chunkedClip) {
+        _chunkedClip->skipFrame();
+    } else {
+        ArrayClip::skipFrame();
+    }
+}
@@ -15,6 +15,7 @@
 #include <mutex>
 
 #include <QtCore/QJsonDocument>
+#include <QtCore/QMap>
 
 #include "../Frame.h"
 
@@ -29,6 +30,12 @@ struct PointerFrameHeader : public FrameHeader {
 
 using PointerFrameHeaderList = std::list<PointerFrameHeader>;
 
+// stored frame type enum -> the enum registered under the same name in this process
+using FrameTranslationMap = QMap<FrameType, FrameType>;
+FrameTranslationMap parseTranslationMap(const QJsonDocument& header);
+
+class ChunkedClip;
+
 class PointerClip : public ArrayClip<PointerFrameHeader> {
 public:
     using Pointer = std::shared_ptr<PointerClip>;
@@ -38,9 +45,18 @@ public:
 
     void init(uchar* data, size_t size);
     virtual void addFrame(FrameConstPointer) override;
-    const QJsonDocument& getHeader() const {
-        return _header;
-    }
+    const QJsonDocument& getHeader() const;
+
+    // chunked recordings are played by a ChunkedClip over the same data, the older
+    // frame by frame ones directly
+    virtual Clip::Pointer duplicate() const override;
+    virtual float duration() const override;
+    virtual size_t frameCount() const override;
+    virtual void seekFrameTime(Frame::Time offset) override;
+    virtual Frame::Time positionFrameTime() const override;
+    virtual FrameConstPointer peekFrame() const override;
+    virtual FrameConstPointer nextFrame() override;
+    virtual void skipFrame() override;
 
     // FIXME move to frame?
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
@@ -51,6 +67,7 @@ protected:
     uchar* _data { nullptr };
     size_t _size { 0 };
     bool _compressed { true };
+    std::shared_ptr<ChunkedClip> _chunkedClip;
 };
 
 }
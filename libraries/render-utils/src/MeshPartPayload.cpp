@@ -15,6 +15,8 @@
 
 #include <PerfStat.h>
 #include <DualQuaternion.h>
+#include <NumericalConstants.h>
+#include <RegisteredMetaTypes.h>
 #include <graphics/ShaderConstants.h>
 
 #include "render-utils/ShaderConstants.h"
@@ -33,6 +35,7 @@ bool MeshPartPayload::enableMaterialProceduralShaders = true;
 #endif
 
 bool MeshPartPayload::sceneIsReady = false;
+bool MeshPartPayload::enableInstancing = true;
 
 using namespace render;
 
@@ -187,6 +190,28 @@ void MeshPartPayload::bindTransform(gpu::Batch& batch, RenderArgs::RenderMode re
     batch.setModelTransform(_worldFromLocalTransform);
 }
 
+void MeshPartPayload::noteScreenCoverage(const RenderArgs* args) const {
+    const auto& textureTable = _drawMaterials.getTextureTable();
+    if (!textureTable || args->_renderMode != RenderArgs::RenderMode::DEFAULT_RENDER_MODE || !args->_enableTexturing ||
+        !args->hasViewFrustum()) {
+        return;
+    }
+
+    // Projected area of the bounding sphere relative to the area of the view
+    const ViewFrustum& frustum = args->getViewFrustum();
+    Item::Bound bound = getBound();
+    float radius = 0.5f * glm::length(bound.getDimensions());
+    float distance = glm::distance(bound.calcCenter(), frustum.getPosition());
+    float coverage = 1.0f;
+    if (distance > radius) {
+        float tanHalfFieldOfView = tanf(0.5f * glm::radians(frustum.getFieldOfView()));
+        float viewArea = 4.0f * tanHalfFieldOfView * tanHalfFieldOfView * frustum.getAspectRatio();
+        float tanRadius = radius / distance;
+        coverage = glm::min(1.0f, PI * tanRadius * tanRadius / viewArea);
+    }
+    textureTable->noteScreenCoverage(coverage);
+}
+
 void MeshPartPayload::render(RenderArgs* args) {
     PerformanceTimer perfTimer("MeshPartPayload::render");
 
@@ -217,6 +242,7 @@ void MeshPartPayload::render(RenderArgs* args) {
         if (RenderPipelines::bindMaterials(_drawMaterials, batch, args->_renderMode, args->_enableTexturing)) {
             args->_details._materialSwitches++;
         }
+        noteScreenCoverage(args);
     }
 
     // Draw!
@@ -259,6 +285,11 @@ void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* arg
     return payload->render(args);
 }
 
+template <>
+void payloadUpdateTransform(const ModelMeshPartPayload::Pointer& payload, const Transform& transform) {
+    payload->updateTransform(transform);
+}
+
 }  // namespace render
 
 ModelMeshPartPayload::ModelMeshPartPayload(ModelPointer model,
@@ -401,6 +432,7 @@ void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
 void ModelMeshPartPayload::setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning) {
     if (invalidateShapeKey) {
         _shapeKey = ShapeKey::Builder::invalid();
+        _shapeKeyPendingMaterials = true;
         return;
     }
 
@@ -456,6 +488,7 @@ void ModelMeshPartPayload::setShapeKey(bool invalidateShapeKey, PrimitiveMode pr
 
     _prevUseDualQuaternionSkinning = useDualQuaternionSkinning;
     _shapeKey = builder.build();
+    _shapeKeyPendingMaterials = _drawMaterials.shouldUpdate() || (material && material->isProcedural() && !material->isReady());
 }
 
 ShapeKey ModelMeshPartPayload::getShapeKey() const {
@@ -478,6 +511,123 @@ void ModelMeshPartPayload::bindTransform(gpu::Batch& batch, RenderArgs::RenderMo
     batch.setModelTransform(_worldFromLocalTransform);
 }
 
+bool ModelMeshPartPayload::canRenderInstanced(RenderArgs* args) {
+    if (!enableInstancing || !args->_shapePipeline || args->_shapePipeline->hasItemSetter() || !args->_enableTexturing) {
+        return false;
+    }
+
+    // translucent parts are drawn in depth order, deformed ones have their own cluster and blendshape buffers
+    if (_shapeKey.hasOwnPipeline() || _shapeKey.isTranslucent() || _shapeKey.isDeformed() ||
+        _clusterBuffer || _meshBlendshapeBuffer) {
+        return false;
+    }
+
+    // the instances are drawn with the materials of the first one, which must not change after recording
+    if (_drawMaterials.shouldUpdate()) {
+        RenderPipelines::updateMultiMaterial(_drawMaterials);
+    }
+    return !_drawMaterials.shouldUpdate();
+}
+
+const std::string& ModelMeshPartPayload::getInstanceName(const RenderArgs* args) {
+    size_t key = 0;
+    std::hash_combine(key, (const void*)_drawMesh.get(), (const void*)args->_shapePipeline.get(), (int)args->_renderMode);
+    for (const auto& layer : _drawMaterials.getLayers()) {
+        std::hash_combine(key, (const void*)layer.material.get(), layer.priority);
+    }
+
+    auto name = _instanceNames.find(key);
+    if (name == _instanceNames.end()) {
+        // don't keep the names of pipelines and materials the part isn't drawn with anymore
+        const size_t MAX_INSTANCE_NAMES = 16;
+        if (_instanceNames.size() >= MAX_INSTANCE_NAMES) {
+            _instanceNames.clear();
+        }
+        name = _instanceNames.emplace(key, std::make_pair(evalInstanceNameKey(args), evalInstanceName(args))).first;
+    } else if (!isInstanceNameKey(name->second.first, args)) {
+        // a different draw with the same hash, the name it left would batch this part with the wrong instances
+        name->second = std::make_pair(evalInstanceNameKey(args), evalInstanceName(args));
+    }
+    return name->second.second;
+}
+
+ModelMeshPartPayload::InstanceNameKey ModelMeshPartPayload::evalInstanceNameKey(const RenderArgs* args) const {
+    InstanceNameKey key;
+    key.mesh = _drawMesh.get();
+    key.pipeline = args->_shapePipeline.get();
+    key.renderMode = (int)args->_renderMode;
+    for (const auto& layer : _drawMaterials.getLayers()) {
+        key.layers.emplace_back(layer.material.get(), layer.priority);
+    }
+    return key;
+}
+
+bool ModelMeshPartPayload::isInstanceNameKey(const InstanceNameKey& key, const RenderArgs* args) const {
+    // compared in place, building a key to compare with would allocate on every draw
+    if (key.mesh != _drawMesh.get() || key.pipeline != args->_shapePipeline.get() ||
+        key.renderMode != (int)args->_renderMode) {
+        return false;
+    }
+    const auto& layers = _drawMaterials.getLayers();
+    if (key.layers.size() != layers.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < layers.size(); ++i) {
+        if (key.layers[i].first != layers[i].material.get() || key.layers[i].second != layers[i].priority) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string ModelMeshPartPayload::evalInstanceName(const RenderArgs* args) const {
+    std::string name = "ModelMeshPart";
+    name.reserve(64);
+    auto append = [&name](const void* pointer) {
+        name += ':';
+        name += std::to_string(reinterpret_cast<uintptr_t>(pointer));
+    };
+    append(_drawMesh.get());
+    name += ':';
+    name += std::to_string(_drawPart._startIndex);
+    name += ':';
+    name += std::to_string(_drawPart._numIndices);
+    append(args->_shapePipeline.get());
+    name += ':';
+    name += std::to_string((int)args->_renderMode);
+    for (const auto& layer : _drawMaterials.getLayers()) {
+        append(layer.material.get());
+        name += ':';
+        name += std::to_string(layer.priority);
+    }
+    return name;
+}
+
+void ModelMeshPartPayload::renderInstanced(RenderArgs* args) {
+    gpu::Batch& batch = *(args->_batch);
+
+    batch.setModelTransform(_worldFromLocalTransform);
+
+    // Payloads are only removed by the scene transactions processed before the frame is rendered,
+    // so the first instance outlives the end of the frame which runs this
+    auto pipeline = args->_shapePipeline;
+    auto renderMode = args->_renderMode;
+    ModelMeshPartPayload* firstInstance = this;
+    batch.setupNamedCalls(getInstanceName(args), [args, pipeline, renderMode, firstInstance](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) {
+        batch.setPipeline(pipeline->pipeline);
+        pipeline->prepare(batch, args);
+        firstInstance->bindMesh(batch);
+        RenderPipelines::bindMaterials(firstInstance->_drawMaterials, batch, renderMode, true);
+        batch.drawIndexedInstanced((gpu::uint32)data.count(), gpu::TRIANGLES, firstInstance->_drawPart._numIndices,
+                                   firstInstance->_drawPart._startIndex);
+    });
+
+    noteScreenCoverage(args);
+
+    const int INDICES_PER_TRIANGLE = 3;
+    args->_details._trianglesRendered += _drawPart._numIndices / INDICES_PER_TRIANGLE;
+}
+
 void ModelMeshPartPayload::render(RenderArgs* args) {
     PerformanceTimer perfTimer("ModelMeshPartPayload::render");
 
@@ -485,6 +635,11 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
         return;
     }
 
+    if (canRenderInstanced(args)) {
+        renderInstanced(args);
+        return;
+    }
+
     gpu::Batch& batch = *(args->_batch);
 
     bindTransform(batch, args->_renderMode);
@@ -516,6 +671,7 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
         if (RenderPipelines::bindMaterials(_drawMaterials, batch, args->_renderMode, args->_enableTexturing)) {
             args->_details._materialSwitches++;
         }
+        noteScreenCoverage(args);
     }
 
     // Draw!
@@ -12,6 +12,10 @@
 #ifndef hifi_MeshPartPayload_h
 #define hifi_MeshPartPayload_h
 
+#include <atomic>
+#include <utility>
+#include <vector>
+
 #include <Interpolate.h>
 
 #include <gpu/Batch.h>
@@ -54,6 +58,8 @@ public:
     void drawCall(gpu::Batch& batch) const;
     virtual void bindMesh(gpu::Batch& batch);
     virtual void bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const;
+    // Tells the material textures how much of the view this part covers, so texture streaming can favor them
+    void noteScreenCoverage(const RenderArgs* args) const;
 
     // Payload resource cached values
     Transform _worldFromLocalTransform;
@@ -79,6 +85,7 @@ public:
 
     static bool DEFAULT_ENABLE_MATERIAL_PROCEDURAL_SHADERS;
     static bool enableMaterialProceduralShaders; // set from menu/settings
+    static bool enableInstancing; // set from menu
     static bool sceneIsReady; // set from entity tree renderer
 
 protected:
@@ -126,6 +133,9 @@ public:
     void render(RenderArgs* args) override;
 
     void setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning);
+    // Whether the shape key was built while the materials were still loading or compiling, so it must be built again
+    // once they're ready.  Set on the render thread, read by the model to know if a transform update is enough.
+    bool isShapeKeyPendingMaterials() const { return _shapeKeyPendingMaterials; }
     void setCauterized(bool cauterized) { _cauterized = cauterized; }
 
     // ModelMeshPartPayload functions to perform render
@@ -155,9 +165,31 @@ public:
 private:
     void initCache(const ModelPointer& model);
 
+    // Identical static mesh parts drawn with the same pipeline and materials are gathered into a single
+    // instanced draw per batch, with their transforms in the batch's named call draw infos
+    bool canRenderInstanced(RenderArgs* args);
+    const std::string& getInstanceName(const RenderArgs* args);
+    std::string evalInstanceName(const RenderArgs* args) const;
+    void renderInstanced(RenderArgs* args);
+
+    // What an instance name is built from, kept with the name so that two draws whose hashes collide never share one
+    struct InstanceNameKey {
+        const void* mesh { nullptr };
+        const void* pipeline { nullptr };
+        int renderMode { 0 };
+        std::vector<std::pair<const void*, quint16>> layers;
+    };
+    InstanceNameKey evalInstanceNameKey(const RenderArgs* args) const;
+    bool isInstanceNameKey(const InstanceNameKey& key, const RenderArgs* args) const;
+
+    // The instance names this part was drawn with, by a hash of what they are built from.  A part is only drawn by
+    // a few passes, so its names are built once rather than every frame.
+    std::unordered_map<size_t, std::pair<InstanceNameKey, std::string>> _instanceNames;
+
     gpu::BufferPointer _meshBlendshapeBuffer;
     int _meshNumVertices;
     render::ShapeKey _shapeKey{ render::ShapeKey::Builder::invalid() };
+    std::atomic<bool> _shapeKeyPendingMaterials { true };
     bool _prevUseDualQuaternionSkinning{ false };
     bool _cauterized{ false };
 };
@@ -171,6 +203,8 @@ template <>
 const ShapeKey shapeGetShapeKey(const ModelMeshPartPayload::Pointer& payload);
 template <>
 void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args);
+template <>
+void payloadUpdateTransform(const ModelMeshPartPayload::Pointer& payload, const Transform& transform);
 }  // namespace render
 
 #endif  // hifi_MeshPartPayload_h
@@ -11,6 +11,9 @@
 
 #include "Model.h"
 
+#include <map>
+#include <mutex>
+
 #include <QMetaType>
 #include <QRunnable>
 #include <QThreadPool>
@@ -229,6 +232,12 @@ void Model::updateRenderItems() {
         auto renderItemKeyGlobalFlags = self->getRenderItemKeyGlobalFlags();
         bool cauterized = self->isCauterized();
 
+        // the keys of the static parts are refreshed until they've seen the textures loaded and nothing else changed,
+        // and for as long as their own materials are still loading or compiling
+        bool texturesLoaded = self->getNetworkModel()->areTexturesLoaded();
+        bool updateKeys = !self->_renderItemKeysSent || !self->_texturesLoadedSent ||
+            renderItemKeyGlobalFlags != self->_renderItemKeyGlobalFlagsSent || primitiveMode != self->_primitiveModeSent;
+
         render::Transaction transaction;
         for (int i = 0; i < (int) self->_modelMeshRenderItemIDs.size(); i++) {
             auto itemID = self->_modelMeshRenderItemIDs[i];
@@ -238,6 +247,8 @@ void Model::updateRenderItems() {
             auto skinDeformerIndex = shapeState._skinDeformerIndex;
 
             bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(shapeState._meshIndex);
+            bool materialsPending = i >= self->_modelMeshRenderItems.size() ||
+                self->_modelMeshRenderItems[i]->isShapeKeyPendingMaterials();
 
             if (skinDeformerIndex != hfm::UNDEFINED_KEY) {
                 const auto& meshState = self->getMeshState(skinDeformerIndex);
@@ -259,6 +270,8 @@ void Model::updateRenderItems() {
                     data.updateKey(renderItemKeyGlobalFlags);
                     data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
                 });
+            } else if (!updateKeys && !invalidatePayloadShapeKey && !materialsPending) {
+                transaction.updateItemTransform(itemID, modelTransform.worldTransform(shapeState._rootFromJointTransform));
             } else {
                 transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags](ModelMeshPartPayload& data) {
                     
@@ -271,6 +284,10 @@ void Model::updateRenderItems() {
                 }); 
             }
         }
+        self->_renderItemKeysSent = true;
+        self->_renderItemKeyGlobalFlagsSent = renderItemKeyGlobalFlags;
+        self->_primitiveModeSent = primitiveMode;
+        self->_texturesLoadedSent = texturesLoaded;
 
         AbstractViewStateInterface::instance()->getMain3DScene()->enqueueTransaction(transaction);
     });
@@ -1040,6 +1057,7 @@ bool Model::addToScene(const render::ScenePointer& scene,
     if (somethingAdded) {
         applyMaterialMapping();
         _addedToScene = true;
+        _renderItemKeysSent = false;
         updateRenderItems();
         _needsFixupInScene = false;
     }
@@ -1462,8 +1480,10 @@ void Model::updateBlendshapes() {
     // post the blender if we're not currently waiting for one to finish
     auto modelBlender = DependencyManager::get<ModelBlender>();
     if (modelBlender->shouldComputeBlendshapes() && getHFMModel().hasBlendedMeshes() && _blendshapeCoefficients != _blendedBlendshapeCoefficients) {
-        _blendedBlendshapeCoefficients = _blendshapeCoefficients;
-        modelBlender->noteRequiresBlend(getThisPointer());
+        // a model turned away by a full queue keeps its old coefficients, so that its next update asks again
+        if (modelBlender->noteRequiresBlend(getThisPointer())) {
+            _blendedBlendshapeCoefficients = _blendshapeCoefficients;
+        }
     }
 }
 
@@ -1750,6 +1770,16 @@ static void packBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* unpacked, Blends
     }
 }
 
+static void accumulateBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* accumulated, const BlendshapeOffsetUnpacked* offsets,
+                                            const int* indices, int size, float vertexCoefficient, float normalCoefficient) {
+    for (int i = 0; i < size; ++i) {
+        auto& accumulatedOffset = accumulated[indices[i]];
+        accumulatedOffset.positionOffset += offsets[i].positionOffset * vertexCoefficient;
+        accumulatedOffset.normalOffset += offsets[i].normalOffset * normalCoefficient;
+        accumulatedOffset.tangentOffset += offsets[i].tangentOffset * normalCoefficient;
+    }
+}
+
 #if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
 //
 // Runtime CPU dispatch
@@ -1757,6 +1787,8 @@ static void packBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* unpacked, Blends
 #include <CPUDetect.h>
 
 void packBlendshapeOffsets_AVX2(float (*unpacked)[9], uint32_t (*packed)[4], int size);
+void accumulateBlendshapeOffsets_AVX2(float (*accumulated)[9], const float (*offsets)[9], const int* indices, int size,
+                                      float vertexCoefficient, float normalCoefficient);
 
 static void packBlendshapeOffsets(BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
     static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
@@ -1769,14 +1801,107 @@ static void packBlendshapeOffsets(BlendshapeOffsetUnpacked* unpacked, Blendshape
     }
 }
 
+static void accumulateBlendshapeOffsets(BlendshapeOffsetUnpacked* accumulated, const BlendshapeOffsetUnpacked* offsets,
+                                        const int* indices, int size, float vertexCoefficient, float normalCoefficient) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        accumulateBlendshapeOffsets_AVX2((float(*)[9])accumulated, (const float(*)[9])offsets, indices, size,
+                                         vertexCoefficient, normalCoefficient);
+    } else {
+        accumulateBlendshapeOffsets_ref(accumulated, offsets, indices, size, vertexCoefficient, normalCoefficient);
+    }
+}
+
 #else   // portable reference code
 static auto& packBlendshapeOffsets = packBlendshapeOffsets_ref;
+static auto& accumulateBlendshapeOffsets = accumulateBlendshapeOffsets_ref;
 #endif
 
+// A blendshape's position, normal and tangent offsets interleaved like BlendshapeOffsetUnpacked,
+// so that accumulating one vertex is a single 9 wide multiply-add
+struct InterleavedBlendshape {
+    std::vector<int> indices;
+    std::vector<BlendshapeOffsetUnpacked> offsets;
+};
+
+struct InterleavedBlendshapeMesh {
+    int numVertices { 0 }; // 0 for meshes without blendshapes
+    std::vector<InterleavedBlendshape> blendshapes;
+};
+
+using InterleavedBlendshapes = std::vector<InterleavedBlendshapeMesh>;
+
+static std::shared_ptr<const InterleavedBlendshapes> interleaveBlendshapes(const HFMModel& hfmModel) {
+    auto interleavedMeshes = std::make_shared<InterleavedBlendshapes>();
+    interleavedMeshes->reserve(hfmModel.meshes.size());
+    for (const auto& mesh : hfmModel.meshes) {
+        InterleavedBlendshapeMesh interleavedMesh;
+        if (!mesh.blendshapes.isEmpty()) {
+            interleavedMesh.numVertices = mesh.vertices.size();
+            interleavedMesh.blendshapes.resize(mesh.blendshapes.size());
+            for (int i = 0; i < mesh.blendshapes.size(); i++) {
+                const HFMBlendshape& blendshape = mesh.blendshapes.at(i);
+                auto& interleaved = interleavedMesh.blendshapes[i];
+                int size = blendshape.indices.size();
+                interleaved.indices.assign(blendshape.indices.cbegin(), blendshape.indices.cend());
+                interleaved.offsets.resize(size);
+                for (int j = 0; j < size; j++) {
+                    auto& offset = interleaved.offsets[j];
+                    offset.positionOffset = blendshape.vertices.at(j);
+                    offset.normalOffset = blendshape.normals.at(j);
+                    offset.tangentOffset = (j < blendshape.tangents.size()) ? blendshape.tangents.at(j) : glm::vec3(0.0f);
+                }
+            }
+        }
+        interleavedMeshes->push_back(std::move(interleavedMesh));
+    }
+    return interleavedMeshes;
+}
+
+// Every model sharing an HFMModel (a crowd of the same avatar) shares its interleaved blendshapes
+static std::shared_ptr<const InterleavedBlendshapes> getInterleavedBlendshapes(const HFMModel::ConstPointer& hfmModel) {
+    static std::mutex mutex;
+    static std::map<const HFMModel*, std::weak_ptr<const InterleavedBlendshapes>> interleavedBlendshapes;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto& cached = interleavedBlendshapes[hfmModel.get()];
+    auto blendshapes = cached.lock();
+    if (!blendshapes) {
+        for (auto it = interleavedBlendshapes.begin(); it != interleavedBlendshapes.end();) {
+            if (it->second.expired() && it->first != hfmModel.get()) {
+                it = interleavedBlendshapes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        blendshapes = interleaveBlendshapes(*hfmModel);
+        interleavedBlendshapes[hfmModel.get()] = blendshapes;
+    }
+    return blendshapes;
+}
+
+// The offsets of a model's last blend, kept so that the next blend only has to apply
+// the coefficients that changed and repack the vertices they touch
+class BlendshapeState {
+public:
+    HFMModel::ConstPointer hfmModel;
+    std::shared_ptr<const InterleavedBlendshapes> blendshapes;
+
+    std::vector<float> coefficients; // the coefficients the accumulated offsets were built with
+    std::vector<BlendshapeOffsetUnpacked> unpackedOffsets; // every blended mesh, back to back
+    QVector<BlendshapeOffset> packedOffsets;
+    QVector<int> blendedMeshSizes;
+
+    std::vector<int> dirtyVertices;
+    std::vector<bool> isVertexDirty;
+    int numIncrementalBlends { 0 };
+};
+
 class Blender : public QRunnable {
 public:
 
-    Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients);
+    Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients,
+            std::shared_ptr<BlendshapeState> state);
 
     virtual void run() override;
 
@@ -1785,95 +1910,137 @@ private:
     HFMModel::ConstPointer _hfmModel;
     int _blendNumber;
     QVector<float> _blendshapeCoefficients;
+    std::shared_ptr<BlendshapeState> _state;
 };
 
-Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients) :
+Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients,
+                 std::shared_ptr<BlendshapeState> state) :
     _model(model),
     _hfmModel(hfmModel),
     _blendNumber(blendNumber),
-    _blendshapeCoefficients(blendshapeCoefficients) {
+    _blendshapeCoefficients(blendshapeCoefficients),
+    _state(state) {
 }
 
+// incremental blends accumulate rounding errors, so the offsets are rebuilt from scratch every so often
+const int MAX_INCREMENTAL_BLENDS = 120;
+// past this fraction of touched vertices, repacking everything is cheaper than going vertex by vertex
+const float MAX_DIRTY_VERTEX_RATIO = 0.25f;
+
 void Blender::run() {
     DETAILED_PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
-    int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
-    int maxBlendshapeOffsets = 0;  // number of offsets in the largest mesh.
-    int numMeshes = 0;  // number of meshes in this model.
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        numMeshes++;
-        if (meshIter->blendshapes.isEmpty()) {
-            continue;
+    uint64_t start = usecTimestampNow();
+
+    // ModelBlender never runs two blenders for the same model, so the state is ours until we're done
+    BlendshapeState& state = *_state;
+
+    bool rebuild = state.numIncrementalBlends >= MAX_INCREMENTAL_BLENDS;
+    if (state.hfmModel != _hfmModel) {
+        state.hfmModel = _hfmModel;
+        state.blendshapes = getInterleavedBlendshapes(_hfmModel);
+
+        int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
+        state.blendedMeshSizes.clear();
+        state.blendedMeshSizes.reserve((int)state.blendshapes->size());
+        for (const auto& mesh : *state.blendshapes) {
+            state.blendedMeshSizes.push_back(mesh.numVertices);
+            numBlendshapeOffsets += mesh.numVertices;
+        }
+        state.unpackedOffsets.resize(numBlendshapeOffsets);
+        state.packedOffsets.resize(numBlendshapeOffsets);
+        state.dirtyVertices.clear();
+        state.isVertexDirty.assign(numBlendshapeOffsets, false);
+        rebuild = true;
+    }
+
+    // coefficients below the epsilon don't contribute, and once they're all gone the offsets are simply zeroed
+    const float EPSILON = 0.0001f;
+    std::vector<float> coefficients(std::max((size_t)_blendshapeCoefficients.size(), state.coefficients.size()), 0.0f);
+    bool hasCoefficients = false;
+    for (int i = 0; i < _blendshapeCoefficients.size(); i++) {
+        float coefficient = _blendshapeCoefficients.at(i);
+        if (coefficient >= EPSILON) {
+            coefficients[i] = coefficient;
+            hasCoefficients = true;
         }
-        int numVertsInMesh = meshIter->vertices.size();
-        numBlendshapeOffsets += numVertsInMesh;
-        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numVertsInMesh);
     }
+    rebuild = rebuild || !hasCoefficients;
 
-    // allocate the required sizes
-    QVector<int> blendedMeshSizes;
-    blendedMeshSizes.reserve(numMeshes);
-
-    QVector<BlendshapeOffset> packedBlendshapeOffsets;
-    packedBlendshapeOffsets.resize(numBlendshapeOffsets);
-
-    QVector<BlendshapeOffsetUnpacked> unpackedBlendshapeOffsets;
-    unpackedBlendshapeOffsets.resize(maxBlendshapeOffsets);    // reuse for all meshes
+    if (rebuild) {
+        memset(state.unpackedOffsets.data(), 0, state.unpackedOffsets.size() * sizeof(BlendshapeOffsetUnpacked));
+        state.coefficients.assign(coefficients.size(), 0.0f);
+        state.numIncrementalBlends = 0;
+    } else {
+        state.coefficients.resize(coefficients.size(), 0.0f);
+        state.numIncrementalBlends++;
+    }
 
+    // for each blendshape whose coefficient changed, accumulate the change of its offsets
+    const float NORMAL_COEFFICIENT_SCALE = 0.01f;
+    const size_t maxDirtyVertices = (size_t)(MAX_DIRTY_VERTEX_RATIO * (float)state.unpackedOffsets.size());
+    bool repackAll = rebuild;
     int offset = 0;
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        if (meshIter->blendshapes.isEmpty()) {
-            blendedMeshSizes.push_back(0);
+    for (const auto& mesh : *state.blendshapes) {
+        if (mesh.numVertices == 0) {
             continue;
         }
-        int numVertsInMesh = meshIter->vertices.size();
-        blendedMeshSizes.push_back(numVertsInMesh);
-
-        // initialize offsets to zero
-        memset(unpackedBlendshapeOffsets.data(), 0, numVertsInMesh * sizeof(BlendshapeOffsetUnpacked));
-
-        // for each blendshape in this mesh, accumulate the offsets into unpackedBlendshapeOffsets.
-        const float NORMAL_COEFFICIENT_SCALE = 0.01f;
-        for (int i = 0, n = qMin(_blendshapeCoefficients.size(), meshIter->blendshapes.size()); i < n; i++) {
-            float vertexCoefficient = _blendshapeCoefficients.at(i);
-            const float EPSILON = 0.0001f;
-            if (vertexCoefficient < EPSILON) {
+
+        for (size_t i = 0, n = std::min(coefficients.size(), mesh.blendshapes.size()); i < n; i++) {
+            float vertexCoefficient = coefficients[i] - state.coefficients[i];
+            if (vertexCoefficient == 0.0f) {
                 continue;
             }
 
-            float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
-            const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
-            for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
+            const auto& blendshape = mesh.blendshapes[i];
+            accumulateBlendshapeOffsets(state.unpackedOffsets.data() + offset, blendshape.offsets.data(), blendshape.indices.data(),
+                                        (int)blendshape.indices.size(), vertexCoefficient, vertexCoefficient * NORMAL_COEFFICIENT_SCALE);
 
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
+            if (!repackAll) {
+                for (int index : blendshape.indices) {
+                    if (!state.isVertexDirty[offset + index]) {
+                        state.isVertexDirty[offset + index] = true;
+                        state.dirtyVertices.push_back(offset + index);
+                    }
                 }
+                repackAll = state.dirtyVertices.size() > maxDirtyVertices;
             }
         }
 
-        // convert unpackedBlendshapeOffsets into packedBlendshapeOffsets for the gpu.
-        auto unpacked = unpackedBlendshapeOffsets.data();
-        auto packed = packedBlendshapeOffsets.data() + offset;
-        packBlendshapeOffsets(unpacked, packed, numVertsInMesh);
+        offset += mesh.numVertices;
+    }
+    Q_ASSERT(offset == (int)state.unpackedOffsets.size());
+    state.coefficients = coefficients;
 
-        offset += numVertsInMesh;
+    // convert the touched offsets into packedOffsets for the gpu.
+    if (repackAll) {
+        packBlendshapeOffsets(state.unpackedOffsets.data(), state.packedOffsets.data(), (int)state.unpackedOffsets.size());
+    } else {
+        for (int index : state.dirtyVertices) {
+            packBlendshapeOffsets_ref(state.unpackedOffsets.data() + index, state.packedOffsets.data() + index, 1);
+        }
     }
-    Q_ASSERT(offset == numBlendshapeOffsets);
+    for (int index : state.dirtyVertices) {
+        state.isVertexDirty[index] = false;
+    }
+    state.dirtyVertices.clear();
+
+    auto modelBlender = DependencyManager::get<ModelBlender>();
+    modelBlender->noteBlendTime(usecTimestampNow() - start);
 
     // post the result to the ModelBlender, which will dispatch to the model if still alive
-    QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
+    QMetaObject::invokeMethod(modelBlender.data(), "setBlendedVertices",
                               Q_ARG(ModelPointer, _model), Q_ARG(int, _blendNumber),
-                              Q_ARG(QVector<BlendshapeOffset>, packedBlendshapeOffsets),
-                              Q_ARG(QVector<int>, blendedMeshSizes));
+                              Q_ARG(QVector<BlendshapeOffset>, state.packedOffsets),
+                              Q_ARG(QVector<int>, state.blendedMeshSizes));
 }
 
 bool Model::maybeStartBlender() {
     if (isLoaded()) {
+        if (!_blendshapeState) {
+            _blendshapeState = std::make_shared<BlendshapeState>();
+        }
         QThreadPool::globalInstance()->start(new Blender(getThisPointer(), getNetworkModel()->getConstHFMModelPointer(),
-                                                         ++_blendNumber, _blendshapeCoefficients));
+                                                         ++_blendNumber, _blendshapeCoefficients, _blendshapeState));
         return true;
     }
     return false;
@@ -1886,23 +2053,53 @@ ModelBlender::ModelBlender() :
 ModelBlender::~ModelBlender() {
 }
 
-void ModelBlender::noteRequiresBlend(ModelPointer model) {
+bool ModelBlender::noteRequiresBlend(ModelPointer model) {
     Lock lock(_mutex);
     if (_modelsRequiringBlendsSet.find(model) == _modelsRequiringBlendsSet.end()) {
-        _modelsRequiringBlendsQueue.push(model);
+        if (_modelsRequiringBlendsQueue.size() >= MAX_QUEUED_BLENDS) {
+            return false;
+        }
+        _modelsRequiringBlendsQueue.push_back(model);
         _modelsRequiringBlendsSet.insert(model);
     }
 
-    if (_pendingBlenders < QThread::idealThreadCount()) {
-        while (!_modelsRequiringBlendsQueue.empty()) {
-            auto weakPtr = _modelsRequiringBlendsQueue.front();
-            _modelsRequiringBlendsQueue.pop();
-            _modelsRequiringBlendsSet.erase(weakPtr);
-            ModelPointer nextModel = weakPtr.lock();
-            if (nextModel && nextModel->maybeStartBlender()) {
-                _pendingBlenders++;
-                return;
+    startBlenders();
+    return true;
+}
+
+void ModelBlender::startBlenders() {
+    while (_pendingBlenders < QThread::idealThreadCount() && !_modelsRequiringBlendsQueue.empty()) {
+        // the highest priority model that isn't blending yet, the oldest one among equals
+        ModelPointer nextModel;
+        size_t nextIndex = 0;
+        float nextPriority = 0.0f;
+        for (size_t i = 0; i < _modelsRequiringBlendsQueue.size();) {
+            ModelPointer model = _modelsRequiringBlendsQueue[i].lock();
+            if (!model) {
+                _modelsRequiringBlendsSet.erase(_modelsRequiringBlendsQueue[i]);
+                _modelsRequiringBlendsQueue.erase(_modelsRequiringBlendsQueue.begin() + i);
+                continue;
             }
+            if (_modelsBlending.find(model) == _modelsBlending.end()) {
+                float priority = model->getBlendPriority();
+                if (!nextModel || priority > nextPriority) {
+                    nextModel = model;
+                    nextIndex = i;
+                    nextPriority = priority;
+                }
+            }
+            ++i;
+        }
+
+        if (!nextModel) {
+            return;
+        }
+
+        _modelsRequiringBlendsSet.erase(_modelsRequiringBlendsQueue[nextIndex]);
+        _modelsRequiringBlendsQueue.erase(_modelsRequiringBlendsQueue.begin() + nextIndex);
+        if (nextModel->maybeStartBlender()) {
+            _modelsBlending.insert(nextModel);
+            _pendingBlenders++;
         }
     }
 }
@@ -1918,15 +2115,23 @@ void ModelBlender::setBlendedVertices(ModelPointer model, int blendNumber, QVect
     {
         Lock lock(_mutex);
         _pendingBlenders--;
-        while (!_modelsRequiringBlendsQueue.empty()) {
-            auto weakPtr = _modelsRequiringBlendsQueue.front();
-            _modelsRequiringBlendsQueue.pop();
-            _modelsRequiringBlendsSet.erase(weakPtr);
-            ModelPointer nextModel = weakPtr.lock();
-            if (nextModel && nextModel->maybeStartBlender()) {
-                _pendingBlenders++;
-                break;
-            }
-        }
+        _modelsBlending.erase(model);
+        _blendRate.increment();
+        startBlenders();
     }
 }
+
+void ModelBlender::noteBlendTime(uint64_t usecs) {
+    Lock lock(_mutex);
+    _blendTime.updateAverage((float)usecs / (float)USECS_PER_MSEC);
+}
+
+float ModelBlender::getAverageBlendTime() const {
+    Lock lock(_mutex);
+    return _blendTime.getAverage();
+}
+
+int ModelBlender::getNumQueuedBlends() const {
+    Lock lock(_mutex);
+    return (int)_modelsRequiringBlendsQueue.size();
+}
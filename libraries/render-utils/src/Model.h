@@ -12,6 +12,7 @@
 #include <QUrl>
 #include <QMutex>
 
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
@@ -19,6 +20,7 @@
 #include <AABox.h>
 #include <DependencyManager.h>
 #include <GeometryUtil.h>
+#include <SimpleMovingAverage.h>
 #include <gpu/Batch.h>
 #include <render/Forward.h>
 #include <render/Scene.h>
@@ -27,6 +29,7 @@
 #include <SpatiallyNestable.h>
 #include <TriangleSet.h>
 #include <DualQuaternion.h>
+#include <shared/RateCounter.h>
 
 #include "RenderHifi.h"
 #include "GeometryCache.h"
@@ -51,6 +54,7 @@ namespace render {
 class MeshPartPayload;
 class ModelMeshPartPayload;
 class ModelRenderLocations;
+class BlendshapeState;
 
 inline uint qHash(const std::shared_ptr<MeshPartPayload>& a, uint seed) {
     return qHash(a.get(), seed);
@@ -278,6 +282,10 @@ public:
 
     void setLoadingPriority(float priority) { _loadingPriority = priority; }
 
+    // models with a higher blend priority (avatars in view) are blended first when the blend queue is backed up
+    void setBlendPriority(float priority) { _blendPriority = priority; }
+    float getBlendPriority() const { return _blendPriority; }
+
     size_t getRenderInfoVertexCount() const { return _renderInfoVertexCount; }
     size_t getRenderInfoTextureSize();
     int getRenderInfoTextureCount();
@@ -448,6 +456,14 @@ protected:
     QVector<float> _blendedBlendshapeCoefficients;
     int _blendNumber { 0 };
 
+    // what the render items were last given through update functors, static parts only get typed
+    // transform updates while none of it changes
+    bool _renderItemKeysSent { false };
+    render::ItemKey _renderItemKeyGlobalFlagsSent;
+    PrimitiveMode _primitiveModeSent { PrimitiveMode::SOLID };
+    bool _texturesLoadedSent { false };
+    std::shared_ptr<BlendshapeState> _blendshapeState; // accumulated offsets, only touched by this model's running Blender
+
     mutable QMutex _mutex{ QMutex::Recursive };
 
     bool _overrideModelTransform { false };
@@ -511,6 +527,7 @@ protected:
 
 private:
     float _loadingPriority { 0.0f };
+    std::atomic<float> _blendPriority { 0.0f };
 
     void calculateTextureInfo();
 
@@ -527,12 +544,22 @@ class ModelBlender : public QObject, public Dependency {
     SINGLETON_DEPENDENCY
 
 public:
+    /// Beyond this many models waiting for a blend, new ones are turned away until the queue drains.
+    static const size_t MAX_QUEUED_BLENDS = 256;
 
     /// Adds the specified model to the list requiring vertex blends.
-    void noteRequiresBlend(ModelPointer model);
+    /// Returns false if the queue is full, in which case the model should try again later.
+    bool noteRequiresBlend(ModelPointer model);
 
     bool shouldComputeBlendshapes() { return _computeBlendshapes; }
 
+    /// Called from the blender threads with the time taken by a blend.
+    void noteBlendTime(uint64_t usecs);
+
+    float getBlendRate() const { return _blendRate.rate(); }
+    float getAverageBlendTime() const; // msecs
+    int getNumQueuedBlends() const;
+
 public slots:
     void setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes);
     void setComputeBlendshapes(bool computeBlendshapes) { _computeBlendshapes = computeBlendshapes; }
@@ -544,10 +571,17 @@ private:
     ModelBlender();
     virtual ~ModelBlender();
 
-    std::queue<ModelWeakPointer> _modelsRequiringBlendsQueue;
+    // starts blenders for the highest priority queued models, up to one per core and one per model
+    void startBlenders();
+
+    std::vector<ModelWeakPointer> _modelsRequiringBlendsQueue;
     std::set<ModelWeakPointer, std::owner_less<ModelWeakPointer>> _modelsRequiringBlendsSet;
+    std::set<ModelWeakPointer, std::owner_less<ModelWeakPointer>> _modelsBlending;
     int _pendingBlenders;
-    Mutex _mutex;
+    mutable Mutex _mutex;
+
+    RateCounter<> _blendRate;
+    SimpleMovingAverage _blendTime { 60 };
 
     bool _computeBlendshapes { true };
 };
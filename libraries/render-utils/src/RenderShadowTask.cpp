@@ -13,6 +13,7 @@
 
 #include <gpu/Context.h>
 
+#include <TBBHelpers.h>
 #include <ViewFrustum.h>
 
 #include <render/CullTask.h>
@@ -78,41 +79,28 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
     const auto sortedPipelines = task.addJob<PipelineSortShapes>("PipelineSortShadow", culledShadowItems);
     const auto sortedShapes = task.addJob<DepthSortShapes>("DepthSortShadow", sortedPipelines, true);
 
-    render::Varying cascadeFrustums[SHADOW_CASCADE_MAX_COUNT] = {
-        ViewFrustumPointer()
-#if SHADOW_CASCADE_MAX_COUNT>1
-        ,ViewFrustumPointer(),
-        ViewFrustumPointer(),
-        ViewFrustumPointer()
-#endif
-    };
+    // Cull the shapes for all the cascades up front, they only depend on the cascade frustums set up above
+    const auto cullInputs = CullShadowCascades::Inputs(sortedShapes, shadowFrame, currentKeyLight).asVarying();
+    const auto culledCascades = task.addJob<CullShadowCascades>("CullShadowCascades", cullInputs, shadowCasterReceiverFilter);
+    const auto cascadeShapes = culledCascades.getN<CullShadowCascades::Outputs>(0);
+    const auto cascadeBounds = culledCascades.getN<CullShadowCascades::Outputs>(1);
 
     CascadeBoxes cascadeSceneBBoxes;
 
     for (auto i = 0; i < SHADOW_CASCADE_MAX_COUNT; i++) {
         char jobName[64];
         sprintf(jobName, "ShadowCascadeSetup%d", i);
-        const auto cascadeSetupOutput = task.addJob<RenderShadowCascadeSetup>(jobName, shadowFrame, i, shadowCasterReceiverFilter);
-        const auto shadowFilter = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(0);
-        auto antiFrustum = render::Varying(ViewFrustumPointer());
-        cascadeFrustums[i] = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(1);
-        if (i > 1) {
-            antiFrustum = cascadeFrustums[i - 2];
-        }
+        const auto shadowFilter = task.addJob<RenderShadowCascadeSetup>(jobName, shadowFrame, i, shadowCasterReceiverFilter);
 
-        const auto cullInputs = CullShadowBounds::Inputs(sortedShapes, shadowFilter, antiFrustum, currentKeyLight, cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(2)).asVarying();
-        sprintf(jobName, "CullShadowCascade%d", i);
-        const auto culledShadowItemsAndBounds = task.addJob<CullShadowBounds>(jobName, cullInputs);
+        cascadeSceneBBoxes[i] = cascadeBounds.getN<CascadeBoxes>(i);
 
         // GPU jobs: Render to shadow map
         sprintf(jobName, "RenderShadowMap%d", i);
-        const auto shadowInputs = RenderShadowMap::Inputs(culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(0),
-            culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(1), shadowFrame).asVarying();
+        const auto shadowInputs = RenderShadowMap::Inputs(cascadeShapes.getN<CullShadowCascades::CascadeShapes>(i),
+            cascadeSceneBBoxes[i], shadowFrame).asVarying();
         task.addJob<RenderShadowMap>(jobName, shadowInputs, shapePlumber, i);
         sprintf(jobName, "ShadowCascadeTeardown%d", i);
         task.addJob<RenderShadowCascadeTeardown>(jobName, shadowFilter);
-
-        cascadeSceneBBoxes[i] = culledShadowItemsAndBounds.getN<CullShadowBounds::Outputs>(1);
     }
     task.addJob<RenderShadowTeardown>("ShadowTeardown", setupOutput);
 
@@ -472,43 +460,37 @@ void RenderShadowSetup::run(const render::RenderContextPointer& renderContext, c
     output.edit1() = queryResolution;
 }
 
+static RenderShadowTask::CullFunctor evalCascadeCullFunctor(const LightStage::Shadow::Cascade& cascade) {
+    const auto& cascadeFrustum = cascade.getFrustum();
+    auto texelSize = glm::min(cascadeFrustum->getHeight(), cascadeFrustum->getWidth()) / cascade.framebuffer->getSize().x;
+    // Set the cull threshold to 24 shadow texels. This is totally arbitrary
+    const auto minTexelCount = 24.0f;
+    // TODO : maybe adapt that with LOD management system?
+    texelSize *= minTexelCount;
+
+    RenderShadowTask::CullFunctor cullFunctor;
+    cullFunctor._minSquareSize = texelSize * texelSize;
+    return cullFunctor;
+}
+
 void RenderShadowCascadeSetup::run(const render::RenderContextPointer& renderContext, const Inputs& input, Outputs& output) {
     const auto shadowFrame = input;
 
     // Cache old render args
     RenderArgs* args = renderContext->args;
 
-    RenderShadowTask::CullFunctor cullFunctor;
+    output = ItemFilter::Builder::nothing();
     if (shadowFrame && !shadowFrame->_objects.empty() && shadowFrame->_objects[0]) {
         const auto globalShadow = shadowFrame->_objects[0];
 
         if (globalShadow && _cascadeIndex < globalShadow->getCascadeCount()) {
-            output.edit0() = _filter;
+            output = _filter;
 
             // Set the keylight render args
             auto& cascade = globalShadow->getCascade(_cascadeIndex);
-            auto& cascadeFrustum = cascade.getFrustum();
-            args->pushViewFrustum(*cascadeFrustum);
-            auto texelSize = glm::min(cascadeFrustum->getHeight(), cascadeFrustum->getWidth()) / cascade.framebuffer->getSize().x;
-            // Set the cull threshold to 24 shadow texels. This is totally arbitrary
-            const auto minTexelCount = 24.0f;
-            // TODO : maybe adapt that with LOD management system?
-            texelSize *= minTexelCount;
-            cullFunctor._minSquareSize = texelSize * texelSize;
-
-            output.edit1() = cascadeFrustum;
-
-        } else {
-            output.edit0() = ItemFilter::Builder::nothing();
-            output.edit1() = ViewFrustumPointer();
+            args->pushViewFrustum(*cascade.getFrustum());
         }
     }
-    else {
-        output.edit0() = ItemFilter::Builder::nothing();
-        output.edit1() = ViewFrustumPointer();
-    }
-
-    output.edit2() = cullFunctor;
 }
 
 void RenderShadowCascadeTeardown::run(const render::RenderContextPointer& renderContext, const Input& input) {
@@ -549,85 +531,97 @@ static AABox& merge(AABox& box, const AABox& otherBox, const glm::vec3& dir) {
     return box;
 }
 
-void CullShadowBounds::run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
+// Culls the shapes of a single cascade. It only reads the scene items and its arguments so several cascades can be
+// culled at the same time.
+static void cullShadowCascade(const render::ScenePointer& scene, const RenderArgs* args, const ShapeBounds& inShapes,
+                              const ItemFilter& castersFilter, const RenderShadowTask::CullFunctor& cullFunctor,
+                              const ViewFrustum& frustum, const ViewFrustumPointer& antiFrustum, const glm::vec3& globalLightDir,
+                              ShapeBounds& outShapes, AABox& outBounds, RenderDetails::Item& details) {
+    for (auto& inItems : inShapes) {
+        auto key = inItems.first;
+        auto outItems = outShapes.find(key);
+        if (outItems == outShapes.end()) {
+            outItems = outShapes.insert(std::make_pair(key, ItemBounds{})).first;
+            outItems->second.reserve(inItems.second.size());
+        }
+
+        details._considered += (int)inItems.second.size();
+
+        for (auto& item : inItems.second) {
+            if (!cullFunctor(args, item.bound)) {
+                details._tooSmall++;
+                continue;
+            }
+            if (!frustum.boxIntersectsFrustum(item.bound) || (antiFrustum && antiFrustum->boxInsideFrustum(item.bound))) {
+                details._outOfView++;
+                continue;
+            }
+
+            const auto shapeKey = scene->getItem(item.id).getKey();
+            if (castersFilter.test(shapeKey)) {
+                outItems->second.emplace_back(item);
+                outBounds += item.bound;
+            } else {
+                // Receivers are not rendered but they still increase the bounds of the shadow scene
+                // although only in the direction of the light direction so as to have a correct far
+                // distance without decreasing the near distance.
+                merge(outBounds, item.bound, globalLightDir);
+            }
+        }
+        details._rendered += (int)outItems->second.size();
+    }
+
+    for (auto& items : outShapes) {
+        items.second.shrink_to_fit();
+    }
+}
+
+void CullShadowCascades::run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
     assert(renderContext->args);
-    assert(renderContext->args->hasViewFrustum());
     RenderArgs* args = renderContext->args;
 
     const auto& inShapes = inputs.get0();
-    const auto& filter = inputs.get1();
-    ViewFrustumPointer antiFrustum;
+    const auto& shadowFrame = inputs.get1();
+    const auto& currentKeyLight = inputs.get2();
     auto& outShapes = outputs.edit0();
     auto& outBounds = outputs.edit1();
 
-    if (!inputs[3].isNull()) {
-        antiFrustum = inputs.get2();
+    for (auto i = 0; i < SHADOW_CASCADE_MAX_COUNT; i++) {
+        outShapes[i].edit<ShapeBounds>().clear();
+        outBounds[i].edit<AABox>() = AABox();
     }
-    outShapes.clear();
-    outBounds = AABox();
-
-    const auto currentKeyLight = inputs.get3();
-    auto cullFunctor = inputs.get4();
-
-    render::CullFunctor shadowCullFunctor = [cullFunctor](const RenderArgs* args, const AABox& bounds) {
-        return cullFunctor(args, bounds);
-    };
-
-    if (!filter.selectsNothing() && currentKeyLight) {
-        auto& details = args->_details.edit(RenderDetails::SHADOW);
-        render::CullTest test(shadowCullFunctor, args, details, antiFrustum);
-        auto scene = args->_scene;
-        auto lightStage = renderContext->_scene->getStage<LightStage>();
-        assert(lightStage);
-        const auto globalLightDir = currentKeyLight->getDirection();
-        auto castersFilter = render::ItemFilter::Builder(filter).withShadowCaster().build();
-
-        for (auto& inItems : inShapes) {
-            auto key = inItems.first;
-            auto outItems = outShapes.find(key);
-            if (outItems == outShapes.end()) {
-                outItems = outShapes.insert(std::make_pair(key, ItemBounds{})).first;
-                outItems->second.reserve(inItems.second.size());
-            }
 
-            details._considered += (int)inItems.second.size();
-
-            if (antiFrustum == nullptr) {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
-                    }
-                }
-            } else {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound) && test.antiFrustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
-                    }
-                }
-            }
-            details._rendered += (int)outItems->second.size();
-        }
+    LightStage::ShadowPointer globalShadow;
+    if (shadowFrame && !shadowFrame->_objects.empty()) {
+        globalShadow = shadowFrame->_objects.front();
+    }
+    if (!globalShadow || !currentKeyLight || _filter.selectsNothing()) {
+        return;
+    }
+
+    const auto cascadeCount = globalShadow->getCascadeCount();
+    const auto scene = args->_scene;
+    const auto globalLightDir = currentKeyLight->getDirection();
+    const auto castersFilter = ItemFilter::Builder(_filter).withShadowCaster().build();
+    RenderDetails::Item cascadeDetails[SHADOW_CASCADE_MAX_COUNT];
 
-        for (auto& items : outShapes) {
-            items.second.shrink_to_fit();
+    tbb::parallel_for(0u, cascadeCount, [&](unsigned int i) {
+        const auto& cascade = globalShadow->getCascade(i);
+        // Items completely inside the cascade two levels closer are already covered by its finer shadow map
+        ViewFrustumPointer antiFrustum;
+        if (i > 1) {
+            antiFrustum = globalShadow->getCascade(i - 2).getFrustum();
         }
+        cullShadowCascade(scene, args, inShapes, castersFilter, evalCascadeCullFunctor(cascade), *cascade.getFrustum(),
+                          antiFrustum, globalLightDir, outShapes[i].edit<ShapeBounds>(), outBounds[i].edit<AABox>(),
+                          cascadeDetails[i]);
+    });
+
+    auto& details = args->_details.edit(RenderDetails::SHADOW);
+    for (unsigned int i = 0; i < cascadeCount; i++) {
+        details._considered += cascadeDetails[i]._considered;
+        details._outOfView += cascadeDetails[i]._outOfView;
+        details._tooSmall += cascadeDetails[i]._tooSmall;
+        details._rendered += cascadeDetails[i]._rendered;
     }
 }
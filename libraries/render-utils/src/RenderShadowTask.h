@@ -147,7 +147,7 @@ private:
 class RenderShadowCascadeSetup {
 public:
     using Inputs = LightStage::ShadowFramePointer;
-    using Outputs = render::VaryingSet3<render::ItemFilter, ViewFrustumPointer, RenderShadowTask::CullFunctor>;
+    using Outputs = render::ItemFilter;
     using JobModel = render::Job::ModelIO<RenderShadowCascadeSetup, Inputs, Outputs>;
 
     RenderShadowCascadeSetup(unsigned int cascadeIndex, render::ItemFilter filter) : _cascadeIndex(cascadeIndex), _filter(filter) {}
@@ -173,13 +173,21 @@ public:
     void run(const render::RenderContextPointer& renderContext, const Input& input);
 };
 
-class CullShadowBounds {
+// Culls the sorted shadow shapes against every cascade of the key light shadow at once. The cascades only read the
+// shapes and their own frustums so each one is culled as a separate TBB task.
+class CullShadowCascades {
 public:
-    using Inputs = render::VaryingSet5<render::ShapeBounds, render::ItemFilter, ViewFrustumPointer, graphics::LightPointer, RenderShadowTask::CullFunctor>;
-    using Outputs = render::VaryingSet2<render::ShapeBounds, AABox>;
-    using JobModel = render::Job::ModelIO<CullShadowBounds, Inputs, Outputs>;
+    using CascadeShapes = render::VaryingArray<render::ShapeBounds, SHADOW_CASCADE_MAX_COUNT>;
+    using Inputs = render::VaryingSet3<render::ShapeBounds, LightStage::ShadowFramePointer, graphics::LightPointer>;
+    using Outputs = render::VaryingSet2<CascadeShapes, RenderShadowTask::CascadeBoxes>;
+    using JobModel = render::Job::ModelIO<CullShadowCascades, Inputs, Outputs>;
+
+    CullShadowCascades(render::ItemFilter filter) : _filter(filter) {}
 
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs);
+
+private:
+    render::ItemFilter _filter;
 };
 
 #endif // hifi_RenderShadowTask_h
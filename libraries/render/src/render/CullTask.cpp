@@ -16,9 +16,46 @@
 
 #include <PerfStat.h>
 #include <OctreeUtils.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
+// below this many items a cull runs inline on the render thread: splitting it costs more than it saves
+static const size_t PARALLEL_CULL_MIN_ITEMS = 1024;
+static const size_t PARALLEL_CULL_GRAIN_SIZE = 256;
+
+// Runs cullRange(begin, end, out, details) over [0, numItems), in fixed-size chunks on the TBB pool when there is enough
+// work. Every chunk culls into its own list and counters which are then appended in chunk order, so the output is the
+// same as a serial pass no matter how the chunks were scheduled.
+template <typename F>
+static void parallelCullRange(size_t numItems, ItemBounds& outItems, RenderDetails::Item& details, const F& cullRange) {
+    if (numItems < PARALLEL_CULL_MIN_ITEMS) {
+        cullRange((size_t)0, numItems, outItems, details);
+        return;
+    }
+
+    const size_t numChunks = (numItems + PARALLEL_CULL_GRAIN_SIZE - 1) / PARALLEL_CULL_GRAIN_SIZE;
+    std::vector<ItemBounds> chunkItems(numChunks);
+    std::vector<RenderDetails::Item> chunkDetails(numChunks);
+    tbb::parallel_for((size_t)0, numChunks, [&](size_t chunk) {
+        size_t begin = chunk * PARALLEL_CULL_GRAIN_SIZE;
+        size_t end = std::min(begin + PARALLEL_CULL_GRAIN_SIZE, numItems);
+        chunkItems[chunk].reserve(end - begin);
+        cullRange(begin, end, chunkItems[chunk], chunkDetails[chunk]);
+    });
+
+    size_t numCulled = outItems.size();
+    for (const auto& items : chunkItems) {
+        numCulled += items.size();
+    }
+    outItems.reserve(numCulled);
+    for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+        outItems.insert(outItems.end(), chunkItems[chunk].begin(), chunkItems[chunk].end());
+        details._outOfView += chunkDetails[chunk]._outOfView;
+        details._tooSmall += chunkDetails[chunk]._tooSmall;
+    }
+}
+
 CullTest::CullTest(CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum) :
     _functor(functor),
     _args(pargs),
@@ -80,38 +117,33 @@ void render::cullItems(const RenderContextPointer& renderContext, const CullFunc
     // bool isNull() const { return _scale == glm::vec3(0.0f, 0.0f, 0.0f); }
     // So if the scale of the object's AABox is 0 return true and then it gets rendered???????
 
-    for (auto item : inItems) { // iterate thru the list of items to consider culling
-        if (item.bound.isNull()) { // CPM question: this appears to be the criteria for adding it?
-            outItems.emplace_back(item); // One more Item to render. This adds it to the back of the list.
-            continue;
-        }
-
-        // TODO: some entity types (like lights) might want to be rendered even
-        // when they are outside of the view frustum...
-        // CPM How about PARTICLE SYSTEMS.
-        // Is the ViewFrustum origin (camera) in a top level zone with Zone Culling turned on?
-        // 
-
-        bool inView;
-        {
-            PerformanceTimer perfTimer("boxIntersectsFrustum");
-            inView = frustum.boxIntersectsFrustum(item.bound);
-        }
-        if (inView) {
-            bool bigEnoughToRender;
-            {
-                PerformanceTimer perfTimer("shouldRender");
-                bigEnoughToRender = cullFunctor(args, item.bound); // cpm investigate cullfunctor
+    PerformanceTimer perfTimer("cullItems");
+    parallelCullRange(inItems.size(), outItems, details,
+                      [&](size_t begin, size_t end, ItemBounds& rangeItems, RenderDetails::Item& rangeDetails) {
+        for (size_t i = begin; i < end; ++i) { // iterate thru the list of items to consider culling
+            const auto& item = inItems[i];
+            if (item.bound.isNull()) { // CPM question: this appears to be the criteria for adding it?
+                rangeItems.emplace_back(item); // One more Item to render. This adds it to the back of the list.
+                continue;
             }
-            if (bigEnoughToRender) {
-                outItems.emplace_back(item); // One more Item to render
+
+            // TODO: some entity types (like lights) might want to be rendered even
+            // when they are outside of the view frustum...
+            // CPM How about PARTICLE SYSTEMS.
+            // Is the ViewFrustum origin (camera) in a top level zone with Zone Culling turned on?
+            //
+
+            if (frustum.boxIntersectsFrustum(item.bound)) {
+                if (cullFunctor(args, item.bound)) { // cpm investigate cullfunctor
+                    rangeItems.emplace_back(item); // One more Item to render
+                } else {
+                    rangeDetails._tooSmall++;
+                }
             } else {
-                details._tooSmall++;
+                rangeDetails._outOfView++;
             }
-        } else {
-            details._outOfView++;
         }
-    }
+    });
     details._rendered += (int)outItems.size();
 }
 
@@ -213,8 +245,6 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         args->pushViewFrustum(_frozenFrustum); // replace the true view frustum by the frozen one
     }
 
-    CullTest test(_cullFunctor, args, details);
-
     // Now we have a selection of items to render
     outItems.clear();
     outItems.reserve(inSelection.numItems());
@@ -223,140 +253,66 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
     if (!srcFilter.selectsNothing()) {
         auto filter = render::ItemFilter::Builder(srcFilter).withoutSubMetaCulled().build();
 
-        // Now get the bound, and
-        // filter individually against the _filter
-        // visibility cull if partially selected ( octree cell contianing it was partial)
-        // distance cull if was a subcell item ( octree cell is way bigger than the item bound itself, so now need to test per item)
-        if (_skipCulling || _overrideSkipCulling) {
-            // inside & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // inside & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
+        // filter one list of selected items, optionally frustum and/or solid angle culling them,
+        // split across the worker threads when the list is long enough
+        ItemBounds culledItems;
+        auto cullSelectedItems = [&](const ItemIDs& ids, bool testFrustum, bool testSolidAngle) {
+            culledItems.clear();
+            parallelCullRange(ids.size(), culledItems, details,
+                              [&](size_t begin, size_t end, ItemBounds& rangeItems, RenderDetails::Item& rangeDetails) {
+                CullTest test(_cullFunctor, args, rangeDetails);
+                for (size_t i = begin; i < end; ++i) {
+                    auto id = ids[i];
                     auto& item = scene->getItem(id);
                     if (filter.test(item.getKey())) {
                         ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
+                        if ((!testFrustum || test.frustumTest(itemBound.bound)) &&
+                                (!testSolidAngle || test.solidAngleTest(itemBound.bound))) {
+                            rangeItems.emplace_back(itemBound);
                         }
                     }
                 }
-            }
-
-            // partial & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
+            });
+
+            // The sub items of meta cull groups are fetched here on the calling thread: fetchMetaSubItemBounds calls
+            // into the item's payload, which isn't written to be called from the worker threads.
+            for (const auto& itemBound : culledItems) {
+                outItems.emplace_back(itemBound);
+                auto& item = scene->getItem(itemBound.id);
+                if (item.getKey().isMetaCullGroup()) {
+                    item.fetchMetaSubItemBounds(outItems, (*scene));
                 }
             }
+        };
 
-            // partial & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
+        // Now get the bound, and
+        // filter individually against the _filter
+        // visibility cull if partially selected ( octree cell contianing it was partial)
+        // distance cull if was a subcell item ( octree cell is way bigger than the item bound itself, so now need to test per item)
+        const bool skipCulling = _skipCulling || _overrideSkipCulling;
 
-        } else {
-            // CPM investigate
-            // inside & fit items: easy, just filter
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
+        // inside & fit items: easy, just filter
+        {
+            PerformanceTimer perfTimer("insideFitItems");
+            cullSelectedItems(inSelection.insideItems, false, false);
+        }
 
-            // inside & subcell items: filter & distance cull
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
-            }
+        // inside & subcell items: filter & distance cull
+        {
+            PerformanceTimer perfTimer("insideSmallItems");
+            cullSelectedItems(inSelection.insideSubcellItems, false, !skipCulling);
+        }
 
-            // partial & fit items: filter & frustum cull
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & fit items: filter & frustum cull
+        {
+            PerformanceTimer perfTimer("partialFitItems");
+            cullSelectedItems(inSelection.partialItems, !skipCulling, false);
+        }
 
-            // partial & subcell items:: filter & frutum cull & solidangle cull
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            if (test.solidAngleTest(itemBound.bound)) {
-                                outItems.emplace_back(itemBound);
-                                if (item.getKey().isMetaCullGroup()) {
-                                    item.fetchMetaSubItemBounds(outItems, (*scene));
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & subcell items:: filter & frutum cull & solidangle cull
+        {
+            PerformanceTimer perfTimer("partialSmallItems");
+            cullSelectedItems(inSelection.partialSubcellItems, !skipCulling, !skipCulling);
         }
     }
 
@@ -11,6 +11,7 @@
 #include "EngineStats.h"
 
 #include <gpu/Texture.h>
+#include <NumericalConstants.h>
 
 using namespace render;
 
@@ -64,5 +65,11 @@ void EngineStats::run(const RenderContextPointer& renderContext) {
     config->frameSetPipelineCount = _gpuStats._PSNumSetPipelines;
     config->frameSetInputFormatCount = _gpuStats._ISNumFormatChanges;
 
+    const auto& transactionStats = renderContext->_scene->getTransactionStats();
+    config->frameItemUpdateCount = transactionStats.numUpdates;
+    config->frameItemTransformUpdateCount = transactionStats.numTransformUpdates;
+    config->frameUpdatedItemCount = transactionStats.numItemsUpdated;
+    config->frameTransactionTime = (float)transactionStats.processingTime / (float)USECS_PER_MSEC;
+
     // These new stat values are notified with the "newStats" signal triggered by the timer
 }
@@ -61,6 +61,11 @@ namespace render {
         Q_PROPERTY(quint32 frameSetPipelineCount MEMBER frameSetPipelineCount NOTIFY newStats)
         Q_PROPERTY(quint32 frameSetInputFormatCount MEMBER frameSetInputFormatCount NOTIFY newStats)
 
+        Q_PROPERTY(quint32 frameItemUpdateCount MEMBER frameItemUpdateCount NOTIFY newStats)
+        Q_PROPERTY(quint32 frameItemTransformUpdateCount MEMBER frameItemTransformUpdateCount NOTIFY newStats)
+        Q_PROPERTY(quint32 frameUpdatedItemCount MEMBER frameUpdatedItemCount NOTIFY newStats)
+        Q_PROPERTY(float frameTransactionTime MEMBER frameTransactionTime NOTIFY newStats)
+
 
     public:
         EngineStatsConfig() : Job::Config(true) {}
@@ -101,6 +106,11 @@ namespace render {
         quint32 frameSetPipelineCount{ 0 };
 
         quint32 frameSetInputFormatCount{ 0 };
+
+        quint32 frameItemUpdateCount{ 0 };
+        quint32 frameItemTransformUpdateCount{ 0 };
+        quint32 frameUpdatedItemCount{ 0 };
+        float frameTransactionTime{ 0.0f }; // msecs
     };
 
     class EngineStats {
@@ -79,6 +79,11 @@ void Item::update(const UpdateFunctorPointer& updateFunctor) {
    _key = _payload->getKey();
 }
 
+void Item::updateTransform(const Transform& transform) {
+    _payload->updateTransform(transform);
+    _key = _payload->getKey();
+}
+
 void Item::resetPayload(const PayloadPointer& payload) {
     if (!payload) {
         kill();
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include <AABox.h>
+#include <Transform.h>
 
 #include "Args.h"
 
@@ -450,6 +451,7 @@ public:
 
         friend class Item;
         virtual void update(const UpdateFunctorPointer& functor) = 0;
+        virtual void updateTransform(const Transform& transform) = 0;
     };
     typedef std::shared_ptr<PayloadInterface> PayloadPointer;
     typedef std::weak_ptr<PayloadInterface> PayloadWeakPointer;
@@ -464,6 +466,7 @@ public:
     void resetPayload(const PayloadPointer& payload);
     void resetCell(ItemCell cell = INVALID_CELL, bool _small = false) { _cell = cell; _key.setSmaller(_small); }
     void update(const UpdateFunctorPointer& updateFunctor); // communicate update to payload
+    void updateTransform(const Transform& transform); // communicate a typed transform update to payload
     void kill() { _payload.reset(); resetCell(); _key._flags.reset(); } // forget the payload, key, cell
 
     // Check heuristic key
@@ -541,6 +544,11 @@ template <class T> const ShapeKey shapeGetShapeKey(const std::shared_ptr<T>& pay
 // Meta items act as the grouping object for several sub items (typically shapes).
 template <class T> uint32_t metaFetchMetaSubItems(const std::shared_ptr<T>& payloadData, ItemIDs& subItems) { return 0; }
 
+// Transform update interface
+// Payloads moved every frame can specialize this to take Transaction::updateItemTransform,
+// which doesn't allocate an update functor. The default version ignores the transform.
+template <class T> void payloadUpdateTransform(const std::shared_ptr<T>& payloadData, const Transform& transform) { }
+
 // THe Payload class is the real Payload to be used
 // THis allow anything to be turned into a Payload as long as the required interface functions are available
 // When creating a new kind of payload from a new "stuff" class then you need to create specialized version for "stuff"
@@ -572,6 +580,7 @@ protected:
     virtual void update(const UpdateFunctorPointer& functor) override {
         std::static_pointer_cast<Updater>(functor)->_func((*_data));
     }
+    virtual void updateTransform(const Transform& transform) override { payloadUpdateTransform<T>(_data, transform); }
     friend class Item;
 };
 
@@ -12,6 +12,7 @@
 
 #include <numeric>
 #include <gpu/Batch.h>
+#include <SharedUtil.h>
 #include "Logging.h"
 #include "TransitionStage.h"
 #include "HighlightStage.h"
@@ -51,6 +52,10 @@ void Transaction::updateItem(ItemID id, const UpdateFunctorPointer& functor) {
     _updatedItems.emplace_back(id, functor);
 }
 
+void Transaction::updateItemTransform(ItemID id, const Transform& transform) {
+    _updatedTransforms.emplace_back(id, transform, _updatedItems.size());
+}
+
 void Transaction::resetSelection(const Selection& selection) {
     _resetSelections.emplace_back(selection);
 }
@@ -71,6 +76,7 @@ void Transaction::reserve(const std::vector<Transaction>& transactionContainer)
     size_t resetItemsCount = 0;
     size_t removedItemsCount = 0;
     size_t updatedItemsCount = 0;
+    size_t updatedTransformsCount = 0;
     size_t resetSelectionsCount = 0;
     size_t resetTransitionsCount = 0;
     size_t removeTransitionsCount = 0;
@@ -84,6 +90,7 @@ void Transaction::reserve(const std::vector<Transaction>& transactionContainer)
         resetItemsCount += transaction._resetItems.size();
         removedItemsCount += transaction._removedItems.size();
         updatedItemsCount += transaction._updatedItems.size();
+        updatedTransformsCount += transaction._updatedTransforms.size();
         resetSelectionsCount += transaction._resetSelections.size();
         resetTransitionsCount += transaction._resetTransitions.size();
         removeTransitionsCount += transaction._removeTransitions.size();
@@ -97,6 +104,7 @@ void Transaction::reserve(const std::vector<Transaction>& transactionContainer)
     _resetItems.reserve(resetItemsCount);
     _removedItems.reserve(removedItemsCount);
     _updatedItems.reserve(updatedItemsCount);
+    _updatedTransforms.reserve(updatedTransformsCount);
     _resetSelections.reserve(resetSelectionsCount);
     _resetTransitions.reserve(resetTransitionsCount);
     _removeTransitions.reserve(removeTransitionsCount);
@@ -141,6 +149,8 @@ void copyElements(T& target, const T& source) {
 void Transaction::merge(Transaction&& transaction) {
     moveElements(_resetItems, transaction._resetItems);
     moveElements(_removedItems, transaction._removedItems);
+    appendTransformUpdates(transaction._updatedTransforms);
+    transaction._updatedTransforms.clear();
     moveElements(_updatedItems, transaction._updatedItems);
     moveElements(_resetSelections, transaction._resetSelections);
     moveElements(_resetTransitions, transaction._resetTransitions);
@@ -155,6 +165,7 @@ void Transaction::merge(Transaction&& transaction) {
 void Transaction::merge(const Transaction& transaction) {
     copyElements(_resetItems, transaction._resetItems);
     copyElements(_removedItems, transaction._removedItems);
+    appendTransformUpdates(transaction._updatedTransforms);
     copyElements(_updatedItems, transaction._updatedItems);
     copyElements(_resetSelections, transaction._resetSelections);
     copyElements(_resetTransitions, transaction._resetTransitions);
@@ -166,10 +177,18 @@ void Transaction::merge(const Transaction& transaction) {
     copyElements(_highlightQueries, transaction._highlightQueries);
 }
 
+void Transaction::appendTransformUpdates(const TransformUpdates& transformUpdates) {
+    // the functor updates queued before them now include those already in this transaction
+    for (const auto& update : transformUpdates) {
+        _updatedTransforms.emplace_back(std::get<0>(update), std::get<1>(update), std::get<2>(update) + _updatedItems.size());
+    }
+}
+
 void Transaction::clear() {
     _resetItems.clear();
     _removedItems.clear();
     _updatedItems.clear();
+    _updatedTransforms.clear();
     _resetSelections.clear();
     _resetTransitions.clear();
     _removeTransitions.clear();
@@ -185,6 +204,7 @@ Scene::Scene(glm::vec3 origin, float size) :
     _masterSpatialTree(origin, size)
 {
     _items.push_back(Item()); // add the itemID #0 to nothing
+    _itemUpdateFrames.push_back(0);
 }
 
 Scene::~Scene() {
@@ -232,6 +252,7 @@ uint32_t Scene::enqueueFrame() {
  
 void Scene::processTransactionQueue() {
     PROFILE_RANGE(render, __FUNCTION__);
+    uint64_t start = usecTimestampNow();
 
     static TransactionFrames queuedFrames;
     {
@@ -240,12 +261,16 @@ void Scene::processTransactionQueue() {
         queuedFrames.swap(_transactionFrames);
     }
 
+    _transactionStats = TransactionStats();
+    _transactionStats.numFrames = (uint32_t)queuedFrames.size();
+
     // go through the queue of frames and process them
     for (auto& frame : queuedFrames) {
         processTransactionFrame(frame);
     }
 
     queuedFrames.clear();
+    _transactionStats.processingTime = usecTimestampNow() - start;
 }
 
 void Scene::processTransactionFrame(const Transaction& transaction) {
@@ -257,6 +282,7 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
         ItemID maxID = _IDAllocator.load();
         if (maxID > _items.size()) {
             _items.resize(maxID + 100); // allocate the maxId and more
+            _itemUpdateFrames.resize(_items.size(), 0);
         }
         // Now we know for sure that we have enough items in the array to
         // capture anything coming from the transaction
@@ -268,7 +294,9 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
         _numAllocatedItems.exchange(maxID);
 
         // updates
-        updateItems(transaction._updatedItems);
+        ++_updateFrame;
+        updateItems(transaction._updatedItems, transaction._updatedTransforms);
+        updateItemContainers();
 
         // removes
         removeItems(transaction._removedItems);
@@ -335,8 +363,30 @@ void Scene::removeItems(const Transaction::Removes& transactions) {
     }
 }
 
-void Scene::updateItems(const Transaction::Updates& transactions) {
-    for (auto& update : transactions) {
+void Scene::updateItems(const Transaction::Updates& transactions, const Transaction::TransformUpdates& transformTransactions) {
+    // Only the last transform queued for an item matters, so find those walking backwards.  No functor has been
+    // applied yet, so noteItemUpdated still records the keys the items had before this frame.
+    _lastTransformUpdates.clear();
+    for (size_t i = transformTransactions.size(); i-- > 0;) {
+        auto updateID = std::get<0>(transformTransactions[i]);
+        if (updateID == Item::INVALID_ITEM_ID || !_items[updateID].exist() || !noteItemUpdated(updateID)) {
+            continue;
+        }
+        _lastTransformUpdates.push_back(i);
+    }
+
+    // Then apply them with the functors, each transform ahead of the functors queued after it
+    auto nextTransform = _lastTransformUpdates.rbegin();
+    for (size_t i = 0; i <= transactions.size(); ++i) {
+        for (; nextTransform != _lastTransformUpdates.rend() && std::get<2>(transformTransactions[*nextTransform]) <= i; ++nextTransform) {
+            const auto& transformUpdate = transformTransactions[*nextTransform];
+            _items[std::get<0>(transformUpdate)].updateTransform(std::get<1>(transformUpdate));
+        }
+        if (i == transactions.size()) {
+            break;
+        }
+
+        const auto& update = transactions[i];
         auto updateID = std::get<0>(update);
         if (updateID == Item::INVALID_ITEM_ID) {
             continue;
@@ -350,12 +400,31 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
             continue;
         }
 
+        // Update the item, its container is dealt with once all the updates are in
+        noteItemUpdated(updateID);
+        item.update(std::get<1>(update));
+    }
+    _transactionStats.numUpdates += (uint32_t)(transactions.size() + transformTransactions.size());
+    _transactionStats.numTransformUpdates += (uint32_t)transformTransactions.size();
+}
+
+bool Scene::noteItemUpdated(ItemID id) {
+    if (_itemUpdateFrames[id] == _updateFrame) {
+        return false;
+    }
+    _itemUpdateFrames[id] = _updateFrame;
+    _updatedItemKeys.emplace_back(id, _items[id].getKey());
+    return true;
+}
+
+void Scene::updateItemContainers() {
+    for (const auto& updatedItem : _updatedItemKeys) {
+        auto updateID = updatedItem.first;
+        auto& item = _items[updateID];
+
         // Good to go, deal with the update
         auto oldCell = item.getCell();
-        auto oldKey = item.getKey();
-
-        // Update the item
-        item.update(std::get<1>(update));
+        const auto& oldKey = updatedItem.second;
         auto newKey = item.getKey();
 
         // Update the item's container
@@ -378,6 +447,8 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
             }
         }
     }
+    _transactionStats.numItemsUpdated += (uint32_t)_updatedItemKeys.size();
+    _updatedItemKeys.clear();
 }
 
 void Scene::resetTransitionItems(const Transaction::TransitionResets& transactions) {
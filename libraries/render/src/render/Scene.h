@@ -56,6 +56,11 @@ public:
     void updateItem(ItemID id, const UpdateFunctorPointer& functor);
     void updateItem(ItemID id) { updateItem(id, nullptr); }
 
+    // Typed transform update, for payloads specializing payloadUpdateTransform.
+    // Doesn't allocate, and only the last one queued for an item in a frame is applied, in its place among the
+    // functor updates.
+    void updateItemTransform(ItemID id, const Transform& transform);
+
     // Transition (applied to an item) transactions
     void resetTransitionOnItem(ItemID id, Transition::Type transition, ItemID boundId = render::Item::INVALID_ITEM_ID);
     void removeTransitionFromItem(ItemID id);
@@ -81,6 +86,7 @@ protected:
     using Reset = std::tuple<ItemID, PayloadPointer>;
     using Remove = ItemID;
     using Update = std::tuple<ItemID, UpdateFunctorPointer>;
+    using TransformUpdate = std::tuple<ItemID, Transform, size_t>; // and the number of functor updates queued before it
 
     using TransitionReset = std::tuple<ItemID, Transition::Type, ItemID>;
     using TransitionRemove = ItemID;
@@ -96,6 +102,7 @@ protected:
     using Resets = std::vector<Reset>;
     using Removes = std::vector<Remove>;
     using Updates = std::vector<Update>;
+    using TransformUpdates = std::vector<TransformUpdate>;
 
     using TransitionResets = std::vector<TransitionReset>;
     using TransitionRemoves = std::vector<TransitionRemove>;
@@ -111,6 +118,9 @@ protected:
     Resets _resetItems;
     Removes _removedItems;
     Updates _updatedItems;
+    TransformUpdates _updatedTransforms;
+    // Appends another transaction's transform updates, ahead of its functor updates
+    void appendTransformUpdates(const TransformUpdates& transformUpdates);
     
     TransitionResets _resetTransitions;
     TransitionRemoves _removeTransitions;
@@ -196,6 +206,16 @@ public:
 
     size_t getTransactionQueueSize() { return _transactionQueue.size(); }
 
+    // What the last processTransactionQueue went through
+    struct TransactionStats {
+        uint32_t numFrames { 0 };
+        uint32_t numUpdates { 0 }; // functor and transform updates
+        uint32_t numTransformUpdates { 0 };
+        uint32_t numItemsUpdated { 0 }; // distinct items touched by the updates
+        uint64_t processingTime { 0 }; // usecs
+    };
+    const TransactionStats& getTransactionStats() const { return _transactionStats; }
+
 protected:
 
     // Thread safe elements that can be accessed from anywhere
@@ -223,7 +243,19 @@ protected:
     void resetItems(const Transaction::Resets& transactions);
     void resetTransitionFinishedOperator(const Transaction::TransitionFinishedOperators& transactions);
     void removeItems(const Transaction::Removes& transactions);
-    void updateItems(const Transaction::Updates& transactions);
+    // Applies the functor and transform updates in the order they were queued
+    void updateItems(const Transaction::Updates& transactions, const Transaction::TransformUpdates& transformTransactions);
+    std::vector<size_t> _lastTransformUpdates; // reused by updateItems
+
+    // Items get their container updated once per frame however many updates they received.
+    // Returns false if the item was already updated this frame.
+    bool noteItemUpdated(ItemID id);
+    void updateItemContainers();
+    std::vector<uint32_t> _itemUpdateFrames; // the last frame each item was updated in
+    uint32_t _updateFrame { 0 };
+    std::vector<std::pair<ItemID, ItemKey>> _updatedItemKeys; // the key each updated item had before its first update
+
+    TransactionStats _transactionStats;
 
     void resetTransitionItems(const Transaction::TransitionResets& transactions);
     void removeTransitionItems(const Transaction::TransitionRemoves& transactions);
@@ -306,6 +306,9 @@ public:
 
     void prepareShapeItem(Args* args, const ShapeKey& key, const Item& shape);
 
+    // Pipelines with an item setter (fade) carry per item state and can't be shared by instanced draws
+    bool hasItemSetter() const { return (bool)_itemSetter; }
+
 protected:
     friend class ShapePlumber;
 
@@ -14,85 +14,101 @@
 
 #include <assert.h>
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
+#include <tbb/parallel_sort.h>
 
 using namespace render;
 
-struct ItemBoundSort {
-    float _centerDepth = 0.0f;
-    float _nearDepth = 0.0f;
-    float _farDepth = 0.0f;
-    ItemID _id = 0;
-    AABox _bounds;
+// below this many items depth sorting runs inline on the render thread
+static const size_t PARALLEL_SORT_MIN_ITEMS = 2048;
+static const size_t PARALLEL_SORT_GRAIN_SIZE = 512;
 
-    ItemBoundSort() {}
-    ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
+// Sort key: the squared distance of the item center and its position in the input list. Sorting these 8 bytes keys
+// and gathering the ItemBounds afterwards is much cheaper than swapping whole ItemBounds around, and the index
+// tie-break keeps the order stable from frame to frame (and between the serial and parallel sorts).
+struct ItemDepth {
+    float _depth;
+    uint32_t _index;
 };
 
 struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
+    bool operator() (const ItemDepth& left, const ItemDepth& right) const {
+        return (left._depth < right._depth) || (left._depth == right._depth && left._index < right._index);
     }
 };
 
 struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
+    bool operator() (const ItemDepth& left, const ItemDepth& right) const {
+        return (left._depth > right._depth) || (left._depth == right._depth && left._index < right._index);
     }
 };
 
+template <typename Compare>
+static void sortItemDepths(std::vector<ItemDepth>& itemDepths, const Compare& compare) {
+    if (itemDepths.size() < PARALLEL_SORT_MIN_ITEMS) {
+        std::sort(itemDepths.begin(), itemDepths.end(), compare);
+    } else {
+        tbb::parallel_sort(itemDepths.begin(), itemDepths.end(), compare);
+    }
+}
+
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
                             const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
-    auto& scene = renderContext->_scene;
     RenderArgs* args = renderContext->args;
-
+    const ViewFrustum& frustum = args->getViewFrustum();
 
     // Allocate and simply copy
     outItems.clear();
     outItems.reserve(inItems.size());
 
-
-    // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
-
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound();
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    // Make a local dataset of the center distance
+    const size_t numItems = inItems.size();
+    std::vector<ItemDepth> itemDepths(numItems);
+    auto evalDepths = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            itemDepths[i]._depth = frustum.distanceToCameraSquared(inItems[i].bound.calcCenter());
+            itemDepths[i]._index = (uint32_t)i;
+        }
+    };
+    if (numItems < PARALLEL_SORT_MIN_ITEMS) {
+        evalDepths(0, numItems);
+    } else {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numItems, PARALLEL_SORT_GRAIN_SIZE),
+                          [&](const tbb::blocked_range<size_t>& range) {
+            evalDepths(range.begin(), range.end());
+        });
     }
 
     // sort against Z
     if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        sortItemDepths(itemDepths, FrontToBackSort());
     } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        sortItemDepths(itemDepths, BackToFrontSort());
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
     render::ItemID previousID = Item::INVALID_ITEM_ID;
     if (!bounds) {
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
+        for (const auto& itemDepth : itemDepths) {
+            const auto& item = inItems[itemDepth._index];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
             }
         }
-    } else if (!itemBoundSorts.empty()) {
+    } else if (!itemDepths.empty()) {
         if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
+            *bounds = inItems[itemDepths.front()._index].bound;
         }
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
-                *bounds += item._bounds;
+        for (const auto& itemDepth : itemDepths) {
+            const auto& item = inItems[itemDepth._index];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
+                *bounds += item.bound;
             }
         }
     }
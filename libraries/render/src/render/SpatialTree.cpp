@@ -11,6 +11,7 @@
 #include "SpatialTree.h"
 
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -435,6 +436,9 @@ ItemSpatialTree::Index ItemSpatialTree::resetItem(Index oldCell, const ItemKey&
     }
 }
 
+// trees with fewer cells than this are cheaper to traverse on one thread
+static const size_t PARALLEL_SELECT_MIN_CELLS = 512;
+
 int Octree::select(CellSelection& selection, const FrustumSelector& selector) const {
 
     Index cellID = ROOT_CELL;
@@ -445,10 +449,25 @@ int Octree::select(CellSelection& selection, const FrustumSelector& selector) co
     selectCellBrick(cellID, selection, false);
 
     // then traverse deeper
-    for (int i = 0; i < NUM_OCTANTS; i++) {
-        Index subCellID = cell.child((Link)i);
-        if (subCellID != INVALID_CELL) {
-            selectTraverse(subCellID, selection, selector);
+    if (_cells.size() < PARALLEL_SELECT_MIN_CELLS) {
+        for (int i = 0; i < NUM_OCTANTS; i++) {
+            Index subCellID = cell.child((Link)i);
+            if (subCellID != INVALID_CELL) {
+                selectTraverse(subCellID, selection, selector);
+            }
+        }
+    } else {
+        // big tree: traverse the octants of the root concurrently, each into its own selection,
+        // and append them in octant order so the result is identical to the serial traversal
+        std::array<CellSelection, NUM_OCTANTS> octantSelections;
+        tbb::parallel_for(0, (int)NUM_OCTANTS, [&](int i) {
+            Index subCellID = cell.child((Link)i);
+            if (subCellID != INVALID_CELL) {
+                selectTraverse(subCellID, octantSelections[i], selector);
+            }
+        });
+        for (const auto& octantSelection : octantSelections) {
+            selection.append(octantSelection);
         }
     }
 
@@ -631,6 +650,21 @@ int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter&
                                      float threshold) const {
     selectCells(selection.cellSelection, frustum, threshold);
 
+    // size the lists once up front rather than growing them brick by brick
+    auto reserveBrickItems = [&](const Indices& bricks, ItemIDs& items, ItemIDs& subcellItems) {
+        size_t numItems = items.size();
+        size_t numSubcellItems = subcellItems.size();
+        for (auto brickId : bricks) {
+            const auto& brick = getConcreteBrick(brickId);
+            numItems += brick.items.size();
+            numSubcellItems += brick.subcellItems.size();
+        }
+        items.reserve(numItems);
+        subcellItems.reserve(numSubcellItems);
+    };
+    reserveBrickItems(selection.cellSelection.insideBricks, selection.insideItems, selection.insideSubcellItems);
+    reserveBrickItems(selection.cellSelection.partialBricks, selection.partialItems, selection.partialSubcellItems);
+
     // Just grab the items in every selected bricks
     for (auto brickId : selection.cellSelection.insideBricks) {
         auto& brickItems = getConcreteBrick(brickId).items;
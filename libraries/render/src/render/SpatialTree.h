@@ -307,6 +307,13 @@ namespace render {
                 partialCells.clear();
                 partialBricks.clear();
             }
+
+            void append(const CellSelection& other) {
+                insideCells.insert(insideCells.end(), other.insideCells.begin(), other.insideCells.end());
+                insideBricks.insert(insideBricks.end(), other.insideBricks.begin(), other.insideBricks.end());
+                partialCells.insert(partialCells.end(), other.partialCells.begin(), other.partialCells.end());
+                partialBricks.insert(partialBricks.end(), other.partialBricks.begin(), other.partialBricks.end());
+            }
         };
 
         class FrustumSelector {
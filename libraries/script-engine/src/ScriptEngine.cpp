@@ -1268,6 +1268,9 @@ void ScriptEngine::run() {
     _lastUpdate = usecTimestampNow();
     std::chrono::microseconds totalUpdates(0);
 
+    // from here on, timers that come due are held and run together once per frame, just ahead of the update
+    _batchTimersPerFrame = true;
+
     // TODO: Integrate this with signals/slots instead of reimplementing throttling for ScriptEngine
     while (!_isFinished) {
         auto beforeSleep = clock::now();
@@ -1355,6 +1358,10 @@ void ScriptEngine::run() {
             }
         }
 
+        if (!_isFinished) {
+            fireDueTimers();
+        }
+
         qint64 now = usecTimestampNow();
 
         // we check for 'now' in the past in case people set their clock back
@@ -1383,6 +1390,8 @@ void ScriptEngine::run() {
     }
     scriptInfoMessage("Script Engine stopping:" + getFilename());
 
+    _batchTimersPerFrame = false;
+    _dueTimers.clear();
     stopAllTimers(); // make sure all our timers are stopped if the script is ending
     emit scriptEnding();
 
@@ -1503,6 +1512,31 @@ void ScriptEngine::timerFired() {
     }
 
     QTimer* callingTimer = reinterpret_cast<QTimer*>(sender());
+    if (_batchTimersPerFrame) {
+        _dueTimers.push_back(callingTimer);
+        return;
+    }
+    fireTimer(callingTimer);
+}
+
+void ScriptEngine::fireDueTimers() {
+    if (_dueTimers.empty()) {
+        return;
+    }
+
+    PROFILE_RANGE(script, __FUNCTION__);
+    // callbacks can set up timers that are due straight away, those wait for the next frame
+    std::vector<QPointer<QTimer>> dueTimers;
+    dueTimers.swap(_dueTimers);
+    for (const auto& timer : dueTimers) {
+        // skip the ones that were stopped after coming due, or by an earlier callback in this batch
+        if (timer && _timerFunctionMap.contains(timer)) {
+            fireTimer(timer);
+        }
+    }
+}
+
+void ScriptEngine::fireTimer(QTimer* callingTimer) {
     CallbackData timerData = _timerFunctionMap.value(callingTimer);
 
     if (!callingTimer->isActive()) {
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 #include <QtCore/QUrl>
 #include <QtCore/QSet>
 #include <QtCore/QWaitCondition>
@@ -893,6 +894,8 @@ protected:
 
     QString logException(const QScriptValue& exception);
     void timerFired();
+    void fireDueTimers();
+    void fireTimer(QTimer* timer);
     void stopAllTimers();
     void stopAllTimersForEntityScript(const EntityItemID& entityID);
     void refreshFileScript(const EntityItemID& entityID);
@@ -932,6 +935,8 @@ protected:
     std::atomic<bool> _isStopping { false };
     bool _isInitialized { false };
     QHash<QTimer*, CallbackData> _timerFunctionMap;
+    bool _batchTimersPerFrame { false };
+    std::vector<QPointer<QTimer>> _dueTimers;
     QSet<QUrl> _includedURLs;
     mutable QReadWriteLock _entityScriptsLock { QReadWriteLock::Recursive };
     QHash<EntityItemID, EntityScriptDetails> _entityScripts;
@@ -13,6 +13,7 @@
 
 #include <glm/gtc/quaternion.hpp>
 
+#include <QtCore/QPointer>
 #include <QtCore/QUrl>
 #include <QtCore/QUuid>
 #include <QtCore/QRect>
@@ -22,6 +23,7 @@
 #include <QtGui/QVector3D>
 #include <QtGui/QQuaternion>
 #include <QtNetwork/QAbstractSocket>
+#include <QtScript/QScriptString>
 #include <QtScript/QScriptValue>
 #include <QtScript/QScriptValueIterator>
 #include <QJsonDocument>
@@ -74,22 +76,103 @@ void registerMetaTypes(QScriptEngine* engine) {
     qScriptRegisterSequenceMetaType<QVector<unsigned int>>(engine);
 }
 
+namespace {
+
+// The property names and prototypes that the glm converters use on every call, made once per engine instead of
+// from strings and global lookups each time.
+struct ScriptTypeCache {
+    ScriptTypeCache(QScriptEngine* engine) :
+        x(engine->toStringHandle("x")),
+        y(engine->toStringHandle("y")),
+        z(engine->toStringHandle("z")),
+        w(engine->toStringHandle("w")),
+        u(engine->toStringHandle("u")),
+        v(engine->toStringHandle("v")),
+        r(engine->toStringHandle("r")),
+        g(engine->toStringHandle("g")),
+        b(engine->toStringHandle("b")),
+        red(engine->toStringHandle("red")),
+        green(engine->toStringHandle("green")),
+        blue(engine->toStringHandle("blue")),
+        length(engine->toStringHandle("length"))
+    {
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                mat4[column][row] = engine->toStringHandle(QString("r%1c%2").arg(row).arg(column));
+            }
+        }
+    }
+
+    QScriptString x, y, z, w;
+    QScriptString u, v;
+    QScriptString r, g, b;
+    QScriptString red, green, blue;
+    QScriptString length;
+    QScriptString mat4[4][4]; // indexed like glm::mat4, by column then row
+
+    QScriptValue vec2Prototype;
+    QScriptValue vec3Prototype;
+    QScriptValue vec3ColorPrototype;
+    QScriptValue u8vec3Prototype;
+    QScriptValue u8vec3ColorPrototype;
+};
+
+const char* SCRIPT_TYPE_CACHE_PROPERTY = "_hifiScriptTypeCache";
+
+ScriptTypeCache* getScriptTypeCache(QScriptEngine* engine) {
+    if (!engine) {
+        return nullptr;
+    }
+
+    // conversions happen on the engine's own thread, and almost always for the same engine as the last one there
+    static thread_local QPointer<QScriptEngine> lastEngine;
+    static thread_local ScriptTypeCache* lastCache { nullptr };
+    if (lastEngine.data() != engine) {
+        auto cache = static_cast<ScriptTypeCache*>(engine->property(SCRIPT_TYPE_CACHE_PROPERTY).value<void*>());
+        if (!cache) {
+            cache = new ScriptTypeCache(engine);
+            engine->setProperty(SCRIPT_TYPE_CACHE_PROPERTY, QVariant::fromValue<void*>(cache));
+            // the engine has already let go of the handles and values by the time it signals this
+            QObject::connect(engine, &QObject::destroyed, [cache] {
+                delete cache;
+            });
+        }
+        lastEngine = engine;
+        lastCache = cache;
+    }
+    return lastCache;
+}
+
+QScriptValue getPrototype(QScriptEngine* engine, QScriptValue& prototype, const char* name, const char* definition) {
+    if (!prototype.isObject() || prototype.isError()) {
+        prototype = engine->globalObject().property(name);
+        if (!prototype.property("defined").toBool()) {
+            prototype = engine->evaluate(definition);
+        }
+    }
+    return prototype;
+}
+
+// components are nearly always plain numbers, which need no trip through QVariant
+float toFloat(const QScriptValue& value) {
+    return value.isNumber() ? (float)value.toNumber() : value.toVariant().toFloat();
+}
+
+}
+
 QScriptValue vec2ToScriptValue(QScriptEngine* engine, const glm::vec2& vec2) {
-    auto prototype = engine->globalObject().property("__hifi_vec2__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto cache = getScriptTypeCache(engine);
+    auto prototype = getPrototype(engine, cache->vec2Prototype, "__hifi_vec2__",
             "__hifi_vec2__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "u: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "v: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec2.x);
-    value.setProperty("y", vec2.y);
+    value.setProperty(cache->x, vec2.x);
+    value.setProperty(cache->y, vec2.y);
     value.setPrototype(prototype);
     return value;
 }
@@ -97,25 +180,28 @@ QScriptValue vec2ToScriptValue(QScriptEngine* engine, const glm::vec2& vec2) {
 void vec2FromScriptValue(const QScriptValue& object, glm::vec2& vec2) {
     if (object.isNumber()) {
         vec2 = glm::vec2(object.toVariant().toFloat());
+    } else if (!object.engine()) {
+        vec2 = glm::vec2(0.0f);
     } else if (object.isArray()) {
-        QVariantList list = object.toVariant().toList();
-        if (list.length() == 2) {
-            vec2.x = list[0].toFloat();
-            vec2.y = list[1].toFloat();
+        auto cache = getScriptTypeCache(object.engine());
+        if (object.property(cache->length).toUInt32() == 2) {
+            vec2.x = toFloat(object.property(0));
+            vec2.y = toFloat(object.property(1));
         }
     } else {
-        QScriptValue x = object.property("x");
+        auto cache = getScriptTypeCache(object.engine());
+        QScriptValue x = object.property(cache->x);
         if (!x.isValid()) {
-            x = object.property("u");
+            x = object.property(cache->u);
         }
 
-        QScriptValue y = object.property("y");
+        QScriptValue y = object.property(cache->y);
         if (!y.isValid()) {
-            y = object.property("v");
+            y = object.property(cache->v);
         }
 
-        vec2.x = x.toVariant().toFloat();
-        vec2.y = y.toVariant().toFloat();
+        vec2.x = toFloat(x);
+        vec2.y = toFloat(y);
     }
 }
 
@@ -169,9 +255,8 @@ glm::vec2 vec2FromVariant(const QVariant &object) {
 }
 
 QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto cache = getScriptTypeCache(engine);
+    auto prototype = getPrototype(engine, cache->vec3Prototype, "__hifi_vec3__",
             "__hifi_vec3__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -183,21 +268,18 @@ QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
             "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
+    value.setProperty(cache->x, vec3.x);
+    value.setProperty(cache->y, vec3.y);
+    value.setProperty(cache->z, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto cache = getScriptTypeCache(engine);
+    auto prototype = getPrototype(engine, cache->vec3ColorPrototype, "__hifi_vec3_color__",
             "__hifi_vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -209,13 +291,11 @@ QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3
             "x: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
             "y: { set: function(nv) { return this.green = nv; }, get: function() { return this.green; } },"
             "z: { set: function(nv) { return this.blue = nv; }, get: function() { return this.blue; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
+    value.setProperty(cache->red, vec3.x);
+    value.setProperty(cache->green, vec3.y);
+    value.setProperty(cache->blue, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
@@ -230,48 +310,50 @@ void vec3FromScriptValue(const QScriptValue& object, glm::vec3& vec3) {
             vec3.y = qColor.green();
             vec3.z = qColor.blue();
         }
+    } else if (!object.engine()) {
+        vec3 = glm::vec3(0.0f);
     } else if (object.isArray()) {
-        QVariantList list = object.toVariant().toList();
-        if (list.length() == 3) {
-            vec3.x = list[0].toFloat();
-            vec3.y = list[1].toFloat();
-            vec3.z = list[2].toFloat();
+        auto cache = getScriptTypeCache(object.engine());
+        if (object.property(cache->length).toUInt32() == 3) {
+            vec3.x = toFloat(object.property(0));
+            vec3.y = toFloat(object.property(1));
+            vec3.z = toFloat(object.property(2));
         }
     } else {
-        QScriptValue x = object.property("x");
+        auto cache = getScriptTypeCache(object.engine());
+        QScriptValue x = object.property(cache->x);
         if (!x.isValid()) {
-            x = object.property("r");
+            x = object.property(cache->r);
         }
         if (!x.isValid()) {
-            x = object.property("red");
+            x = object.property(cache->red);
         }
 
-        QScriptValue y = object.property("y");
+        QScriptValue y = object.property(cache->y);
         if (!y.isValid()) {
-            y = object.property("g");
+            y = object.property(cache->g);
         }
         if (!y.isValid()) {
-            y = object.property("green");
+            y = object.property(cache->green);
         }
 
-        QScriptValue z = object.property("z");
+        QScriptValue z = object.property(cache->z);
         if (!z.isValid()) {
-            z = object.property("b");
+            z = object.property(cache->b);
         }
         if (!z.isValid()) {
-            z = object.property("blue");
+            z = object.property(cache->blue);
         }
 
-        vec3.x = x.toVariant().toFloat();
-        vec3.y = y.toVariant().toFloat();
-        vec3.z = z.toVariant().toFloat();
+        vec3.x = toFloat(x);
+        vec3.y = toFloat(y);
+        vec3.z = toFloat(z);
     }
 }
 
 QScriptValue u8vec3ToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_u8vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto cache = getScriptTypeCache(engine);
+    auto prototype = getPrototype(engine, cache->u8vec3Prototype, "__hifi_u8vec3__",
             "__hifi_u8vec3__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -283,21 +365,18 @@ QScriptValue u8vec3ToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3)
             "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
+    value.setProperty(cache->x, vec3.x);
+    value.setProperty(cache->y, vec3.y);
+    value.setProperty(cache->z, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 QScriptValue u8vec3ColorToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_u8vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto cache = getScriptTypeCache(engine);
+    auto prototype = getPrototype(engine, cache->u8vec3ColorPrototype, "__hifi_u8vec3_color__",
             "__hifi_u8vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -309,13 +388,11 @@ QScriptValue u8vec3ColorToScriptValue(QScriptEngine* engine, const glm::u8vec3&
             "x: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
             "y: { set: function(nv) { return this.green = nv; }, get: function() { return this.green; } },"
             "z: { set: function(nv) { return this.blue = nv; }, get: function() { return this.blue; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
+    value.setProperty(cache->red, vec3.x);
+    value.setProperty(cache->green, vec3.y);
+    value.setProperty(cache->blue, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
@@ -337,29 +414,32 @@ void u8vec3FromScriptValue(const QScriptValue& object, glm::u8vec3& vec3) {
             vec3.y = list[1].toUInt();
             vec3.z = list[2].toUInt();
         }
+    } else if (!object.engine()) {
+        vec3 = glm::u8vec3(0);
     } else {
-        QScriptValue x = object.property("x");
+        auto cache = getScriptTypeCache(object.engine());
+        QScriptValue x = object.property(cache->x);
         if (!x.isValid()) {
-            x = object.property("r");
+            x = object.property(cache->r);
         }
         if (!x.isValid()) {
-            x = object.property("red");
+            x = object.property(cache->red);
         }
 
-        QScriptValue y = object.property("y");
+        QScriptValue y = object.property(cache->y);
         if (!y.isValid()) {
-            y = object.property("g");
+            y = object.property(cache->g);
         }
         if (!y.isValid()) {
-            y = object.property("green");
+            y = object.property(cache->green);
         }
 
-        QScriptValue z = object.property("z");
+        QScriptValue z = object.property(cache->z);
         if (!z.isValid()) {
-            z = object.property("b");
+            z = object.property(cache->b);
         }
         if (!z.isValid()) {
-            z = object.property("blue");
+            z = object.property(cache->blue);
         }
 
         vec3.x = x.toVariant().toUInt();
@@ -539,19 +619,25 @@ glm::u8vec3 u8vec3FromVariant(const QVariant& object) {
 }
 
 QScriptValue vec4toScriptValue(QScriptEngine* engine, const glm::vec4& vec4) {
+    auto cache = getScriptTypeCache(engine);
     QScriptValue obj = engine->newObject();
-    obj.setProperty("x", vec4.x);
-    obj.setProperty("y", vec4.y);
-    obj.setProperty("z", vec4.z);
-    obj.setProperty("w", vec4.w);
+    obj.setProperty(cache->x, vec4.x);
+    obj.setProperty(cache->y, vec4.y);
+    obj.setProperty(cache->z, vec4.z);
+    obj.setProperty(cache->w, vec4.w);
     return obj;
 }
 
 void vec4FromScriptValue(const QScriptValue& object, glm::vec4& vec4) {
-    vec4.x = object.property("x").toVariant().toFloat();
-    vec4.y = object.property("y").toVariant().toFloat();
-    vec4.z = object.property("z").toVariant().toFloat();
-    vec4.w = object.property("w").toVariant().toFloat();
+    auto cache = getScriptTypeCache(object.engine());
+    if (!cache) {
+        vec4 = glm::vec4(0.0f);
+        return;
+    }
+    vec4.x = toFloat(object.property(cache->x));
+    vec4.y = toFloat(object.property(cache->y));
+    vec4.z = toFloat(object.property(cache->z));
+    vec4.w = toFloat(object.property(cache->w));
 }
 
 QVariant vec4toVariant(const glm::vec4& vec4) {
@@ -605,43 +691,23 @@ glm::vec4 vec4FromVariant(const QVariant& object) {
 }
 
 QScriptValue mat4toScriptValue(QScriptEngine* engine, const glm::mat4& mat4) {
+    auto cache = getScriptTypeCache(engine);
     QScriptValue obj = engine->newObject();
-    obj.setProperty("r0c0", mat4[0][0]);
-    obj.setProperty("r1c0", mat4[0][1]);
-    obj.setProperty("r2c0", mat4[0][2]);
-    obj.setProperty("r3c0", mat4[0][3]);
-    obj.setProperty("r0c1", mat4[1][0]);
-    obj.setProperty("r1c1", mat4[1][1]);
-    obj.setProperty("r2c1", mat4[1][2]);
-    obj.setProperty("r3c1", mat4[1][3]);
-    obj.setProperty("r0c2", mat4[2][0]);
-    obj.setProperty("r1c2", mat4[2][1]);
-    obj.setProperty("r2c2", mat4[2][2]);
-    obj.setProperty("r3c2", mat4[2][3]);
-    obj.setProperty("r0c3", mat4[3][0]);
-    obj.setProperty("r1c3", mat4[3][1]);
-    obj.setProperty("r2c3", mat4[3][2]);
-    obj.setProperty("r3c3", mat4[3][3]);
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            obj.setProperty(cache->mat4[column][row], mat4[column][row]);
+        }
+    }
     return obj;
 }
 
 void mat4FromScriptValue(const QScriptValue& object, glm::mat4& mat4) {
-    mat4[0][0] = object.property("r0c0").toVariant().toFloat();
-    mat4[0][1] = object.property("r1c0").toVariant().toFloat();
-    mat4[0][2] = object.property("r2c0").toVariant().toFloat();
-    mat4[0][3] = object.property("r3c0").toVariant().toFloat();
-    mat4[1][0] = object.property("r0c1").toVariant().toFloat();
-    mat4[1][1] = object.property("r1c1").toVariant().toFloat();
-    mat4[1][2] = object.property("r2c1").toVariant().toFloat();
-    mat4[1][3] = object.property("r3c1").toVariant().toFloat();
-    mat4[2][0] = object.property("r0c2").toVariant().toFloat();
-    mat4[2][1] = object.property("r1c2").toVariant().toFloat();
-    mat4[2][2] = object.property("r2c2").toVariant().toFloat();
-    mat4[2][3] = object.property("r3c2").toVariant().toFloat();
-    mat4[3][0] = object.property("r0c3").toVariant().toFloat();
-    mat4[3][1] = object.property("r1c3").toVariant().toFloat();
-    mat4[3][2] = object.property("r2c3").toVariant().toFloat();
-    mat4[3][3] = object.property("r3c3").toVariant().toFloat();
+    auto cache = getScriptTypeCache(object.engine());
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            mat4[column][row] = cache ? toFloat(object.property(cache->mat4[column][row])) : 0.0f;
+        }
+    }
 }
 
 QVariant mat4ToVariant(const glm::mat4& mat4) {
@@ -763,18 +829,24 @@ QScriptValue quatToScriptValue(QScriptEngine* engine, const glm::quat& quat) {
         // if quat contains a NaN don't try to convert it
         return obj;
     }
-    obj.setProperty("x", quat.x);
-    obj.setProperty("y", quat.y);
-    obj.setProperty("z", quat.z);
-    obj.setProperty("w", quat.w);
+    auto cache = getScriptTypeCache(engine);
+    obj.setProperty(cache->x, quat.x);
+    obj.setProperty(cache->y, quat.y);
+    obj.setProperty(cache->z, quat.z);
+    obj.setProperty(cache->w, quat.w);
     return obj;
 }
 
 void quatFromScriptValue(const QScriptValue& object, glm::quat &quat) {
-    quat.x = object.property("x").toVariant().toFloat();
-    quat.y = object.property("y").toVariant().toFloat();
-    quat.z = object.property("z").toVariant().toFloat();
-    quat.w = object.property("w").toVariant().toFloat();
+    auto cache = getScriptTypeCache(object.engine());
+    if (!cache) {
+        quat = glm::quat();
+        return;
+    }
+    quat.x = toFloat(object.property(cache->x));
+    quat.y = toFloat(object.property(cache->y));
+    quat.z = toFloat(object.property(cache->z));
+    quat.w = toFloat(object.property(cache->w));
 
     // enforce normalized quaternion
     float length = glm::length(quat);
@@ -0,0 +1,39 @@
+//
+//  BlendshapeAccumulate_avx2.cpp
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+// accumulated[indices[i]] += offsets[i] * (vertexCoefficient x3, normalCoefficient x6)
+// with offsets interleaved as position xyz, normal xyz, tangent xyz
+void accumulateBlendshapeOffsets_AVX2(float (*accumulated)[9], const float (*offsets)[9], const int* indices, int size,
+                                      float vertexCoefficient, float normalCoefficient) {
+
+    __m256 coef = _mm256_setr_ps(vertexCoefficient, vertexCoefficient, vertexCoefficient,
+                                 normalCoefficient, normalCoefficient, normalCoefficient,
+                                 normalCoefficient, normalCoefficient);
+
+    for (int i = 0; i < size; i++) {
+        float* dst = accumulated[indices[i]];
+        const float* src = offsets[i];
+
+        // position xyz, normal xyz, tangent xy
+        __m256 d = _mm256_loadu_ps(dst);
+        __m256 s = _mm256_loadu_ps(src);
+        _mm256_storeu_ps(dst, _mm256_fmadd_ps(s, coef, d));
+
+        // tangent z
+        dst[8] += src[8] * normalCoefficient;
+    }
+
+    _mm256_zeroupper();
+}
+
+#endif
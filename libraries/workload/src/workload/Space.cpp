@@ -15,11 +15,83 @@
 #include "Space.h"
 #include <cstring>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QThreadPool>
 
 #include <glm/gtx/quaternion.hpp>
 
 using namespace workload;
 
+// edge of the grid cells proxies are bucketed in, and the largest radius a proxy in the grid can have
+static const float CELL_SIZE = 32.0f;
+// slack for the cell tests, so that rounding can't make them disagree with the per proxy test
+static const float CELL_MARGIN = 0.01f;
+// cell coordinates are packed into 21 bits per axis, which covers a world far bigger than any domain
+static const int32_t MAX_CELL_COORD = (1 << 20) - 1;
+static const uint64_t OVERFLOW_CELL_KEY = UINT64_MAX;
+
+static int32_t cellCoordOf(float position) {
+    float coord = std::floor(position / CELL_SIZE);
+    return (int32_t)std::max(-(float)MAX_CELL_COORD, std::min(coord, (float)MAX_CELL_COORD));
+}
+
+static uint64_t cellKeyOf(const Sphere& sphere) {
+    bool fitsInGrid = std::isfinite(sphere.x) && std::isfinite(sphere.y) && std::isfinite(sphere.z) &&
+        sphere.w >= 0.0f && sphere.w <= CELL_SIZE;
+    if (!fitsInGrid) {
+        return OVERFLOW_CELL_KEY;
+    }
+    const uint64_t MASK = (1 << 21) - 1;
+    uint64_t key = 0;
+    for (int i = 0; i < 3; ++i) {
+        key = (key << 21) | ((uint64_t)(cellCoordOf(sphere[i]) + MAX_CELL_COORD) & MASK);
+    }
+    return key;
+}
+
+// how far any region sphere has moved or grown between two sets of views, or infinity when they don't line up
+static double measureViewDrift(const Views& views, const Views& otherViews) {
+    if (views.size() != otherViews.size()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double drift = 0.0;
+    for (size_t i = 0; i < views.size(); ++i) {
+        for (uint32_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+            const Sphere& region = views[i].regions[k];
+            const Sphere& otherRegion = otherViews[i].regions[k];
+            double regionDrift = glm::length(glm::vec3(region) - glm::vec3(otherRegion)) +
+                std::abs(region.w - otherRegion.w);
+            if (!(regionDrift <= drift)) {
+                // also catches NaN, which can't be trusted to drift by any amount
+                drift = std::isnan(regionDrift) ? std::numeric_limits<double>::infinity() : regionDrift;
+            }
+        }
+    }
+    return drift;
+}
+
+// the region of a proxy is the innermost one it touches in any view, with those below 'nearest' known not to be
+// touched and 'farthest' known to be
+static uint8_t computeRegion(const Sphere& sphere, const Views& views, uint8_t nearest, uint8_t farthest) {
+    glm::vec3 proxyCenter = glm::vec3(sphere);
+    float proxyRadius = sphere.w;
+    uint8_t region = farthest;
+    for (const auto& view : views) {
+        // for each 'view' we need only increment 'k' below the current value of 'region'
+        for (uint8_t k = nearest; k < region; ++k) {
+            float touchDistance = proxyRadius + view.regions[k].w;
+            if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
 Space::Space() : Collection() {
 }
 
@@ -31,6 +103,8 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     if (maxID > (Index) _proxies.size()) {
         _proxies.resize(maxID + 100); // allocate the maxId and more
         _owners.resize(maxID + 100);
+        _proxyCells.resize(maxID + 100, indexed_container::INVALID_INDEX);
+        _proxySlots.resize(maxID + 100, indexed_container::INVALID_INDEX);
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -56,6 +130,9 @@ void Space::processResets(const Transaction::Resets& transactions) {
         item.prevRegion = item.region = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
+
+        removeFromCell(proxyID);
+        insertInCell(proxyID);
     }
 }
 
@@ -72,6 +149,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         // Kill it
         item.prevRegion = item.region = Region::INVALID;
         _owners[removedID] = Owner();
+
+        removeFromCell(removedID);
     }
 }
 
@@ -87,36 +166,275 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
 
         // Update the item
         item.sphere = (std::get<1>(update));
+
+        moveInCell(updateID);
+    }
+}
+
+void Space::Cell::expandBounds(const Sphere& sphere) {
+    glm::vec3 center = glm::vec3(sphere);
+    minCenter = glm::min(minCenter, center);
+    maxCenter = glm::max(maxCenter, center);
+    minRadius = std::min(minRadius, sphere.w);
+    maxRadius = std::max(maxRadius, sphere.w);
+}
+
+void Space::Cell::resetBounds() {
+    minCenter = glm::vec3(FLT_MAX);
+    maxCenter = glm::vec3(-FLT_MAX);
+    minRadius = FLT_MAX;
+    maxRadius = 0.0f;
+    region = Region::UNKNOWN;
+}
+
+Index Space::findOrAddCell(CellKey key) {
+    auto itr = _cellIndices.find(key);
+    if (itr != _cellIndices.end()) {
+        return itr->second;
+    }
+    // cells are kept once made, for the proxies that come back to them
+    Index cellIndex = (Index)_cells.size();
+    _cells.emplace_back();
+    _cells.back().key = key;
+    _cells.back().overflow = (key == OVERFLOW_CELL_KEY);
+    _cellIndices[key] = cellIndex;
+    return cellIndex;
+}
+
+void Space::insertInCell(ProxyID id) {
+    const Sphere& sphere = _proxies[id].sphere;
+    Index cellIndex = findOrAddCell(cellKeyOf(sphere));
+    auto& cell = _cells[cellIndex];
+    _proxyCells[id] = cellIndex;
+    _proxySlots[id] = (Index)cell.proxies.size();
+    cell.proxies.push_back(id);
+    if (!cell.overflow) {
+        cell.expandBounds(sphere);
+    }
+    _movedProxies.push_back(id);
+}
+
+void Space::removeFromCell(ProxyID id) {
+    Index cellIndex = _proxyCells[id];
+    if (cellIndex == indexed_container::INVALID_INDEX) {
+        return;
+    }
+    auto& cell = _cells[cellIndex];
+    Index slot = _proxySlots[id];
+    ProxyID lastID = cell.proxies.back();
+    cell.proxies[slot] = lastID;
+    _proxySlots[lastID] = slot;
+    cell.proxies.pop_back();
+    if (cell.proxies.empty()) {
+        cell.resetBounds();
+    }
+    _proxyCells[id] = indexed_container::INVALID_INDEX;
+    _proxySlots[id] = indexed_container::INVALID_INDEX;
+}
+
+void Space::moveInCell(ProxyID id) {
+    Index cellIndex = _proxyCells[id];
+    if (cellIndex == indexed_container::INVALID_INDEX) {
+        // removed proxies stay out of the grid until they are reset
+        return;
+    }
+    if (_cells[cellIndex].key != cellKeyOf(_proxies[id].sphere)) {
+        removeFromCell(id);
+        insertInCell(id);
+        return;
+    }
+
+    auto& cell = _cells[cellIndex];
+    if (!cell.overflow) {
+        cell.expandBounds(_proxies[id].sphere);
+    }
+    _movedProxies.push_back(id);
+}
+
+void Space::bracketRegions(Cell& cell) const {
+    cell.nearest = cell.farthest = Region::R4;
+    if (cell.overflow) {
+        cell.nearest = Region::R1;
+        cell.expiry = _viewDrift;
+        return;
+    }
+
+    // the least any of the tests below is passed or failed by, so how far the views can drift before it could flip
+    float slack = FLT_MAX;
+    glm::vec3 cellCenter = 0.5f * (cell.minCenter + cell.maxCenter);
+    glm::vec3 cellHalfSize = 0.5f * (cell.maxCenter - cell.minCenter);
+    for (const auto& view : _categorizedViews) {
+        for (uint8_t k = 0; k < cell.farthest; ++k) {
+            glm::vec3 offset = glm::abs(glm::vec3(view.regions[k]) - cellCenter);
+            float regionRadius = view.regions[k].w;
+            // closest and furthest any proxy center in the cell can be from the region's center
+            float closest = glm::length(glm::max(offset - cellHalfSize, glm::vec3(0.0f)));
+            float furthest = glm::length(offset + cellHalfSize);
+            float touchGap = closest - (cell.maxRadius + regionRadius + CELL_MARGIN);
+            float insideGap = (cell.minRadius + regionRadius) - (furthest + CELL_MARGIN);
+            slack = std::min(slack, std::min(std::abs(touchGap), std::abs(insideGap)));
+            if (touchGap < 0.0f) {
+                // some proxy in the cell may touch this region
+                cell.nearest = std::min(cell.nearest, k);
+            }
+            if (insideGap > 0.0f) {
+                // every proxy in the cell touches this region
+                cell.farthest = k;
+                break;
+            }
+        }
+    }
+
+    // proxies in a cell that straddles a boundary change with any move of the views
+    if (cell.nearest != cell.farthest || !(slack > CELL_MARGIN)) {
+        slack = 0.0f;
+    } else {
+        slack -= CELL_MARGIN;
+    }
+    cell.expiry = _viewDrift + slack;
+}
+
+void Space::categorizeCell(Cell& cell, std::vector<Change>& changes) {
+    if (cell.proxies.empty()) {
+        return;
     }
+
+    bracketRegions(cell);
+    bool isUniform = (cell.nearest == cell.farthest);
+    if (isUniform && cell.region == cell.nearest) {
+        // all of the cell is still in the region its proxies were left in, only the moved ones can change
+        return;
+    }
+
+    for (auto proxyID : cell.proxies) {
+        Proxy& proxy = _proxies[proxyID];
+        uint8_t region = isUniform ? cell.nearest :
+            computeRegion(proxy.sphere, _categorizedViews, cell.nearest, cell.farthest);
+        // prevRegion is left as the region the proxy was in before it last changed
+        if (region != proxy.region) {
+            proxy.prevRegion = proxy.region;
+            proxy.region = region;
+            changes.emplace_back(Space::Change(proxyID, proxy.region, proxy.prevRegion));
+        }
+    }
+    cell.region = isUniform ? cell.nearest : (uint8_t)Region::UNKNOWN;
 }
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
-        if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
-            uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
-                        region = k;
-                        break;
-                    }
-                }
+    double drift = measureViewDrift(_views, _categorizedViews);
+    if (drift > 0.0) {
+        _categorizedViews = _views;
+    }
+
+    // Proxies outside the cells gathered here are in the right region already.  These are the cells proxies
+    // moved into, and those the views have drifted far enough since they were last looked at to change.
+    uint32_t pass = ++_numCategorizePasses;
+    IndexVector cellIndices;
+    uint32_t numProxies = 0;
+    auto gatherCell = [&](Index cellIndex) {
+        auto& cell = _cells[cellIndex];
+        if (cell.lastPass != pass && !cell.proxies.empty()) {
+            cell.lastPass = pass;
+            cellIndices.push_back(cellIndex);
+            numProxies += (uint32_t)cell.proxies.size();
+        }
+    };
+    for (auto proxyID : _movedProxies) {
+        if (_proxyCells[proxyID] != indexed_container::INVALID_INDEX) {
+            gatherCell(_proxyCells[proxyID]);
+        }
+    }
+    if (std::isinf(drift)) {
+        // the views are new, start over
+        _viewDrift = 0.0;
+        _cellExpiries = CellExpiries();
+        for (Index i = 0; i < (Index)_cells.size(); ++i) {
+            gatherCell(i);
+        }
+    } else {
+        _viewDrift += drift;
+        while (!_cellExpiries.empty() && _cellExpiries.top().first < _viewDrift) {
+            auto expiry = _cellExpiries.top();
+            _cellExpiries.pop();
+            // cells looked at since they were queued have been queued again
+            if (_cells[expiry.second].expiry == expiry.first) {
+                gatherCell(expiry.second);
             }
+        }
+    }
+
+    int numThreads = QThreadPool::globalInstance()->maxThreadCount();
+    if (numProxies < MIN_PARALLEL_PROXIES || numThreads < 2) {
+        for (auto cellIndex : cellIndices) {
+            categorizeCell(_cells[cellIndex], changes);
+        }
+    } else {
+        // split the cells into batches of about the same number of proxies, a few per thread so that the ones
+        // that straddle region boundaries even out, each with their own changes to be joined up in order after
+        struct Batch {
+            size_t begin;
+            size_t end;
+            std::vector<Change> changes;
+        };
+        std::vector<Batch> batches;
+        uint32_t proxiesPerBatch = numProxies / (uint32_t)(4 * numThreads) + 1;
+        uint32_t numBatchProxies = 0;
+        size_t batchBegin = 0;
+        for (size_t i = 0; i < cellIndices.size(); ++i) {
+            numBatchProxies += (uint32_t)_cells[cellIndices[i]].proxies.size();
+            if (numBatchProxies >= proxiesPerBatch || i + 1 == cellIndices.size()) {
+                batches.push_back({ batchBegin, i + 1, {} });
+                batchBegin = i + 1;
+                numBatchProxies = 0;
+            }
+        }
+
+        // each cell, and the proxies in it, belong to exactly one batch
+        QtConcurrent::blockingMap(batches, [&](Batch& batch) {
+            for (size_t i = batch.begin; i < batch.end; ++i) {
+                categorizeCell(_cells[cellIndices[i]], batch.changes);
+            }
+        });
+
+        size_t numChanges = changes.size();
+        for (const auto& batch : batches) {
+            numChanges += batch.changes.size();
+        }
+        changes.reserve(numChanges);
+        for (const auto& batch : batches) {
+            changes.insert(changes.end(), batch.changes.begin(), batch.changes.end());
+        }
+    }
+
+    // the moved proxies in cells that are all in one region join it, those in the rest were categorized above
+    for (auto proxyID : _movedProxies) {
+        Index cellIndex = _proxyCells[proxyID];
+        if (cellIndex == indexed_container::INVALID_INDEX) {
+            continue;
+        }
+        const auto& cell = _cells[cellIndex];
+        Proxy& proxy = _proxies[proxyID];
+        if (cell.nearest == cell.farthest && proxy.region != cell.nearest) {
             proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+            proxy.region = cell.nearest;
+            changes.emplace_back(Space::Change(proxyID, proxy.region, proxy.prevRegion));
+        }
+    }
+    _movedProxies.clear();
+
+    for (auto cellIndex : cellIndices) {
+        _cellExpiries.push(std::make_pair(_cells[cellIndex].expiry, cellIndex));
+    }
+    // drop the entries left behind by cells that were queued again, once they build up
+    if (_cellExpiries.size() > 2 * _cells.size() + 1024) {
+        CellExpiries cellExpiries;
+        for (Index i = 0; i < (Index)_cells.size(); ++i) {
+            if (_cells[i].lastPass != 0 && !_cells[i].proxies.empty()) {
+                cellExpiries.push(std::make_pair(_cells[i].expiry, i));
             }
         }
+        _cellExpiries.swap(cellExpiries);
     }
 }
 
@@ -161,7 +479,15 @@ void Space::clear() {
     _IDAllocator.clear();
     _proxies.clear();
     _owners.clear();
+    _cellIndices.clear();
+    _cells.clear();
+    _proxyCells.clear();
+    _proxySlots.clear();
+    _movedProxies.clear();
+    _cellExpiries = CellExpiries();
+    _viewDrift = 0.0;
     _views.clear();
+    _categorizedViews.clear();
 }
 
 void Space::setViews(const Views& views) {
@@ -16,6 +16,8 @@
 #define hifi_workload_Space_h
 
 #include <memory>
+#include <queue>
+#include <unordered_map>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -23,6 +25,9 @@
 
 namespace workload {
 
+// Proxies are bucketed by their centers into a grid of cells, so that categorizing can settle a whole cell that lies
+// clear of every region boundary with one test and only looks at proxies one by one in cells that straddle one.
+// A settled cell nothing has moved in is left alone until the views have drifted far enough to reach it.
 class Space : public Collection {
 public:
     using ProxyUpdate = std::pair<int32_t, Sphere>;
@@ -37,6 +42,9 @@ public:
 
     Space();
 
+    // fewer proxies than this to categorize in a frame are done on the calling thread
+    static const uint32_t MIN_PARALLEL_PROXIES = 4096;
+
     void setViews(const Views& views);
 
     uint32_t getNumViews() const { return (uint32_t)(_views.size()); }
@@ -60,12 +68,61 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
+    using CellKey = uint64_t;
+
+    class Cell {
+    public:
+        IndexVector proxies;
+        CellKey key { 0 };
+        // bounds of the centers and radii of the proxies that have been in the cell since it was last empty
+        glm::vec3 minCenter { FLT_MAX };
+        glm::vec3 maxCenter { -FLT_MAX };
+        float minRadius { FLT_MAX };
+        float maxRadius { 0.0f };
+        // the region every proxy in the cell is in, bar those moved since, or UNKNOWN when they differ
+        uint8_t region { Region::UNKNOWN };
+        // the nearest region any proxy in the cell may touch and the farthest they all do, as of the last pass
+        uint8_t nearest { Region::R4 };
+        uint8_t farthest { Region::R4 };
+        // the cell holds the proxies too big or too odd for the grid, which are categorized one by one
+        bool overflow { false };
+        // the categorize pass that last looked at the cell, and the view drift it needs looking at again after
+        uint32_t lastPass { 0 };
+        double expiry { 0.0 };
+
+        void expandBounds(const Sphere& sphere);
+        void resetBounds();
+    };
+
+    Index findOrAddCell(CellKey key);
+    void insertInCell(ProxyID id);
+    void removeFromCell(ProxyID id);
+    void moveInCell(ProxyID id);
+    void bracketRegions(Cell& cell) const;
+    void categorizeCell(Cell& cell, std::vector<Change>& changes);
+
     // The database of proxies is protected for editing by a mutex
     mutable std::mutex _proxiesMutex;
     Proxy::Vector _proxies;
     std::vector<Owner> _owners;
 
+    // The grid, and which cell each proxy is in and where in that cell's list, in step with _proxies
+    std::unordered_map<CellKey, Index> _cellIndices;
+    std::vector<Cell> _cells;
+    IndexVector _proxyCells;
+    IndexVector _proxySlots;
+    // proxies added or moved since the last pass
+    IndexVector _movedProxies;
+    // how far the views have moved in all, and the cells by the drift they need looking at again after
+    using CellExpiry = std::pair<double, Index>;
+    using CellExpiries = std::priority_queue<CellExpiry, std::vector<CellExpiry>, std::greater<CellExpiry>>;
+    double _viewDrift { 0.0 };
+    CellExpiries _cellExpiries;
+    uint32_t _numCategorizePasses { 0 };
+
     Views _views;
+    // the views the proxies were last categorized against
+    Views _categorizedViews;
 };
 
 using SpacePointer = std::shared_ptr<Space>;
@@ -0,0 +1,103 @@
+"use strict";
+/*jslint vars: true, plusplus: true*/
+/*global Script, print, Vec3, Quat, Mat4, Uuid, Entities, MyAvatar, Avatar*/
+//
+//  scriptApiBenchmark.js
+//  scripts/developer/tests/performance
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Calls each of the scripting API functions that scripts lean on every frame in a tight loop and prints how
+//  many calls per second it managed, then stops.  Needs no UI: run it as an Agent script on an assignment-client
+//  to measure headless, or load it in Interface, where MyAvatar and local entities are also available.
+//
+
+var DURATION_MS = 1000; // how long each benchmark is run for
+var CALLS_PER_CHECK = 100; // calls made between looks at the clock
+var PAUSE_MS = 100; // between benchmarks, so that the rest of the engine gets a look in
+
+var a = { x: 1, y: 2, z: 3 };
+var b = { x: -4, y: 5, z: 0.5 };
+var q = Quat.fromPitchYawRollDegrees(10, 20, 30);
+var m = Mat4.createFromRotAndTrans(q, a);
+
+var avatar = (typeof MyAvatar !== "undefined") ? MyAvatar : ((typeof Avatar !== "undefined") ? Avatar : null);
+
+var entityID = Entities.addEntity({
+    type: "Box",
+    name: "scriptApiBenchmark",
+    position: a,
+    dimensions: { x: 0.1, y: 0.1, z: 0.1 },
+    lifetime: 60
+}, "local");
+if (!entityID || entityID === Uuid.NULL) {
+    print("scriptApiBenchmark: no local entity available, getEntityProperties will look up an unknown ID");
+    entityID = Uuid.NULL;
+}
+
+var benchmarks = [
+    { name: "Vec3.sum", call: function () { return Vec3.sum(a, b); } },
+    { name: "Vec3.multiplyQbyV", call: function () { return Vec3.multiplyQbyV(q, a); } },
+    { name: "Vec3.distance", call: function () { return Vec3.distance(a, b); } },
+    { name: "Quat.multiply", call: function () { return Quat.multiply(q, q); } },
+    { name: "Quat.getFront", call: function () { return Quat.getFront(q); } },
+    { name: "Quat.fromVec3Degrees", call: function () { return Quat.fromVec3Degrees(a); } },
+    { name: "Mat4.multiply", call: function () { return Mat4.multiply(m, m); } },
+    { name: "Mat4.transformPoint", call: function () { return Mat4.transformPoint(m, a); } },
+    { name: "Entities.getEntityProperties", call: function () {
+        return Entities.getEntityProperties(entityID);
+    } },
+    { name: "Entities.getEntityProperties(position, rotation)", call: function () {
+        return Entities.getEntityProperties(entityID, ["position", "rotation"]);
+    } }
+];
+
+if (avatar) {
+    benchmarks.push(
+        { name: "Avatar.position", call: function () { return avatar.position; } },
+        { name: "Avatar.orientation", call: function () { return avatar.orientation; } },
+        { name: "Avatar.getJointRotation", call: function () { return avatar.getJointRotation(0); } },
+        { name: "Avatar.getAbsoluteJointTranslationInObjectFrame", call: function () {
+            return avatar.getAbsoluteJointTranslationInObjectFrame(0);
+        } }
+    );
+} else {
+    print("scriptApiBenchmark: no avatar to benchmark in this context");
+}
+
+function runBenchmark(benchmark) {
+    var calls = 0;
+    var start = Date.now();
+    var elapsed = 0;
+    do {
+        for (var i = 0; i < CALLS_PER_CHECK; ++i) {
+            benchmark.call();
+        }
+        calls += CALLS_PER_CHECK;
+        elapsed = Date.now() - start;
+    } while (elapsed < DURATION_MS);
+    return Math.round(calls * 1000 / elapsed);
+}
+
+var next = 0;
+function runNext() {
+    if (next >= benchmarks.length) {
+        print("scriptApiBenchmark: done");
+        Script.stop();
+        return;
+    }
+    var benchmark = benchmarks[next++];
+    print("scriptApiBenchmark: " + benchmark.name + " " + runBenchmark(benchmark) + " calls/s");
+    Script.setTimeout(runNext, PAUSE_MS);
+}
+
+Script.scriptEnding.connect(function () {
+    if (entityID !== Uuid.NULL) {
+        Entities.deleteEntity(entityID);
+    }
+});
+
+Script.setTimeout(runNext, PAUSE_MS);
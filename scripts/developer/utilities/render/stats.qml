@@ -97,6 +97,35 @@ Item {
             ]
         }
 
+        PlotPerf {
+            title: "Scene Transactions"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            plots: [
+                {
+                    prop: "frameItemUpdateCount",
+                    label: "Updates",
+                    color: "#00B4EF"
+                },
+                {
+                    prop: "frameItemTransformUpdateCount",
+                    label: "Transforms",
+                    color: "#1AC567"
+                },
+                {
+                    prop: "frameUpdatedItemCount",
+                    label: "Items",
+                    color: "#FED959"
+                },
+                {
+                    prop: "frameTransactionTime",
+                    label: "time",
+                    color: "#E2334D",
+                    unit: "ms"
+                }
+            ]
+        }
+
         property var drawOpaqueConfig: Render.getConfig("RenderMainView.DrawOpaqueDeferred")
         property var drawTransparentConfig: Render.getConfig("RenderMainView.DrawTransparentDeferred")
         property var drawLightConfig: Render.getConfig("RenderMainView.DrawLight")
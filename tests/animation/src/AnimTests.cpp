@@ -467,6 +467,107 @@ void AnimTests::testAnimPose() {
     QCOMPARE_WITH_ABS_ERROR(p.scale(), resultScale, TEST_EPSILON2);
 }
 
+void AnimTests::testAnimPoseFastPaths() {
+    const float PI = (float)M_PI;
+    const glm::quat ROT_X_90 = glm::angleAxis(PI / 2.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+    const glm::quat ROT_Y_30 = glm::angleAxis(PI / 6.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    std::vector<AnimPose> poses = {
+        AnimPose(glm::vec3(1.0f), glm::quat(), glm::vec3(0.0f)),
+        AnimPose(glm::vec3(1.0f), ROT_X_90, glm::vec3(10.0f, 0.0f, 0.0f)),
+        AnimPose(glm::vec3(2.0f), ROT_Y_30, glm::vec3(0.0f, 5.0f, -7.5f)),
+        AnimPose(glm::vec3(0.5f), ROT_X_90 * ROT_Y_30, glm::vec3(1.0f, 2.0f, 3.0f)),
+        AnimPose(glm::vec3(2.0f, 0.5f, 1.5f), ROT_Y_30, glm::vec3(-1.0f, 0.0f, 4.0f)),
+        AnimPose(glm::vec3(-2.0f, 0.5f, 1.5f), ROT_X_90, glm::vec3(0.0f, 1.0f, 0.0f))
+    };
+
+    const float TEST_EPSILON = 0.001f;
+
+    // composing and inverting poses must agree with the equivalent matrix math, whichever path is taken.
+    for (auto& lhs : poses) {
+        for (auto& rhs : poses) {
+            glm::mat4 expected = (glm::mat4)lhs * (glm::mat4)rhs;
+            QCOMPARE_WITH_ABS_ERROR((glm::mat4)(lhs * rhs), expected, TEST_EPSILON);
+        }
+        QCOMPARE_WITH_ABS_ERROR((glm::mat4)lhs.inverse(), glm::inverse((glm::mat4)lhs), TEST_EPSILON);
+    }
+}
+
+void AnimTests::testBlend() {
+    const float PI = (float)M_PI;
+    const glm::quat ROT_X_90 = glm::angleAxis(PI / 2.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+    const glm::quat ROT_Y_30 = glm::angleAxis(PI / 6.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    AnimPoseVec a = {
+        AnimPose(glm::vec3(1.0f), ROT_X_90, glm::vec3(1.0f, 2.0f, 3.0f)),
+        AnimPose(glm::vec3(2.0f, 1.0f, 0.5f), ROT_Y_30, glm::vec3(-4.0f, 0.0f, 1.0f)),
+        AnimPose(glm::vec3(1.0f), ROT_Y_30, glm::vec3(0.0f))
+    };
+    AnimPoseVec b = {
+        AnimPose(glm::vec3(3.0f), ROT_Y_30, glm::vec3(-1.0f, 0.0f, 5.0f)),
+        AnimPose(glm::vec3(1.0f), ROT_X_90 * ROT_Y_30, glm::vec3(2.0f, 2.0f, 2.0f)),
+        AnimPose(glm::vec3(1.0f), -ROT_X_90, glm::vec3(1.0f))  // opposite hemisphere
+    };
+
+    const float TEST_EPSILON = 0.0001f;
+    const float ALPHA = 0.3f;
+
+    AnimPoseVec result(a.size());
+    ::blend(a.size(), &a[0], &b[0], ALPHA, &result[0]);
+    for (size_t i = 0; i < a.size(); i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), lerp(a[i].scale(), b[i].scale(), ALPHA), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), safeLerp(a[i].rot(), b[i].rot(), ALPHA), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), lerp(a[i].trans(), b[i].trans(), ALPHA), TEST_EPSILON);
+    }
+
+    // blending in place, as the IK nodes do.
+    AnimPoseVec inPlace = a;
+    ::blend(inPlace.size(), &inPlace[0], &b[0], ALPHA, &inPlace[0]);
+    for (size_t i = 0; i < a.size(); i++) {
+        QCOMPARE_WITH_ABS_ERROR((glm::mat4)inPlace[i], (glm::mat4)result[i], TEST_EPSILON);
+    }
+}
+
+// roughly the joint count of a full avatar skeleton, including fingers.
+static const int BENCHMARK_JOINT_COUNT = 120;
+
+static AnimPoseVec makeBenchmarkPoses(float angle) {
+    AnimPoseVec poses;
+    poses.reserve(BENCHMARK_JOINT_COUNT);
+    for (int i = 0; i < BENCHMARK_JOINT_COUNT; i++) {
+        glm::quat rot = glm::angleAxis(angle * (float)(i % 7), glm::normalize(glm::vec3(1.0f, (float)(i % 3), 0.5f)));
+        poses.push_back(AnimPose(glm::vec3(1.0f), rot, glm::vec3(0.0f, 0.1f, 0.01f * (float)(i % 5))));
+    }
+    return poses;
+}
+
+void AnimTests::benchmarkBlend() {
+    AnimPoseVec a = makeBenchmarkPoses(0.1f);
+    AnimPoseVec b = makeBenchmarkPoses(-0.2f);
+    AnimPoseVec result(a.size());
+
+    QBENCHMARK {
+        ::blend(result.size(), &a[0], &b[0], 0.4f, &result[0]);
+    }
+}
+
+void AnimTests::benchmarkRelativeToAbsolute() {
+    // a spine with limbs branching off every few joints, parents always preceding their children.
+    std::vector<int> parentIndices(BENCHMARK_JOINT_COUNT);
+    for (int i = 0; i < BENCHMARK_JOINT_COUNT; i++) {
+        parentIndices[i] = i == 0 ? -1 : (i % 4 == 0 ? (i / 2) : i - 1);
+    }
+    AnimPoseVec relativePoses = makeBenchmarkPoses(0.1f);
+    AnimPoseVec absolutePoses(relativePoses.size());
+
+    QBENCHMARK {
+        for (int i = 0; i < BENCHMARK_JOINT_COUNT; i++) {
+            int parentIndex = parentIndices[i];
+            absolutePoses[i] = parentIndex == -1 ? relativePoses[i] : absolutePoses[parentIndex] * relativePoses[i];
+        }
+    }
+}
+
 void AnimTests::testExpressionTokenizer() {
     QString str = "(10 +  x) >= 20.1 && (y != !z)";
     AnimExpression e("x");
@@ -27,6 +27,10 @@ private slots:
     void testVariant();
     void testAccumulateTime();
     void testAnimPose();
+    void testAnimPoseFastPaths();
+    void testBlend();
+    void benchmarkBlend();
+    void benchmarkRelativeToAbsolute();
     void testExpressionTokenizer();
     void testExpressionParser();
     void testExpressionEvaluator();
@@ -0,0 +1,115 @@
+//
+//  ModelBakerTests.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ModelBakerTests.h"
+
+#include <iostream>
+
+#include <QElapsedTimer>
+
+#include <hfm/HFM.h>
+#include <model-baker/Baker.h>
+
+QTEST_MAIN(ModelBakerTests)
+
+namespace {
+
+// Builds a model of numMeshes flat gridSize x gridSize vertex grids in the XY plane, one shape per mesh,
+// with no normals or tangents so that the baker has to calculate them.
+hfm::Model::Pointer createGridModel(int numMeshes, int gridSize) {
+    auto model = std::make_shared<hfm::Model>();
+    model->originalURL = "file:///grid.fbx";
+
+    hfm::Joint joint;
+    joint.parentIndex = -1;
+    joint.name = "root";
+    model->joints.push_back(joint);
+    model->jointIndices.insert(joint.name, 1);
+
+    hfm::Material material;
+    material.materialID = "grid";
+    model->materials.push_back(material);
+
+    for (int m = 0; m < numMeshes; m++) {
+        hfm::Mesh mesh;
+        mesh.meshIndex = m;
+        for (int y = 0; y < gridSize; y++) {
+            for (int x = 0; x < gridSize; x++) {
+                mesh.vertices.push_back(glm::vec3((float)x, (float)y, (float)m));
+                mesh.texCoords.push_back(glm::vec2((float)x, (float)y) / (float)(gridSize - 1));
+            }
+        }
+
+        hfm::MeshPart part;
+        for (int y = 0; y < gridSize - 1; y++) {
+            for (int x = 0; x < gridSize - 1; x++) {
+                int i = y * gridSize + x;
+                part.triangleIndices << i << i + 1 << i + gridSize;
+                part.triangleIndices << i + 1 << i + gridSize + 1 << i + gridSize;
+            }
+        }
+        mesh.parts.push_back(part);
+        model->meshes.push_back(mesh);
+
+        hfm::Shape shape;
+        shape.mesh = (uint32_t)m;
+        shape.meshPart = 0;
+        shape.material = 0;
+        shape.joint = 0;
+        model->shapes.push_back(shape);
+    }
+    return model;
+}
+
+}
+
+void ModelBakerTests::testCalculatedNormals() {
+    const int NUM_MESHES = 4;
+    const int GRID_SIZE = 8;
+    baker::Baker baker(createGridModel(NUM_MESHES, GRID_SIZE), hifi::VariantHash(), hifi::URL());
+    baker.run();
+
+    auto bakedModel = baker.getHFMModel();
+    QVERIFY(bakedModel);
+    QCOMPARE((int)bakedModel->meshes.size(), NUM_MESHES);
+    for (const auto& mesh : bakedModel->meshes) {
+        QCOMPARE(mesh.normals.size(), mesh.vertices.size());
+        for (const auto& normal : mesh.normals) {
+            // Every triangle of a flat grid shares the same plane.
+            QVERIFY(glm::abs(glm::abs(normal.z) - 1.0f) < 1.0e-4f);
+        }
+    }
+}
+
+#ifdef MANUAL_TEST
+void ModelBakerTests::benchmark() {
+    const int NUM_ASSETS = 8;
+    const int GRID_SIZE = 64;
+    const int meshCounts[] = { 1, 16, 64, 256 };
+
+    for (int numMeshes : meshCounts) {
+        std::vector<hfm::Model::Pointer> assets;
+        for (int i = 0; i < NUM_ASSETS; i++) {
+            assets.push_back(createGridModel(numMeshes, GRID_SIZE));
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        for (const auto& asset : assets) {
+            baker::Baker baker(asset, hifi::VariantHash(), hifi::URL());
+            baker.run();
+        }
+        qint64 elapsed = timer.nsecsElapsed();
+
+        std::cout << "numMeshes = " << numMeshes << "  vertsPerMesh = " << GRID_SIZE * GRID_SIZE
+            << "  bakeTime = " << (float)elapsed / (float)NUM_ASSETS / 1.0e6f << " msec/asset" << std::endl;
+    }
+}
+#endif // MANUAL_TEST
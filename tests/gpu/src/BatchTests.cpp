@@ -0,0 +1,93 @@
+//
+//  BatchTests.cpp
+//  tests/gpu/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BatchTests.h"
+
+#include <gpu/Batch.h>
+#include <gpu/Context.h>
+#include <gpu/Frame.h>
+
+QTEST_MAIN(BatchTests)
+
+// roughly the shape of a busy frame: a few dozen render jobs recording a couple thousand draws each
+const size_t NUM_BENCHMARK_BATCHES = 64;
+const size_t NUM_BENCHMARK_DRAWS = 2000;
+
+static void recordDraws(gpu::Batch& batch, size_t numDraws) {
+    Transform model;
+    for (size_t i = 0; i < numDraws; ++i) {
+        model.setTranslation(glm::vec3((float)i, 0.0f, 0.0f));
+        batch.setModelTransform(model);
+        batch.draw(gpu::TRIANGLES, 36, 0);
+    }
+}
+
+void BatchTests::initTestCase() {
+    _gpuContext = std::make_shared<gpu::Context>();
+}
+
+void BatchTests::cleanupTestCase() {
+    _gpuContext.reset();
+}
+
+void BatchTests::testBatchRecycling() {
+    gpu::Batch* rawBatch = nullptr;
+    {
+        auto batch = gpu::Context::acquireBatch("recycled");
+        recordDraws(*batch, 1000);
+        rawBatch = batch.get();
+    }
+
+    // the batch that was just released comes back first, emptied but with its storage kept
+    auto batch = gpu::Context::acquireBatch("reused");
+    QCOMPARE(batch.get(), rawBatch);
+    QCOMPARE(batch->getName(), std::string("reused"));
+    QVERIFY(batch->_commands.empty());
+    QVERIFY(batch->getParams().empty());
+    QVERIFY(batch->_commands.capacity() >= 2000);
+    QVERIFY(batch->getParams().capacity() >= 1000);
+}
+
+void BatchTests::testNamedCallsFinished() {
+    const size_t NUM_BATCHES = 16;
+    const size_t NUM_INSTANCES = 10;
+
+    _gpuContext->beginFrame();
+    for (size_t batchIndex = 0; batchIndex < NUM_BATCHES; ++batchIndex) {
+        gpu::doInBatch("named", _gpuContext, [](gpu::Batch& batch) {
+            for (size_t i = 0; i < NUM_INSTANCES; ++i) {
+                batch.setModelTransform(Transform());
+                batch.setupNamedCalls("instances", [](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) {
+                    batch.drawInstanced((gpu::uint32)data.count(), gpu::TRIANGLES, 36);
+                });
+            }
+        });
+    }
+    auto frame = _gpuContext->endFrame();
+
+    // every batch got its instanced draw appended when the frame was finished
+    QCOMPARE(frame->batches.size(), NUM_BATCHES);
+    for (const auto& batch : frame->batches) {
+        QVERIFY(!batch->_commands.empty());
+        QCOMPARE(batch->_commands.back(), gpu::Batch::COMMAND_drawInstanced);
+    }
+}
+
+void BatchTests::benchmarkRecordFrame() {
+    QBENCHMARK {
+        _gpuContext->beginFrame();
+        for (size_t i = 0; i < NUM_BENCHMARK_BATCHES; ++i) {
+            gpu::doInBatch("benchmark", _gpuContext, [](gpu::Batch& batch) {
+                recordDraws(batch, NUM_BENCHMARK_DRAWS);
+            });
+        }
+        _gpuContext->endFrame();
+    }
+}
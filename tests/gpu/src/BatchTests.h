@@ -0,0 +1,35 @@
+//
+//  BatchTests.h
+//  tests/gpu/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_gpu_BatchTests_h
+#define hifi_gpu_BatchTests_h
+
+#include <QtTest/QtTest>
+
+#include <gpu/Forward.h>
+
+// Batch recording and frame finishing on a Context without a backend, so nothing but the CPU side of a frame is measured
+class BatchTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testBatchRecycling();
+    void testNamedCallsFinished();
+
+    void benchmarkRecordFrame();
+
+private:
+    gpu::ContextPointer _gpuContext;
+};
+
+#endif // hifi_gpu_BatchTests_h
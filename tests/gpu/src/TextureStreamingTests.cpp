@@ -0,0 +1,66 @@
+//
+//  TextureStreamingTests.cpp
+//  tests/gpu/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureStreamingTests.h"
+
+#include <gpu/Texture.h>
+#include <gpu/TextureTable.h>
+#include <gpu/gl/GLTexture.h>
+
+QTEST_MAIN(TextureStreamingTests)
+
+using namespace gpu::gl;
+
+static const gpu::Size SMALL_TEXTURE = 256 * 256 * 4;
+static const gpu::Size LARGE_TEXTURE = 4096 * 4096 * 4;
+
+void TextureStreamingTests::testPromotePriority() {
+    // Off screen, smallest first
+    QVERIFY(GLTextureTransferEngine::evalPromotePriority(SMALL_TEXTURE, 0.0f) >
+            GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 0.0f));
+    // Same size, the one covering more of the view first
+    QVERIFY(GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 0.5f) >
+            GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 0.01f));
+    QVERIFY(GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 0.01f) >
+            GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 0.0f));
+    // A large texture filling the view beats a small one nobody sees
+    QVERIFY(GLTextureTransferEngine::evalPromotePriority(LARGE_TEXTURE, 1.0f) >
+            GLTextureTransferEngine::evalPromotePriority(SMALL_TEXTURE, 0.0f));
+    // Empty textures don't divide by zero
+    QVERIFY(std::isfinite(GLTextureTransferEngine::evalPromotePriority(0, 0.0f)));
+}
+
+void TextureStreamingTests::testDemotePriority() {
+    // Off screen, largest first
+    QVERIFY(GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 0.0f) >
+            GLTextureTransferEngine::evalDemotePriority(SMALL_TEXTURE, 0.0f));
+    // Same size, the one covering less of the view first
+    QVERIFY(GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 0.0f) >
+            GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 0.01f));
+    QVERIFY(GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 0.01f) >
+            GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 0.5f));
+    // A small texture nobody sees goes before a large one filling the view
+    QVERIFY(GLTextureTransferEngine::evalDemotePriority(SMALL_TEXTURE, 0.0f) >
+            GLTextureTransferEngine::evalDemotePriority(LARGE_TEXTURE, 1.0f));
+}
+
+void TextureStreamingTests::testScreenCoverage() {
+    auto texture = gpu::Texture::createStrict(gpu::Element::COLOR_RGBA_32, 16, 16);
+    QCOMPARE(texture->takeScreenCoverage(), 0.0f);
+
+    // The largest coverage reported since the last take wins, and taking it resets it
+    gpu::TextureTable table;
+    table.setTexture(0, texture);
+    table.noteScreenCoverage(0.25f);
+    texture->noteScreenCoverage(0.5f);
+    texture->noteScreenCoverage(0.125f);
+    QCOMPARE(texture->takeScreenCoverage(), 0.5f);
+    QCOMPARE(texture->takeScreenCoverage(), 0.0f);
+}
@@ -0,0 +1,22 @@
+//
+//  TextureStreamingTests.h
+//  tests/gpu/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class TextureStreamingTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testPromotePriority();
+    void testDemotePriority();
+    void testScreenCoverage();
+};
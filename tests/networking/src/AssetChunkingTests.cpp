@@ -0,0 +1,96 @@
+//
+//  AssetChunkingTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetChunkingTests.h"
+
+#include <random>
+#include <set>
+
+#include <AssetUtils.h>
+
+QTEST_MAIN(AssetChunkingTests)
+
+static const int TEST_DATA_SIZE = 4 * 1024 * 1024;
+
+static QByteArray createRandomData(int size, unsigned int seed) {
+    // mt19937 produces the same sequence on every platform, so the test data is identical everywhere
+    std::mt19937 generator(seed);
+    QByteArray data(size, 0);
+    for (auto& byte : data) {
+        byte = (char)(generator() & 0xFF);
+    }
+    return data;
+}
+
+void AssetChunkingTests::testSmallInputs() {
+    QVERIFY(AssetUtils::findChunkBoundaries(QByteArray()).empty());
+
+    auto boundaries = AssetUtils::findChunkBoundaries(createRandomData(100, 1));
+    QCOMPARE((int)boundaries.size(), 1);
+    QCOMPARE(boundaries[0], 100);
+
+    boundaries = AssetUtils::findChunkBoundaries(createRandomData(AssetUtils::MIN_CHUNK_SIZE, 1));
+    QCOMPARE((int)boundaries.size(), 1);
+    QCOMPARE(boundaries[0], AssetUtils::MIN_CHUNK_SIZE);
+}
+
+void AssetChunkingTests::testChunkSizes() {
+    auto data = createRandomData(TEST_DATA_SIZE, 1);
+    auto boundaries = AssetUtils::findChunkBoundaries(data);
+    QVERIFY(!boundaries.empty());
+    QCOMPARE(boundaries.back(), data.size());
+
+    int chunkStart = 0;
+    for (size_t i = 0; i < boundaries.size(); ++i) {
+        int chunkSize = boundaries[i] - chunkStart;
+        QVERIFY(chunkSize <= AssetUtils::MAX_CHUNK_SIZE);
+        // only the last chunk can be shorter than the minimum
+        QVERIFY(chunkSize > AssetUtils::MIN_CHUNK_SIZE || i == boundaries.size() - 1);
+        chunkStart = boundaries[i];
+    }
+
+    // The boundaries come from the content, not from the maximum size
+    int averageChunkSize = data.size() / (int)boundaries.size();
+    QVERIFY(averageChunkSize > AssetUtils::MIN_CHUNK_SIZE);
+    QVERIFY(averageChunkSize < AssetUtils::MAX_CHUNK_SIZE / 2);
+
+    // and are the same every time
+    QVERIFY(AssetUtils::findChunkBoundaries(data) == boundaries);
+}
+
+void AssetChunkingTests::testBoundariesStableUnderInsert() {
+    const int INSERT_SIZE = 100;
+    // Past this distance from an edit, the chunker is expected to have found a boundary it shares with the original
+    const int RESYNC_DISTANCE = 4 * AssetUtils::MAX_CHUNK_SIZE;
+
+    for (unsigned int seed = 1; seed <= 8; ++seed) {
+        auto original = createRandomData(TEST_DATA_SIZE, seed);
+        const int insertOffset = TEST_DATA_SIZE / 2 + 12345;
+        auto modified = original;
+        modified.insert(insertOffset, createRandomData(INSERT_SIZE, seed + 100));
+
+        auto originalBoundaries = AssetUtils::findChunkBoundaries(original);
+        auto modifiedBoundaries = AssetUtils::findChunkBoundaries(modified);
+        std::set<int> modifiedSet(modifiedBoundaries.begin(), modifiedBoundaries.end());
+
+        int changedChunks = 0;
+        for (int boundary : originalBoundaries) {
+            if (boundary <= insertOffset) {
+                // chunks before the edit are untouched
+                QVERIFY(modifiedSet.count(boundary) == 1);
+            } else if (modifiedSet.count(boundary + INSERT_SIZE) == 0) {
+                // chunks after it only move by the size of the insert, once the chunker has resynchronized
+                QVERIFY(boundary < insertOffset + RESYNC_DISTANCE);
+                ++changedChunks;
+            }
+        }
+        QVERIFY(changedChunks <= 3);
+    }
+}
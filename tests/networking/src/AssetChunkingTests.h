@@ -0,0 +1,24 @@
+//
+//  AssetChunkingTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetChunkingTests_h
+#define hifi_AssetChunkingTests_h
+
+#include <QtTest/QtTest>
+
+class AssetChunkingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testSmallInputs();
+    void testChunkSizes();
+    void testBoundariesStableUnderInsert();
+};
+
+#endif // hifi_AssetChunkingTests_h
@@ -0,0 +1,143 @@
+//
+//  PhysicsStepTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsStepTests.h"
+
+#include <memory>
+#include <vector>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <PhysicsTaskScheduler.h>
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_MAIN(PhysicsStepTests)
+
+const int NUM_STACKS_PER_SIDE = 10;
+const int NUM_BOXES_PER_STACK = 10;
+const float BOX_HALF_EXTENT = 0.25f;
+const float STACK_SPACING = 1.0f;
+const float FIXED_SUBSTEP = 1.0f / 90.0f;
+
+// A headless world assembled the same way as PhysicsEngine::init(): a grid of box stacks resting on a static floor.
+class StackedBoxesScene {
+public:
+    StackedBoxesScene(int numThreads) {
+        _collisionConfig.reset(new btDefaultCollisionConfiguration());
+        _broadphase.reset(new btDbvtBroadphase());
+#if BT_THREADSAFE
+        PhysicsTaskScheduler::install(numThreads);
+        _dispatcher.reset(new btCollisionDispatcherMt(_collisionConfig.get(), 40));
+        _solverPool.reset(new btConstraintSolverPoolMt(numThreads));
+        _solver.reset(new btSequentialImpulseConstraintSolverMt());
+        _world.reset(new ThreadSafeDynamicsWorld(_dispatcher.get(), _broadphase.get(), _solverPool.get(),
+                                                 _solver.get(), _collisionConfig.get()));
+#else
+        Q_UNUSED(numThreads);
+        _dispatcher.reset(new btCollisionDispatcher(_collisionConfig.get()));
+        _solver.reset(new btSequentialImpulseConstraintSolver());
+        _world.reset(new ThreadSafeDynamicsWorld(_dispatcher.get(), _broadphase.get(), _solver.get(), _collisionConfig.get()));
+#endif
+        _world->setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+        _floorShape.reset(new btBoxShape(btVector3(50.0f, 0.5f, 50.0f)));
+        addBody(_floorShape.get(), 0.0f, btVector3(0.0f, -0.5f, 0.0f));
+
+        _boxShape.reset(new btBoxShape(btVector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT)));
+        float offset = 0.5f * STACK_SPACING * (float)(NUM_STACKS_PER_SIDE - 1);
+        for (int x = 0; x < NUM_STACKS_PER_SIDE; x++) {
+            for (int z = 0; z < NUM_STACKS_PER_SIDE; z++) {
+                for (int y = 0; y < NUM_BOXES_PER_STACK; y++) {
+                    btVector3 position((float)x * STACK_SPACING - offset, BOX_HALF_EXTENT * (float)(2 * y + 1),
+                                       (float)z * STACK_SPACING - offset);
+                    addBody(_boxShape.get(), 1.0f, position);
+                }
+            }
+        }
+    }
+
+    ~StackedBoxesScene() {
+        for (auto& body : _bodies) {
+            _world->removeRigidBody(body.get());
+        }
+    }
+
+    void step() {
+        _world->stepSimulationWithSubstepCallback(FIXED_SUBSTEP, 1, FIXED_SUBSTEP);
+    }
+
+    const std::vector<std::unique_ptr<btRigidBody>>& getBodies() const { return _bodies; }
+
+private:
+    void addBody(btCollisionShape* shape, float mass, const btVector3& position) {
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f) {
+            shape->calculateLocalInertia(mass, inertia);
+        }
+        btRigidBody::btRigidBodyConstructionInfo info(mass, nullptr, shape, inertia);
+        info.m_startWorldTransform.setOrigin(position);
+        _bodies.emplace_back(new btRigidBody(info));
+        _world->addRigidBody(_bodies.back().get());
+    }
+
+    std::unique_ptr<btDefaultCollisionConfiguration> _collisionConfig;
+    std::unique_ptr<btBroadphaseInterface> _broadphase;
+    std::unique_ptr<btCollisionDispatcher> _dispatcher;
+#if BT_THREADSAFE
+    std::unique_ptr<btConstraintSolverPoolMt> _solverPool;
+#endif
+    std::unique_ptr<btSequentialImpulseConstraintSolver> _solver;
+    std::unique_ptr<ThreadSafeDynamicsWorld> _world;
+    std::unique_ptr<btCollisionShape> _floorShape;
+    std::unique_ptr<btCollisionShape> _boxShape;
+    std::vector<std::unique_ptr<btRigidBody>> _bodies;
+};
+
+void PhysicsStepTests::testStackedBoxesSettle() {
+    // whatever the thread count the stacks must stay standing: the top box of each stack should barely move.
+    StackedBoxesScene scene(QThread::idealThreadCount());
+    const int NUM_STEPS = 90;
+    for (int i = 0; i < NUM_STEPS; i++) {
+        scene.step();
+    }
+    const float MAX_DROP = 0.1f;
+    float restingHeight = BOX_HALF_EXTENT * (float)(2 * NUM_BOXES_PER_STACK - 1);
+    const auto& bodies = scene.getBodies();
+    for (size_t i = NUM_BOXES_PER_STACK; i < bodies.size(); i += NUM_BOXES_PER_STACK) {
+        float height = bodies[i]->getWorldTransform().getOrigin().getY();
+        QVERIFY(fabsf(height - restingHeight) < MAX_DROP);
+    }
+}
+
+void PhysicsStepTests::benchmarkStackedBoxes_data() {
+    QTest::addColumn<int>("numThreads");
+#if BT_THREADSAFE
+    for (int numThreads = 1; numThreads <= QThread::idealThreadCount(); numThreads *= 2) {
+        QTest::newRow(qPrintable(QString("%1 threads").arg(numThreads))) << numThreads;
+    }
+#else
+    QTest::newRow("1 thread") << 1;
+#endif
+}
+
+void PhysicsStepTests::benchmarkStackedBoxes() {
+    QFETCH(int, numThreads);
+    StackedBoxesScene scene(numThreads);
+
+    // let the stacks settle into contact first so each step does a realistic amount of narrowphase and solving
+    const int NUM_WARMUP_STEPS = 10;
+    for (int i = 0; i < NUM_WARMUP_STEPS; i++) {
+        scene.step();
+    }
+
+    QBENCHMARK {
+        scene.step();
+    }
+}
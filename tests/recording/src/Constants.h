@@ -15,6 +15,7 @@
 
 static const QString HEADER_NAME = "com.highfidelity.recording.Header";
 static const QString TEST_NAME = "com.highfidelity.recording.Test";
+static const QString TEST_AUDIO_NAME = "com.highfidelity.recording.TestAudio";
 
 #endif // hifi_FrameTests_h
 
@@ -14,8 +14,17 @@
 #pragma clang diagnostic ignored "-Wunused-private-field"
 #endif
 
+#include <algorithm>
+#include <ctime>
+
 #include <QtGlobal>
 #include <QtTest/QtTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QCborArray>
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTimer>
 #include <QtCore/QTemporaryFile>
 #include <QtCore/QString>
 
@@ -28,14 +37,19 @@
 #endif
 
 #include <recording/Clip.h>
+#include <recording/Deck.h>
+#include <recording/DeckScheduler.h>
 #include <recording/Frame.h>
+#include <recording/impl/ChunkedClip.h>
 
+#include <NumericalConstants.h>
 #include <SharedUtil.h>
 
 #include "Constants.h"
 
 using namespace recording;
 FrameType TEST_FRAME_TYPE { Frame::TYPE_INVALID };
+FrameType TEST_AUDIO_FRAME_TYPE { Frame::TYPE_INVALID };
 
 void testFrameTypeRegistration() {
     TEST_FRAME_TYPE = Frame::registerFrameType(TEST_NAME);
@@ -119,10 +133,222 @@ void testClipOrdering() {
     Q_UNUSED(lastFrameTimeOffset); // FIXME - Unix build not yet upgraded to Qt 5.5.1 we can remove this once it is
 }
 
-int main(int, const char**) {
+// shaped like an avatar frame: a CBOR document of single precision joint data that moves a little every frame
+QByteArray makeJointFrame(float seconds) {
+    const int NUM_JOINTS = 80;
+    QCborArray joints;
+    for (int i = 0; i < NUM_JOINTS; ++i) {
+        float halfAngle = 0.5f * (seconds * 0.7f + (float)i * 0.1f);
+        QCborArray rotation { (double)cosf(halfAngle), (double)(0.6f * sinf(halfAngle)), (double)(0.8f * sinf(halfAngle)), 0.0 };
+        QCborArray translation { (double)(0.1f * (float)i), (double)(0.05f * sinf(halfAngle)), 0.0 };
+        joints.append(QCborArray { rotation, translation, i % 2 == 0, false });
+    }
+    QCborMap frame;
+    frame.insert(QStringLiteral("version"), 2);
+    frame.insert(QStringLiteral("jointArray"), joints);
+    return QCborValue(frame).toCbor();
+}
+
+QByteArray makeAudioFrame(int index) {
+    const int NUM_SAMPLES = 240;
+    QByteArray result(NUM_SAMPLES * sizeof(int16_t), 0);
+    int16_t* samples = reinterpret_cast<int16_t*>(result.data());
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        samples[i] = (int16_t)(((index * NUM_SAMPLES + i) * 7919) % 2001 - 1000);
+    }
+    return result;
+}
+
+bool closeEnough(const QCborValue& actual, const QCborValue& expected, double tolerance) {
+    if (expected.isDouble()) {
+        return actual.isDouble() && fabs(actual.toDouble() - expected.toDouble()) <= fabs(expected.toDouble()) * tolerance;
+    }
+    if (expected.isArray()) {
+        auto actualArray = actual.toArray();
+        auto expectedArray = expected.toArray();
+        if (actualArray.size() != expectedArray.size()) {
+            return false;
+        }
+        for (qsizetype i = 0; i < expectedArray.size(); ++i) {
+            if (!closeEnough(actualArray[i], expectedArray[i], tolerance)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (expected.isMap()) {
+        auto actualMap = actual.toMap();
+        auto expectedMap = expected.toMap();
+        if (actualMap.size() != expectedMap.size()) {
+            return false;
+        }
+        for (auto itr = expectedMap.constBegin(); itr != expectedMap.constEnd(); ++itr) {
+            if (!closeEnough(actualMap.value(itr.key()), itr.value(), tolerance)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return actual == expected;
+}
+
+Clip::Pointer makeAvatarClip(float seconds, bool withAudio) {
+    auto clip = Clip::newClip();
+    const float JOINT_FRAME_SECONDS = 0.02f;
+    const float AUDIO_FRAME_SECONDS = 0.01f;
+    for (int i = 0; (float)i * JOINT_FRAME_SECONDS < seconds; ++i) {
+        float time = (float)i * JOINT_FRAME_SECONDS;
+        clip->addFrame(std::make_shared<Frame>(TEST_FRAME_TYPE, time, makeJointFrame(time)));
+    }
+    for (int i = 0; withAudio && (float)i * AUDIO_FRAME_SECONDS < seconds; ++i) {
+        clip->addFrame(std::make_shared<Frame>(TEST_AUDIO_FRAME_TYPE, (float)i * AUDIO_FRAME_SECONDS, makeAudioFrame(i)));
+    }
+    return clip;
+}
+
+void testChunkedRoundTrip() {
+    TEST_AUDIO_FRAME_TYPE = Frame::registerFrameType(TEST_AUDIO_NAME);
+
+    QTemporaryFile file;
+    QString fileName;
+    if (file.open()) {
+        fileName = file.fileName();
+        file.close();
+    }
+
+    auto writeClip = makeAvatarClip(30.0f, true);
+    Clip::toFile(fileName, writeClip);
+    auto readClip = Clip::fromFile(fileName);
+    QVERIFY(readClip != Clip::Pointer());
+    QVERIFY(readClip->frameCount() == writeClip->frameCount());
+    QVERIFY(readClip->duration() == writeClip->duration());
+
+    // joints come back within the precision the writer keeps, everything else exactly
+    const double tolerance = 1.0 / (double)(1 << ChunkedClip::DEFAULT_SIGNIFICANT_BITS);
+    readClip->seek(0);
+    writeClip->seek(0);
+    size_t count = 0;
+    for (auto readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(); readFrame && writeFrame;
+        readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(), ++count) {
+        QVERIFY(readFrame->type == writeFrame->type);
+        QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+        if (writeFrame->type == TEST_FRAME_TYPE) {
+            QVERIFY(closeEnough(QCborValue::fromCbor(readFrame->data), QCborValue::fromCbor(writeFrame->data), tolerance));
+        } else {
+            QVERIFY(readFrame->data == writeFrame->data);
+        }
+    }
+    QVERIFY(readClip->frameCount() == count);
+
+    // seeking lands on the same frames, in the middle of a chunk, on a chunk boundary and past the end
+    for (float position : { 12.345f, 1.0f, 29.99f, 0.0f }) {
+        readClip->seek(position);
+        writeClip->seek(position);
+        QVERIFY(readClip->position() == writeClip->position());
+        auto readFrame = readClip->peekFrame();
+        auto writeFrame = writeClip->peekFrame();
+        QVERIFY(readFrame && writeFrame);
+        QVERIFY(readFrame->type == writeFrame->type);
+        QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+    }
+    readClip->seek(60.0f);
+    QVERIFY(!readClip->nextFrame());
+
+    // nothing is lost when all the bits are kept
+    auto jointClip = makeAvatarClip(5.0f, false);
+    QBuffer buffer;
+    buffer.open(QBuffer::WriteOnly);
+    QVERIFY(ChunkedClip::write(buffer, *jointClip, ChunkedClip::FULL_SIGNIFICANT_BITS));
+    buffer.close();
+    ChunkedClip losslessClip((const uchar*)buffer.data().constData(), buffer.data().size());
+    QVERIFY(losslessClip.frameCount() == jointClip->frameCount());
+    jointClip->seek(0);
+    for (auto readFrame = losslessClip.nextFrame(), writeFrame = jointClip->nextFrame(); readFrame && writeFrame;
+        readFrame = losslessClip.nextFrame(), writeFrame = jointClip->nextFrame()) {
+        QVERIFY(readFrame->data == writeFrame->data);
+    }
+
+    // the frame by frame format qCompress'd each frame and gave it an 8 byte header, the frames held in memory
+    // before it are kept raw
+    jointClip = makeAvatarClip(30.0f, false);
+    qint64 rawSize = 0;
+    qint64 frameByFrameSize = 0;
+    jointClip->seek(0);
+    for (auto frame = jointClip->nextFrame(); frame; frame = jointClip->nextFrame()) {
+        rawSize += frame->data.size();
+        frameByFrameSize += sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize) + qCompress(frame->data).size();
+    }
+    qint64 chunkedSize = Clip::toBuffer(jointClip).size();
+    qDebug() << "Raw" << rawSize << "bytes, frame by frame" << frameByFrameSize << "bytes, chunked" << chunkedSize << "bytes -"
+             << (double)frameByFrameSize / chunkedSize << "times smaller than frame by frame,"
+             << (double)rawSize / chunkedSize << "times smaller than raw";
+    // about 2.3 and 6.8 times smaller on this clip, short of the order of magnitude that was hoped for
+    QVERIFY(chunkedSize * 2 < frameByFrameSize);
+    QVERIFY(chunkedSize * 5 < rawSize);
+}
+
+// Plays a few seconds of the same recording on a couple of hundred decks at once and reports how late frames
+// reached their handlers and how much CPU each playing clip cost
+void testDeckPlayback() {
+    const int NUM_DECKS = 200;
+    const float CLIP_SECONDS = 3.0f;
+
+    QByteArray clipData = Clip::toBuffer(makeAvatarClip(CLIP_SECONDS, false));
+    size_t framesPerClip = 0;
+    std::vector<std::unique_ptr<Deck>> decks;
+    std::vector<qint64> latenessMsecs;
+    int stoppedDecks = 0;
+    for (int i = 0; i < NUM_DECKS; ++i) {
+        auto clip = std::make_shared<ChunkedClip>((const uchar*)clipData.constData(), clipData.size());
+        framesPerClip = clip->frameCount();
+        decks.emplace_back(new Deck());
+        Deck* deck = decks.back().get();
+        deck->queueClip(clip);
+        deck->setFrameHandler(TEST_FRAME_TYPE, [deck, &latenessMsecs](Frame::ConstPointer frame) {
+            latenessMsecs.push_back((qint64)Frame::secondsToFrameTime(deck->position()) - (qint64)frame->timeOffset);
+        });
+        QObject::connect(deck, &Deck::playbackStateChanged, [deck, &stoppedDecks] {
+            if (!deck->isPlaying() && ++stoppedDecks == NUM_DECKS) {
+                QCoreApplication::quit();
+            }
+        });
+    }
+
+    auto startCPU = std::clock();
+    auto startTime = usecTimestampNow();
+    for (auto& deck : decks) {
+        deck->play();
+    }
+    QVERIFY(DeckScheduler::getInstance().getPlayingDeckCount() == (size_t)NUM_DECKS);
+    QTimer::singleShot((int)(CLIP_SECONDS * 2000.0f), [] { QCoreApplication::quit(); });
+    QCoreApplication::exec();
+    float cpuMsecs = (float)(std::clock() - startCPU) * 1000.0f / (float)CLOCKS_PER_SEC;
+    float wallMsecs = (float)(usecTimestampNow() - startTime) / (float)USECS_PER_MSEC;
+
+    QVERIFY(stoppedDecks == NUM_DECKS);
+    QVERIFY(latenessMsecs.size() == framesPerClip * NUM_DECKS);
+
+    std::sort(latenessMsecs.begin(), latenessMsecs.end());
+    qint64 totalLateness = 0;
+    for (auto lateness : latenessMsecs) {
+        totalLateness += lateness;
+    }
+    float meanLateness = (float)totalLateness / (float)latenessMsecs.size();
+    qDebug() << NUM_DECKS << "decks played" << latenessMsecs.size() << "frames in" << wallMsecs << "ms";
+    qDebug() << "Frame lateness ms: mean" << meanLateness
+        << "p50" << latenessMsecs[latenessMsecs.size() / 2]
+        << "p99" << latenessMsecs[latenessMsecs.size() * 99 / 100]
+        << "max" << latenessMsecs.back();
+    qDebug() << "CPU per playing clip:" << (cpuMsecs / NUM_DECKS) / (wallMsecs / MSECS_PER_SECOND) << "ms per second";
+}
+
+int main(int argc, char** argv) {
     setupHifiApplication("Recording Test");
+    QCoreApplication app(argc, argv);
 
     testFrameTypeRegistration();
     testFilePersist();
     testClipOrdering();
+    testChunkedRoundTrip();
+    testDeckPlayback();
 }
@@ -0,0 +1,173 @@
+//
+//  BlendshapeTests.cpp
+//  tests/render-utils/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BlendshapeTests.h"
+
+#include <random>
+
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/component_wise.hpp>
+
+#include <DependencyManager.h>
+#include <Model.h>
+
+QTEST_MAIN(BlendshapeTests)
+
+const int NUM_VERTICES = 1000;
+const int NUM_BLENDSHAPES = 8;
+
+// Packing to 10 bit snorms loses up to one step, and either side may have rounded the other way
+const float PACKING_TOLERANCE = 2.0f / 511.0f;
+
+class TestNetworkModel : public NetworkModel {
+public:
+    TestNetworkModel(const HFMModel::ConstPointer& hfmModel) { _hfmModel = hfmModel; }
+};
+
+// A model loaded with the given HFMModel, which keeps the offsets of its last blend
+class BlendshapeTestModel : public Model {
+public:
+    BlendshapeTestModel(const HFMModel::ConstPointer& hfmModel) {
+        _renderGeometry = std::make_shared<TestNetworkModel>(hfmModel);
+        _modelBlendshapeOperator = [this](int blendNumber, const QVector<BlendshapeOffset>& blendshapeOffsets,
+                                          const QVector<int>& blendedMeshSizes, const render::ItemIDs& subItemIDs) {
+            numBlends++;
+            blendedOffsets = blendshapeOffsets;
+        };
+    }
+
+    void requestBlend(const QVector<float>& coefficients) {
+        setBlendshapeCoefficients(coefficients);
+        updateBlendshapes();
+    }
+
+    int numBlends { 0 };
+    QVector<BlendshapeOffset> blendedOffsets;
+};
+
+using BlendshapeTestModelPointer = std::shared_ptr<BlendshapeTestModel>;
+
+static glm::vec3 randomVec3(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    return glm::vec3(distribution(generator), distribution(generator), distribution(generator));
+}
+
+// One mesh whose blendshapes each move an eighth of its vertices, every vertex they move shared with another
+// blendshape, so that a blend changing one or two of them only repacks the vertices they touch
+static HFMModel::ConstPointer createBlendshapeModel() {
+    std::mt19937 generator(42);
+    HFMMesh mesh;
+    for (int i = 0; i < NUM_VERTICES; ++i) {
+        mesh.vertices.push_back(randomVec3(generator));
+    }
+    for (int i = 0; i < NUM_BLENDSHAPES; ++i) {
+        HFMBlendshape blendshape;
+        for (int index = i % (NUM_BLENDSHAPES / 2); index < NUM_VERTICES; index += NUM_BLENDSHAPES) {
+            blendshape.indices.push_back(index);
+            blendshape.vertices.push_back(randomVec3(generator));
+            blendshape.normals.push_back(randomVec3(generator));
+            blendshape.tangents.push_back(randomVec3(generator));
+        }
+        mesh.blendshapes.push_back(blendshape);
+    }
+
+    auto hfmModel = std::make_shared<HFMModel>();
+    hfmModel->meshes.push_back(mesh);
+    return hfmModel;
+}
+
+static BlendshapeOffsetUnpacked unpack(const BlendshapeOffset& packed) {
+    BlendshapeOffsetUnpacked unpacked;
+    float length = glm::uintBitsToFloat(packed.packedPosNorTan.x);
+    unpacked.positionOffset = glm::vec3(glm::unpackSnorm3x10_1x2(packed.packedPosNorTan.y)) * length;
+    unpacked.normalOffset = glm::vec3(glm::unpackSnorm3x10_1x2(packed.packedPosNorTan.z));
+    unpacked.tangentOffset = glm::vec3(glm::unpackSnorm3x10_1x2(packed.packedPosNorTan.w));
+    return unpacked;
+}
+
+static bool isClose(const glm::vec3& a, const glm::vec3& b, float tolerance) {
+    return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec3(tolerance)));
+}
+
+static void blendAndWait(const BlendshapeTestModelPointer& model, const QVector<float>& coefficients) {
+    int numBlends = model->numBlends;
+    model->requestBlend(coefficients);
+    QTRY_COMPARE(model->numBlends, numBlends + 1);
+}
+
+void BlendshapeTests::initTestCase() {
+    qRegisterMetaType<QVector<BlendshapeOffset>>("QVector<BlendshapeOffset>");
+    qRegisterMetaType<QVector<int>>("QVector<int>");
+    DependencyManager::set<ModelBlender>();
+}
+
+void BlendshapeTests::testIncrementalBlendMatchesFullBlend() {
+    auto hfmModel = createBlendshapeModel();
+
+    // Blend a sequence of coefficients, raising, lowering and dropping some of them, so that all but the first blend
+    // only apply the change from the previous one.  Changing all of them repacks every vertex, changing a single one
+    // only repacks the vertices it moves.
+    auto incrementalModel = std::make_shared<BlendshapeTestModel>(hfmModel);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    QVector<float> coefficients(NUM_BLENDSHAPES, 0.0f);
+    for (int step = 0; step < 20; ++step) {
+        for (int i = 0; i < NUM_BLENDSHAPES; ++i) {
+            if (step % 2 == 0 || i == step % NUM_BLENDSHAPES) {
+                coefficients[i] = (i + step) % 4 == 0 ? 0.0f : distribution(generator);
+            }
+        }
+        blendAndWait(incrementalModel, coefficients);
+    }
+
+    // the same final coefficients blended from scratch
+    auto fullModel = std::make_shared<BlendshapeTestModel>(hfmModel);
+    blendAndWait(fullModel, coefficients);
+
+    QCOMPARE(incrementalModel->blendedOffsets.size(), NUM_VERTICES);
+    QCOMPARE(fullModel->blendedOffsets.size(), NUM_VERTICES);
+    for (int i = 0; i < NUM_VERTICES; ++i) {
+        auto incremental = unpack(incrementalModel->blendedOffsets[i]);
+        auto full = unpack(fullModel->blendedOffsets[i]);
+        float positionTolerance = PACKING_TOLERANCE * glm::max(glm::compMax(glm::abs(full.positionOffset)), 1.0f);
+        QVERIFY(isClose(incremental.positionOffset, full.positionOffset, positionTolerance));
+        QVERIFY(isClose(incremental.normalOffset, full.normalOffset, PACKING_TOLERANCE));
+        QVERIFY(isClose(incremental.tangentOffset, full.tangentOffset, PACKING_TOLERANCE));
+    }
+}
+
+void BlendshapeTests::testRejectedBlendRetries() {
+    auto hfmModel = createBlendshapeModel();
+    auto modelBlender = DependencyManager::get<ModelBlender>();
+    QVector<float> coefficients(NUM_BLENDSHAPES, 0.5f);
+
+    // The blends finish on the event loop, which doesn't run until we wait, so the first models take every blender
+    // and the next ones fill the queue
+    std::vector<BlendshapeTestModelPointer> models;
+    int numModels = QThread::idealThreadCount() + (int)ModelBlender::MAX_QUEUED_BLENDS;
+    for (int i = 0; i < numModels; ++i) {
+        models.push_back(std::make_shared<BlendshapeTestModel>(hfmModel));
+        models.back()->requestBlend(coefficients);
+    }
+    QCOMPARE(modelBlender->getNumQueuedBlends(), (int)ModelBlender::MAX_QUEUED_BLENDS);
+
+    auto rejectedModel = std::make_shared<BlendshapeTestModel>(hfmModel);
+    rejectedModel->requestBlend(coefficients);
+    QCOMPARE(modelBlender->getNumQueuedBlends(), (int)ModelBlender::MAX_QUEUED_BLENDS);
+
+    for (const auto& model : models) {
+        QTRY_COMPARE(model->numBlends, 1);
+    }
+    QCOMPARE(rejectedModel->numBlends, 0);
+
+    // its coefficients haven't changed, but it still needs the blend it was turned away for
+    rejectedModel->requestBlend(coefficients);
+    QTRY_COMPARE(rejectedModel->numBlends, 1);
+}
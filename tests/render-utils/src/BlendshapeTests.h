@@ -0,0 +1,26 @@
+//
+//  BlendshapeTests.h
+//  tests/render-utils/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_utils_BlendshapeTests_h
+#define hifi_render_utils_BlendshapeTests_h
+
+#include <QtTest/QtTest>
+
+class BlendshapeTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void testIncrementalBlendMatchesFullBlend();
+    void testRejectedBlendRetries();
+};
+
+#endif // hifi_render_utils_BlendshapeTests_h
@@ -0,0 +1,205 @@
+//
+//  CullSortTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CullSortTests.h"
+
+#include <unordered_set>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <render/Args.h>
+#include <render/CullTask.h>
+#include <render/Scene.h>
+#include <render/SortTask.h>
+
+QTEST_MAIN(CullSortTests)
+
+// a synthetic scene: boxes of various sizes scattered through a cube around the origin,
+// enough of them that every job takes its multithreaded path
+const float SCENE_SIZE = 512.0f;
+const int NUM_ITEMS_PER_AXIS = 28;
+const float ITEM_SPACING = 12.0f;
+
+struct TestItem {
+    AABox bound;
+};
+using TestItemPointer = std::shared_ptr<TestItem>;
+using TestItemPayload = render::Payload<TestItem>;
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const TestItemPointer& item) { return ItemKey::Builder::opaqueShape(); }
+    template <> const Item::Bound payloadGetBound(const TestItemPointer& item) { return item->bound; }
+}
+
+static render::ScenePointer scene;
+static ViewFrustum frustum;
+static RenderArgs args;
+static render::RenderContextPointer renderContext;
+
+static render::ItemBounds fetchItemBounds() {
+    render::ItemSpatialTree::ItemSelection selection;
+    scene->getSpatialTree().selectCellItems(selection, render::ItemFilter::Builder::opaqueShape(), frustum, 0.0f);
+
+    render::ItemBounds items;
+    items.reserve(selection.numItems());
+    for (const auto* ids : { &selection.insideItems, &selection.insideSubcellItems,
+                             &selection.partialItems, &selection.partialSubcellItems }) {
+        for (auto id : *ids) {
+            items.emplace_back(id, scene->getItem(id).getBound());
+        }
+    }
+    return items;
+}
+
+static bool isBigEnough(const RenderArgs* renderArgs, const AABox& bound) {
+    // the same solid angle test the LODManager does
+    auto pos = renderArgs->getViewFrustum().getPosition() - bound.calcCenter();
+    auto dim = bound.getDimensions();
+    return 0.25f * glm::dot(dim, dim) >= renderArgs->_lodAngleHalfTanSq * glm::dot(pos, pos);
+}
+
+void CullSortTests::initTestCase() {
+    scene = std::make_shared<render::Scene>(glm::vec3(-0.5f * SCENE_SIZE), SCENE_SIZE);
+
+    render::Transaction transaction;
+    const float HALF_EXTENT = 0.5f * ITEM_SPACING * (float)(NUM_ITEMS_PER_AXIS - 1);
+    for (int i = 0; i < NUM_ITEMS_PER_AXIS; ++i) {
+        for (int j = 0; j < NUM_ITEMS_PER_AXIS; ++j) {
+            for (int k = 0; k < NUM_ITEMS_PER_AXIS; ++k) {
+                // sizes cycle from half a meter to ten meters so the items land at many octree depths
+                float size = 0.5f + (float)((i * 7 + j * 3 + k) % 20) * 0.5f;
+                glm::vec3 center = glm::vec3(i, j, k) * ITEM_SPACING - glm::vec3(HALF_EXTENT);
+                auto item = std::make_shared<TestItem>();
+                item->bound = AABox(center - glm::vec3(0.5f * size), size);
+                transaction.resetItem(scene->allocateID(), std::make_shared<TestItemPayload>(item));
+            }
+        }
+    }
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    frustum.setProjection(glm::perspective(glm::radians(90.0f), 16.0f / 9.0f, 0.1f, 1000.0f));
+    frustum.setPosition(glm::vec3(-0.5f * HALF_EXTENT, 0.0f, 0.0f));
+    frustum.setOrientation(glm::angleAxis(glm::radians(-60.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    frustum.calculate();
+
+    args._lodAngleHalfTan = tanf(glm::radians(0.5f));
+    args._lodAngleHalfTanSq = args._lodAngleHalfTan * args._lodAngleHalfTan;
+    args.pushViewFrustum(frustum);
+
+    renderContext = std::make_shared<render::RenderContext>();
+    renderContext->args = &args;
+    renderContext->_scene = scene;
+}
+
+void CullSortTests::testFetchMatchesBruteForce() {
+    // big enough that the octree is traversed one root octant per task
+    QVERIFY(scene->getSpatialTree().getNumAllocatedCells() > 512);
+
+    render::ItemBounds fetched = fetchItemBounds();
+    std::unordered_set<render::ItemID> fetchedIDs;
+    for (const auto& item : fetched) {
+        QVERIFY(fetchedIDs.insert(item.id).second);
+    }
+
+    // every item touching the frustum must have been fetched
+    int numInView = 0;
+    int numItems = NUM_ITEMS_PER_AXIS * NUM_ITEMS_PER_AXIS * NUM_ITEMS_PER_AXIS;
+    for (render::ItemID id = 1; id <= (render::ItemID)numItems; ++id) {
+        if (frustum.boxIntersectsFrustum(scene->getItem(id).getBound())) {
+            QVERIFY(fetchedIDs.find(id) != fetchedIDs.end());
+            ++numInView;
+        }
+    }
+    QVERIFY(numInView > 1000);
+}
+
+void CullSortTests::testCullItems() {
+    render::ItemBounds inItems = fetchItemBounds();
+
+    // serial reference
+    render::ItemBounds expected;
+    int expectedOutOfView = 0;
+    int expectedTooSmall = 0;
+    for (const auto& item : inItems) {
+        if (!frustum.boxIntersectsFrustum(item.bound)) {
+            ++expectedOutOfView;
+        } else if (!isBigEnough(&args, item.bound)) {
+            ++expectedTooSmall;
+        } else {
+            expected.push_back(item);
+        }
+    }
+    QVERIFY(expectedOutOfView > 0);
+    QVERIFY(expectedTooSmall > 0);
+
+    render::RenderDetails::Item details;
+    render::ItemBounds outItems;
+    render::cullItems(renderContext, isBigEnough, details, inItems, outItems);
+
+    QCOMPARE(details._considered, (int)inItems.size());
+    QCOMPARE(details._outOfView, expectedOutOfView);
+    QCOMPARE(details._tooSmall, expectedTooSmall);
+    QCOMPARE(details._rendered, (int)expected.size());
+    QCOMPARE(outItems.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        QCOMPARE(outItems[i].id, expected[i].id);
+    }
+}
+
+void CullSortTests::testDepthSortItems() {
+    render::ItemBounds inItems = fetchItemBounds();
+    // repeated items (as meta sub items can be) must be dropped
+    inItems.insert(inItems.begin() + 1, inItems.front());
+    inItems.push_back(inItems.back());
+
+    for (bool frontToBack : { true, false }) {
+        render::ItemBounds outItems;
+        AABox bounds;
+        render::depthSortItems(renderContext, frontToBack, inItems, outItems, &bounds);
+        QCOMPARE(outItems.size(), inItems.size() - 2);
+
+        float lastDepth = frustum.distanceToCameraSquared(outItems.front().bound.calcCenter());
+        for (const auto& item : outItems) {
+            float depth = frustum.distanceToCameraSquared(item.bound.calcCenter());
+            QVERIFY(frontToBack ? depth >= lastDepth : depth <= lastDepth);
+            QVERIFY(bounds.contains(item.bound));
+            lastDepth = depth;
+        }
+    }
+}
+
+void CullSortTests::benchmarkFetch() {
+    render::ItemSpatialTree::ItemSelection selection;
+    QBENCHMARK {
+        selection.clear();
+        scene->getSpatialTree().selectCellItems(selection, render::ItemFilter::Builder::opaqueShape(), frustum,
+                                                args._lodAngleHalfTan);
+    }
+}
+
+void CullSortTests::benchmarkCull() {
+    render::ItemBounds inItems = fetchItemBounds();
+    render::ItemBounds outItems;
+    QBENCHMARK {
+        render::RenderDetails::Item details;
+        outItems.clear();
+        render::cullItems(renderContext, isBigEnough, details, inItems, outItems);
+    }
+}
+
+void CullSortTests::benchmarkSort() {
+    render::ItemBounds inItems = fetchItemBounds();
+    render::ItemBounds outItems;
+    QBENCHMARK {
+        render::depthSortItems(renderContext, true, inItems, outItems);
+    }
+}
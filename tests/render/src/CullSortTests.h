@@ -0,0 +1,31 @@
+//
+//  CullSortTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_CullSortTests_h
+#define hifi_render_CullSortTests_h
+
+#include <QtTest/QtTest>
+
+class CullSortTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void testFetchMatchesBruteForce();
+    void testCullItems();
+    void testDepthSortItems();
+
+    void benchmarkFetch();
+    void benchmarkCull();
+    void benchmarkSort();
+};
+
+#endif // hifi_render_CullSortTests_h
@@ -0,0 +1,137 @@
+//
+//  EngineStatsTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EngineStatsTests.h"
+
+#include <gpu/Batch.h>
+#include <gpu/Context.h>
+#include <render/Args.h>
+#include <render/EngineStats.h>
+#include <render/Scene.h>
+
+QTEST_MAIN(EngineStatsTests)
+
+const float SCENE_SIZE = 512.0f;
+const int NUM_ITEMS = 100;
+const uint32_t NUM_INDICES = 36;
+
+// Counts the draws of the batches it is given the way the GL backends do: an instanced draw is one API draw call
+// of numInstances draw calls.
+class DrawCountingBackend : public gpu::Backend {
+public:
+    static void init() {}
+    static gpu::BackendPointer createBackend() { return std::make_shared<DrawCountingBackend>(); }
+
+    const std::string& getVersion() const override {
+        static const std::string VERSION("DrawCounting");
+        return VERSION;
+    }
+
+    void render(const gpu::Batch& batch) override {
+        const auto& commands = batch.getCommands();
+        const auto& offsets = batch.getCommandOffsets();
+        const auto& params = batch.getParams();
+        for (size_t i = 0; i < commands.size(); ++i) {
+            switch (commands[i]) {
+                case gpu::Batch::COMMAND_draw:
+                case gpu::Batch::COMMAND_drawIndexed:
+                    _stats._DSNumDrawcalls++;
+                    _stats._DSNumAPIDrawcalls++;
+                    break;
+                case gpu::Batch::COMMAND_drawInstanced:
+                case gpu::Batch::COMMAND_drawIndexedInstanced:
+                    _stats._DSNumDrawcalls += params[offsets[i] + 4]._uint;
+                    _stats._DSNumAPIDrawcalls++;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void syncCache() override {}
+    void syncProgram(const gpu::ShaderPointer& program) override {}
+    void recycle() const override {}
+    void downloadFramebuffer(const gpu::FramebufferPointer& srcFramebuffer, const gpu::Vec4i& region, QImage& destImage) override {}
+    bool supportedTextureFormat(const gpu::Element& format) override { return true; }
+    bool isTextureManagementSparseEnabled() const override { return false; }
+};
+
+// Renders one frame with a single batch and returns the stats EngineStats reports for it
+static std::shared_ptr<render::EngineStatsConfig> evalFrameStats(const std::function<void(gpu::Batch&)>& recordBatch) {
+    auto context = std::make_shared<gpu::Context>();
+    context->beginFrame();
+    auto batch = gpu::Context::acquireBatch("EngineStatsTests");
+    recordBatch(*batch);
+    context->appendFrameBatch(batch);
+    context->executeFrame(context->endFrame());
+
+    RenderArgs args(context);
+    auto renderContext = std::make_shared<render::RenderContext>();
+    renderContext->args = &args;
+    renderContext->_scene = std::make_shared<render::Scene>(glm::vec3(-0.5f * SCENE_SIZE), SCENE_SIZE);
+    auto config = std::make_shared<render::EngineStatsConfig>();
+    renderContext->jobConfig = config;
+
+    render::EngineStats engineStats;
+    engineStats.run(renderContext);
+    return config;
+}
+
+static Transform translation(int i) {
+    Transform transform;
+    transform.setTranslation(glm::vec3((float)i, 0.0f, 0.0f));
+    return transform;
+}
+
+// What an instanced ModelMeshPartPayload records: its transform, and the named call drawing all of its instances
+static void recordInstance(gpu::Batch& batch, const std::string& name, int i) {
+    batch.setModelTransform(translation(i));
+    batch.setupNamedCalls(name, [](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) {
+        batch.drawIndexedInstanced((gpu::uint32)data.count(), gpu::TRIANGLES, NUM_INDICES);
+    });
+}
+
+void EngineStatsTests::initTestCase() {
+    gpu::Context::init<DrawCountingBackend>();
+}
+
+void EngineStatsTests::testSeparateDrawCalls() {
+    auto config = evalFrameStats([](gpu::Batch& batch) {
+        for (int i = 0; i < NUM_ITEMS; ++i) {
+            batch.setModelTransform(translation(i));
+            batch.drawIndexed(gpu::TRIANGLES, NUM_INDICES);
+        }
+    });
+    QCOMPARE(config->frameDrawcallCount, (quint32)NUM_ITEMS);
+    QCOMPARE(config->frameAPIDrawcallCount, (quint32)NUM_ITEMS);
+}
+
+void EngineStatsTests::testNamedCallsDrawInstanced() {
+    auto config = evalFrameStats([](gpu::Batch& batch) {
+        for (int i = 0; i < NUM_ITEMS; ++i) {
+            recordInstance(batch, "ModelMeshPart:0", i);
+        }
+    });
+    QCOMPARE(config->frameDrawcallCount, (quint32)NUM_ITEMS);
+    QCOMPARE(config->frameAPIDrawcallCount, (quint32)1);
+}
+
+void EngineStatsTests::testNamedCallsSplitByName() {
+    // parts with different meshes, pipelines or materials get their own instanced draw
+    const int NUM_NAMES = 4;
+    auto config = evalFrameStats([](gpu::Batch& batch) {
+        for (int i = 0; i < NUM_ITEMS; ++i) {
+            recordInstance(batch, "ModelMeshPart:" + std::to_string(i % NUM_NAMES), i);
+        }
+    });
+    QCOMPARE(config->frameDrawcallCount, (quint32)NUM_ITEMS);
+    QCOMPARE(config->frameAPIDrawcallCount, (quint32)NUM_NAMES);
+}
@@ -0,0 +1,27 @@
+//
+//  EngineStatsTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_EngineStatsTests_h
+#define hifi_render_EngineStatsTests_h
+
+#include <QtTest/QtTest>
+
+class EngineStatsTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void testSeparateDrawCalls();
+    void testNamedCallsDrawInstanced();
+    void testNamedCallsSplitByName();
+};
+
+#endif // hifi_render_EngineStatsTests_h
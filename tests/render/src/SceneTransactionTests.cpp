@@ -0,0 +1,213 @@
+//
+//  SceneTransactionTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SceneTransactionTests.h"
+
+#include <render/Scene.h>
+
+QTEST_MAIN(SceneTransactionTests)
+
+const float SCENE_SIZE = 512.0f;
+const int NUM_ITEMS = 4096;
+
+struct MovingItem {
+    Transform transform;
+    float size { 1.0f };
+    int numTransformUpdates { 0 };
+};
+using MovingItemPointer = std::shared_ptr<MovingItem>;
+using MovingItemPayload = render::Payload<MovingItem>;
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const MovingItemPointer& item) { return ItemKey::Builder::opaqueShape(); }
+    template <> const Item::Bound payloadGetBound(const MovingItemPointer& item) {
+        return AABox(item->transform.getTranslation() - glm::vec3(0.5f * item->size), item->size);
+    }
+    template <> void payloadUpdateTransform(const MovingItemPointer& item, const Transform& transform) {
+        item->transform = transform;
+        item->numTransformUpdates++;
+    }
+}
+
+static Transform translation(const glm::vec3& position) {
+    Transform transform;
+    transform.setTranslation(position);
+    return transform;
+}
+
+static std::vector<render::ItemID> addItems(const render::ScenePointer& scene, std::vector<MovingItemPointer>& items) {
+    std::vector<render::ItemID> ids;
+    render::Transaction transaction;
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        auto item = std::make_shared<MovingItem>();
+        item->transform = translation(glm::vec3((float)(i % 64), (float)(i / 64), 0.0f));
+        items.push_back(item);
+        ids.push_back(scene->allocateID());
+        transaction.resetItem(ids.back(), std::make_shared<MovingItemPayload>(item));
+    }
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+    return ids;
+}
+
+// the spatial tree cell the item sits in must enclose its current bound
+static bool isInItsCell(const render::ScenePointer& scene, render::ItemID id) {
+    const auto& item = scene->getItem(id);
+    const auto& tree = scene->getSpatialTree();
+    return tree.evalBound(tree.getCellLocation(item.getCell())).contains(item.getBound());
+}
+
+static render::ScenePointer makeScene() {
+    return std::make_shared<render::Scene>(glm::vec3(-0.5f * SCENE_SIZE), SCENE_SIZE);
+}
+
+void SceneTransactionTests::testTransformUpdatesCoalesce() {
+    auto scene = makeScene();
+    std::vector<MovingItemPointer> items;
+    auto ids = addItems(scene, items);
+
+    // every item moved three times in one frame, only the last one is applied
+    render::Transaction transaction;
+    for (int step = 1; step <= 3; ++step) {
+        for (size_t i = 0; i < ids.size(); ++i) {
+            transaction.updateItemTransform(ids[i], translation(glm::vec3(-50.0f * step, 0.0f, (float)i * 0.01f)));
+        }
+    }
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    const auto& stats = scene->getTransactionStats();
+    QCOMPARE(stats.numTransformUpdates, (uint32_t)(3 * NUM_ITEMS));
+    QCOMPARE(stats.numItemsUpdated, (uint32_t)NUM_ITEMS);
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        QCOMPARE(items[i]->numTransformUpdates, 1);
+        QCOMPARE(items[i]->transform.getTranslation().x, -150.0f);
+
+        // and the item was moved in the spatial tree
+        QVERIFY(isInItsCell(scene, ids[i]));
+    }
+}
+
+void SceneTransactionTests::testMixedUpdates() {
+    auto scene = makeScene();
+    std::vector<MovingItemPointer> items;
+    auto ids = addItems(scene, items);
+
+    // a functor queued for the same item is applied after its transform
+    render::Transaction transaction;
+    transaction.updateItemTransform(ids[0], translation(glm::vec3(10.0f)));
+    transaction.updateItem<MovingItem>(ids[0], [](MovingItem& item) {
+        item.size = 20.0f;
+    });
+    transaction.updateItem<MovingItem>(ids[0], [](MovingItem& item) {
+        item.transform.setTranslation(glm::vec3(-10.0f));
+    });
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    const auto& stats = scene->getTransactionStats();
+    QCOMPARE(stats.numUpdates, (uint32_t)3);
+    QCOMPARE(stats.numItemsUpdated, (uint32_t)1);
+    QCOMPARE(items[0]->transform.getTranslation(), glm::vec3(-10.0f));
+    QCOMPARE(items[0]->size, 20.0f);
+
+    const auto& item = scene->getItem(ids[0]);
+    QVERIFY(item.getBound().contains(glm::vec3(-15.0f)));
+    QVERIFY(isInItsCell(scene, ids[0]));
+}
+
+void SceneTransactionTests::testUpdatesKeepSubmissionOrder() {
+    auto scene = makeScene();
+    std::vector<MovingItemPointer> items;
+    auto ids = addItems(scene, items);
+
+    // a transform queued after a functor has the last word
+    render::Transaction transaction;
+    transaction.updateItem<MovingItem>(ids[0], [](MovingItem& item) {
+        item.transform.setTranslation(glm::vec3(-10.0f));
+    });
+    transaction.updateItemTransform(ids[0], translation(glm::vec3(10.0f)));
+
+    // and when coalesced, the last transform is applied in its own place, after the functor
+    transaction.updateItemTransform(ids[1], translation(glm::vec3(5.0f)));
+    transaction.updateItem<MovingItem>(ids[1], [](MovingItem& item) {
+        item.transform.setTranslation(glm::vec3(-10.0f));
+    });
+    transaction.updateItemTransform(ids[1], translation(glm::vec3(20.0f)));
+    scene->enqueueTransaction(transaction);
+
+    // transactions merged into the same frame keep their order too
+    render::Transaction firstTransaction;
+    firstTransaction.updateItem<MovingItem>(ids[2], [](MovingItem& item) {
+        item.transform.setTranslation(glm::vec3(-10.0f));
+    });
+    render::Transaction secondTransaction;
+    secondTransaction.updateItemTransform(ids[2], translation(glm::vec3(30.0f)));
+    secondTransaction.updateItem<MovingItem>(ids[3], [](MovingItem& item) {
+        item.transform.setTranslation(glm::vec3(-10.0f));
+    });
+    firstTransaction.updateItemTransform(ids[3], translation(glm::vec3(40.0f)));
+    scene->enqueueTransaction(firstTransaction);
+    scene->enqueueTransaction(secondTransaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    QCOMPARE(items[0]->transform.getTranslation(), glm::vec3(10.0f));
+    QCOMPARE(items[1]->transform.getTranslation(), glm::vec3(20.0f));
+    QCOMPARE(items[1]->numTransformUpdates, 1);
+    QCOMPARE(items[2]->transform.getTranslation(), glm::vec3(30.0f));
+    QCOMPARE(items[3]->transform.getTranslation(), glm::vec3(-10.0f));
+    for (int i = 0; i < 4; ++i) {
+        QVERIFY(isInItsCell(scene, ids[i]));
+    }
+}
+
+void SceneTransactionTests::benchmarkTransformUpdates() {
+    auto scene = makeScene();
+    std::vector<MovingItemPointer> items;
+    auto ids = addItems(scene, items);
+
+    float offset = 0.0f;
+    QBENCHMARK {
+        offset += 1.0f;
+        render::Transaction transaction;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            transaction.updateItemTransform(ids[i], translation(glm::vec3((float)(i % 64), (float)(i / 64), offset)));
+        }
+        scene->enqueueTransaction(transaction);
+        scene->enqueueFrame();
+        scene->processTransactionQueue();
+    }
+}
+
+void SceneTransactionTests::benchmarkFunctorUpdates() {
+    auto scene = makeScene();
+    std::vector<MovingItemPointer> items;
+    auto ids = addItems(scene, items);
+
+    float offset = 0.0f;
+    QBENCHMARK {
+        offset += 1.0f;
+        render::Transaction transaction;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            auto transform = translation(glm::vec3((float)(i % 64), (float)(i / 64), offset));
+            transaction.updateItem<MovingItem>(ids[i], [transform](MovingItem& item) {
+                item.transform = transform;
+            });
+        }
+        scene->enqueueTransaction(transaction);
+        scene->enqueueFrame();
+        scene->processTransactionQueue();
+    }
+}
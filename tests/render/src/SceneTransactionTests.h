@@ -0,0 +1,28 @@
+//
+//  SceneTransactionTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_SceneTransactionTests_h
+#define hifi_render_SceneTransactionTests_h
+
+#include <QtTest/QtTest>
+
+class SceneTransactionTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testTransformUpdatesCoalesce();
+    void testMixedUpdates();
+    void testUpdatesKeepSubmissionOrder();
+
+    void benchmarkTransformUpdates();
+    void benchmarkFunctorUpdates();
+};
+
+#endif // hifi_render_SceneTransactionTests_h
@@ -0,0 +1,159 @@
+//
+//  ScriptConverterTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ScriptConverterTests.h"
+
+#include <chrono>
+#include <functional>
+
+#include <QtScript/QScriptEngine>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <RegisteredMetaTypes.h>
+
+QTEST_MAIN(ScriptConverterTests)
+
+const int NUM_PERF_CALLS = 200000;
+
+static void reportCallsPerSecond(const char* name, const std::function<void()>& call) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < NUM_PERF_CALLS; ++i) {
+        call();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    qDebug() << name << (int)(NUM_PERF_CALLS / elapsed) << "calls/s";
+}
+
+void ScriptConverterTests::testVec3RoundTrip() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    const glm::vec3 VEC(1.5f, -2.25f, 1000.0f);
+    QScriptValue value = vec3ToScriptValue(&engine, VEC);
+    QCOMPARE(value.property("x").toNumber(), 1.5);
+    QCOMPARE(value.property("z").toNumber(), 1000.0);
+    // the prototype's accessors still forward to the components
+    QCOMPARE(value.property("green").toNumber(), -2.25);
+    QCOMPARE(engine.evaluate("(function(v) { return v[2]; })").call(QScriptValue(), { value }).toNumber(), 1000.0);
+
+    glm::vec3 result;
+    vec3FromScriptValue(value, result);
+    QCOMPARE(result, VEC);
+
+    // a second conversion reuses the prototype made for the first
+    QScriptValue other = vec3ToScriptValue(&engine, glm::vec3(0.0f));
+    QVERIFY(other.prototype().strictlyEquals(value.prototype()));
+}
+
+void ScriptConverterTests::testVec3Fallbacks() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    glm::vec3 result;
+    vec3FromScriptValue(engine.evaluate("({ red: 1, g: 2, z: 3 })"), result);
+    QCOMPARE(result, glm::vec3(1.0f, 2.0f, 3.0f));
+
+    vec3FromScriptValue(engine.evaluate("[4, 5, 6]"), result);
+    QCOMPARE(result, glm::vec3(4.0f, 5.0f, 6.0f));
+
+    // components that are not numbers convert the way they always did
+    vec3FromScriptValue(engine.evaluate("({ x: '7', y: true })"), result);
+    QCOMPARE(result, glm::vec3(7.0f, 1.0f, 0.0f));
+
+    vec3FromScriptValue(engine.evaluate("2"), result);
+    QCOMPARE(result, glm::vec3(2.0f));
+
+    vec3FromScriptValue(QScriptValue(), result);
+    QCOMPARE(result, glm::vec3(0.0f));
+}
+
+void ScriptConverterTests::testQuatRoundTrip() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    const glm::quat QUAT = glm::angleAxis(0.5f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+    glm::quat result;
+    quatFromScriptValue(quatToScriptValue(&engine, QUAT), result);
+    const float EPSILON = 0.00001f;
+    QVERIFY(fabsf(glm::dot(result, QUAT)) > 1.0f - EPSILON);
+
+    // unnormalized input is normalized, and nothing usable becomes the identity
+    quatFromScriptValue(engine.evaluate("({ x: 0, y: 0, z: 0, w: 2 })"), result);
+    QCOMPARE(result, glm::quat());
+    quatFromScriptValue(engine.evaluate("({})"), result);
+    QCOMPARE(result, glm::quat());
+}
+
+void ScriptConverterTests::testMat4RoundTrip() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    glm::mat4 mat4;
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            mat4[column][row] = (float)(column * 4 + row);
+        }
+    }
+    QScriptValue value = mat4toScriptValue(&engine, mat4);
+    QCOMPARE(value.property("r1c2").toNumber(), 9.0);
+    QCOMPARE(value.property("r3c0").toNumber(), 3.0);
+
+    glm::mat4 result;
+    mat4FromScriptValue(value, result);
+    QCOMPARE(result, mat4);
+}
+
+void ScriptConverterTests::testEnginesKeepTheirOwnNames() {
+    // engines come and go, the names cached for one must never be used with another
+    for (int i = 0; i < 3; ++i) {
+        QScriptEngine engine;
+        registerMetaTypes(&engine);
+
+        const glm::vec3 VEC((float)i, 2.0f, 3.0f);
+        glm::vec3 result;
+        vec3FromScriptValue(vec3ToScriptValue(&engine, VEC), result);
+        QCOMPARE(result, VEC);
+    }
+
+    QScriptEngine first;
+    QScriptEngine second;
+    glm::vec4 result;
+    vec4FromScriptValue(vec4toScriptValue(&first, glm::vec4(1.0f, 2.0f, 3.0f, 4.0f)), result);
+    QCOMPARE(result, glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+    vec4FromScriptValue(vec4toScriptValue(&second, glm::vec4(5.0f, 6.0f, 7.0f, 8.0f)), result);
+    QCOMPARE(result, glm::vec4(5.0f, 6.0f, 7.0f, 8.0f));
+    vec4FromScriptValue(vec4toScriptValue(&first, glm::vec4(9.0f)), result);
+    QCOMPARE(result, glm::vec4(9.0f));
+}
+
+void ScriptConverterTests::converterPerf() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    const glm::vec3 VEC(1.0f, 2.0f, 3.0f);
+    const glm::quat QUAT = glm::angleAxis(0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 MAT4 = glm::mat4_cast(QUAT);
+    QScriptValue vecValue = vec3ToScriptValue(&engine, VEC);
+    QScriptValue quatValue = quatToScriptValue(&engine, QUAT);
+    QScriptValue mat4Value = mat4toScriptValue(&engine, MAT4);
+
+    glm::vec3 vec;
+    glm::quat quat;
+    glm::mat4 mat4;
+    reportCallsPerSecond("vec3ToScriptValue", [&] { vec3ToScriptValue(&engine, VEC); });
+    reportCallsPerSecond("vec3FromScriptValue", [&] { vec3FromScriptValue(vecValue, vec); });
+    reportCallsPerSecond("quatToScriptValue", [&] { quatToScriptValue(&engine, QUAT); });
+    reportCallsPerSecond("quatFromScriptValue", [&] { quatFromScriptValue(quatValue, quat); });
+    reportCallsPerSecond("mat4toScriptValue", [&] { mat4toScriptValue(&engine, MAT4); });
+    reportCallsPerSecond("mat4FromScriptValue", [&] { mat4FromScriptValue(mat4Value, mat4); });
+    QCOMPARE(vec, VEC);
+    QCOMPARE(mat4, MAT4);
+}
@@ -0,0 +1,27 @@
+//
+//  ScriptConverterTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ScriptConverterTests_h
+#define hifi_ScriptConverterTests_h
+
+#include <QtTest/QtTest>
+
+class ScriptConverterTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testVec3RoundTrip();
+    void testVec3Fallbacks();
+    void testQuatRoundTrip();
+    void testMat4RoundTrip();
+    void testEnginesKeepTheirOwnNames();
+    void converterPerf();
+};
+
+#endif // hifi_ScriptConverterTests_h
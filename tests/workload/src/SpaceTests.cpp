@@ -1,6 +1,6 @@
 //
 //  SpaceTests.cpp
-//  tests/physics/src
+//  tests/workload/src
 //
 //  Created by Andrew Meadows on 2017.01.26
 //  Copyright 2017 High Fidelity, Inc.
@@ -17,35 +17,73 @@
 #include <StreamUtils.h>
 #include <SharedUtil.h>
 
+QTEST_MAIN(SpaceTests)
 
-const float INV_SQRT_3 = 1.0f / sqrtf(3.0f);
+using Changes = std::vector<workload::Space::Change>;
 
-QTEST_MAIN(SpaceTests)
+static workload::View makeView(const glm::vec3& center, float near, float mid, float far) {
+    workload::View view;
+    view.origin = center;
+    view.regions[workload::Region::R1] = workload::Sphere(center, near);
+    view.regions[workload::Region::R2] = workload::Sphere(center, mid);
+    view.regions[workload::Region::R3] = workload::Sphere(center, far);
+    return view;
+}
+
+static void processTransaction(workload::Space& space, const workload::Transaction& transaction) {
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+}
+
+// the region each proxy would be in when checked against every view region, the way the space used to do it
+static uint8_t bruteForceRegion(const workload::Sphere& sphere, const workload::Views& views) {
+    uint8_t region = workload::Region::R4;
+    for (const auto& view : views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = sphere.w + view.regions[k].w;
+            if (distance2(glm::vec3(sphere), glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
 
 void SpaceTests::testOverlaps() {
     workload::Space space;
-    using Changes = std::vector<workload::Space::Change>;
-    using Views = std::vector<workload::Space::View>;
 
     glm::vec3 viewCenter(0.0f, 0.0f, 0.0f);
     float near = 1.0f;
     float mid = 2.0f;
     float far = 3.0f;
 
-    Views views;
-    views.push_back(workload::Space::View(viewCenter, near, mid, far));
+    workload::Views views;
+    views.push_back(makeView(viewCenter, near, mid, far));
     space.setViews(views);
 
-    int32_t proxyId = 0;
+    int32_t proxyId = space.allocateID();
     const float DELTA = 0.001f;
     float proxyRadius = 0.5f;
     glm::vec3 proxyPosition = viewCenter + glm::vec3(0.0f, 0.0f, far + proxyRadius + DELTA);
-    workload::Space::Sphere proxySphere(proxyPosition, proxyRadius);
+    workload::Sphere proxySphere(proxyPosition, proxyRadius);
 
     { // create very_far proxy
-        proxyId = space.createProxy(proxySphere);
+        workload::Transaction transaction;
+        transaction.reset(proxyId, proxySphere, workload::Owner());
+        processTransaction(space, transaction);
         QVERIFY(space.getNumObjects() == 1);
 
+        Changes changes;
+        space.categorizeAndGetChanges(changes);
+        QVERIFY(changes.size() == 1);
+        QVERIFY(changes[0].proxyId == proxyId);
+        QVERIFY(changes[0].region == workload::Region::R4);
+        QVERIFY(changes[0].prevRegion == workload::Region::UNKNOWN);
+    }
+
+    { // nothing moved
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 0);
@@ -54,53 +92,61 @@ void SpaceTests::testOverlaps() {
     { // move proxy far
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, far + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_FAR);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_UNKNOWN);
+        QVERIFY(changes[0].region == workload::Region::R3);
+        QVERIFY(changes[0].prevRegion == workload::Region::R4);
     }
 
     { // move proxy mid
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, mid + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_MIDDLE);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_FAR);
+        QVERIFY(changes[0].region == workload::Region::R2);
+        QVERIFY(changes[0].prevRegion == workload::Region::R3);
     }
 
     { // move proxy near
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, near + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
+        Changes changes;
+        space.categorizeAndGetChanges(changes);
+        QVERIFY(changes.size() == 1);
+        QVERIFY(changes[0].proxyId == proxyId);
+        QVERIFY(changes[0].region == workload::Region::R1);
+        QVERIFY(changes[0].prevRegion == workload::Region::R2);
+    }
+
+    { // move the view away instead
+        views[0] = makeView(viewCenter + glm::vec3(0.0f, 0.0f, -10.0f * far), near, mid, far);
+        space.setViews(views);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_NEAR);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_MIDDLE);
+        QVERIFY(changes[0].region == workload::Region::R4);
+        QVERIFY(changes[0].prevRegion == workload::Region::R1);
     }
 
     { // delete proxy
         // NOTE: atm deleting a proxy doesn't result in a "Change"
-        std::vector<int32_t> deadProxies;
-        deadProxies.push_back(proxyId);
-        space.deleteProxies(deadProxies);
+        workload::Transaction transaction;
+        transaction.remove(proxyId);
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 0);
@@ -108,8 +154,6 @@ void SpaceTests::testOverlaps() {
     }
 }
 
-#ifdef MANUAL_TEST
-
 const float WORLD_WIDTH = 1000.0f;
 const float MIN_RADIUS = 1.0f;
 const float MAX_RADIUS = 100.0f;
@@ -123,126 +167,149 @@ glm::vec3 randomVec3() {
     return v;
 }
 
-void generateSpheres(uint32_t numProxies, std::vector<workload::Space::Sphere>& spheres) {
+void generateSpheres(uint32_t numProxies, std::vector<workload::Sphere>& spheres) {
     spheres.reserve(numProxies);
     for (uint32_t i = 0; i < numProxies; ++i) {
-        workload::Space::Sphere sphere(
-                WORLD_WIDTH * randomFloat(),
-                WORLD_WIDTH * randomFloat(),
-                WORLD_WIDTH * randomFloat(),
-                (MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS)) * randomFloat());
-        spheres.push_back(sphere);
+        // mostly small, as entities are, with a few too big for the space's grid
+        float radius = MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS) * powf(0.5f * (randomFloat() + 1.0f), 8.0f);
+        spheres.push_back(workload::Sphere(WORLD_WIDTH * randomVec3(), radius));
     }
 }
 
-void generatePositions(uint32_t numProxies, std::vector<glm::vec3>& positions) {
-    positions.reserve(numProxies);
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        positions.push_back(WORLD_WIDTH * randomVec3());
-    }
+workload::Views generateViews(const glm::vec3& offset) {
+    workload::Views views;
+    views.push_back(makeView(offset, 0.05f * WORLD_WIDTH, 0.1f * WORLD_WIDTH, 0.2f * WORLD_WIDTH));
+    views.push_back(makeView(offset + glm::vec3(0.0f, 0.0f, 0.3f * WORLD_WIDTH),
+                             0.05f * WORLD_WIDTH, 0.1f * WORLD_WIDTH, 0.2f * WORLD_WIDTH));
+    return views;
 }
 
-void generateRadiuses(uint32_t numRadiuses, std::vector<float>& radiuses) {
-    radiuses.reserve(numRadiuses);
-    for (uint32_t i = 0; i < numRadiuses; ++i) {
-        radiuses.push_back(MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS) * randomFloat());
+void SpaceTests::testCategorizeMatchesBruteForce() {
+    srand(1);
+    // enough proxies for the categorizing to be spread over threads
+    const uint32_t numProxies = 4 * workload::Space::MIN_PARALLEL_PROXIES;
+    workload::Space space;
+    std::vector<workload::Sphere> spheres;
+    generateSpheres(numProxies, spheres);
+    std::vector<int32_t> proxyIds;
+    std::vector<uint8_t> regions(numProxies, workload::Region::UNKNOWN);
+    {
+        workload::Transaction transaction;
+        for (uint32_t i = 0; i < numProxies; ++i) {
+            proxyIds.push_back(space.allocateID());
+            transaction.reset(proxyIds[i], spheres[i], workload::Owner());
+        }
+        processTransaction(space, transaction);
+    }
+
+    const uint32_t NUM_FRAMES = 12;
+    for (uint32_t frame = 0; frame < NUM_FRAMES; ++frame) {
+        // the views hold still for a few frames in the middle
+        float viewStep = (frame >= 4 && frame < 8) ? 4.0f : (float)frame;
+        workload::Views views = generateViews(glm::vec3(0.01f * WORLD_WIDTH * viewStep, 0.0f, 0.0f));
+        space.setViews(views);
+
+        workload::Transaction transaction;
+        for (uint32_t i = frame % 10; i < numProxies; i += 10) {
+            spheres[i] += workload::Sphere(0.01f * WORLD_WIDTH * randomVec3(), 0.0f);
+            transaction.update(proxyIds[i], spheres[i]);
+        }
+        processTransaction(space, transaction);
+
+        Changes changes;
+        space.categorizeAndGetChanges(changes);
+        for (const auto& change : changes) {
+            QCOMPARE(change.prevRegion, regions[change.proxyId]);
+            QVERIFY(change.region != change.prevRegion);
+            regions[change.proxyId] = change.region;
+        }
+        for (uint32_t i = 0; i < numProxies; ++i) {
+            uint8_t region = bruteForceRegion(spheres[i], views);
+            QCOMPARE(regions[proxyIds[i]], region);
+            QCOMPARE(space.getRegion(proxyIds[i]), region);
+        }
     }
 }
 
+#ifdef MANUAL_TEST
+
 void SpaceTests::benchmark() {
-    uint32_t numProxies[] = { 100, 1000, 10000, 100000 };
+    uint32_t numProxies[] = { 1000, 10000, 100000, 200000 };
     uint32_t numTests = 4;
+    const uint32_t NUM_FRAMES = 20;
     std::vector<uint64_t> timeToAddAll;
+    std::vector<uint64_t> timeToCategorizeAll;
     std::vector<uint64_t> timeToMoveView;
     std::vector<uint64_t> timeToMoveProxies;
     std::vector<uint64_t> timeToRemoveAll;
     for (uint32_t i = 0; i < numTests; ++i) {
 
         workload::Space space;
-
-        { // build the views
-            std::vector<glm::vec3> viewPositions;
-            viewPositions.push_back(glm::vec3(0.0f, 0.0f, 0.0f));
-            viewPositions.push_back(glm::vec3(0.0f, 0.0f, 0.1f * WORLD_WIDTH));
-            float radius0 = 0.25f * WORLD_WIDTH;
-            float radius1 = 0.50f * WORLD_WIDTH;
-            float radius2 = 0.75f * WORLD_WIDTH;
-            std::vector<workload::Space::View> views;
-            views.push_back(workload::Space::View(viewPositions[0], radius0, radius1, radius2));
-            views.push_back(workload::Space::View(viewPositions[1], radius0, radius1, radius2));
-            space.setViews(views);
-        }
+        space.setViews(generateViews(glm::vec3(0.0f)));
 
         // build the proxies
         uint32_t n = numProxies[i];
-        std::vector<workload::Space::Sphere> proxySpheres;
+        std::vector<workload::Sphere> proxySpheres;
         generateSpheres(n, proxySpheres);
         std::vector<int32_t> proxyKeys;
         proxyKeys.reserve(n);
 
         // measure time to put proxies in the space
         uint64_t startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < n; ++j) {
-            int32_t key = space.createProxy(proxySpheres[j]);
-            proxyKeys.push_back(key);
+        {
+            workload::Transaction transaction;
+            for (uint32_t j = 0; j < n; ++j) {
+                int32_t key = space.allocateID();
+                transaction.reset(key, proxySpheres[j], workload::Owner());
+                proxyKeys.push_back(key);
+            }
+            processTransaction(space, transaction);
         }
         uint64_t usec = usecTimestampNow() - startTime;
         timeToAddAll.push_back(usec);
 
-        {
-            // build the views
-            std::vector<glm::vec3> viewPositions;
-            viewPositions.push_back(glm::vec3(1.0f, 2.0f, 3.0f));
-            viewPositions.push_back(glm::vec3(1.0f, 2.0f, 3.0f + 0.1f * WORLD_WIDTH));
-            float radius0 = 0.25f * WORLD_WIDTH;
-            float radius1 = 0.50f * WORLD_WIDTH;
-            float radius2 = 0.75f * WORLD_WIDTH;
-            std::vector<workload::Space::View> views;
-            views.push_back(workload::Space::View(viewPositions[0], radius0, radius1, radius2));
-            views.push_back(workload::Space::View(viewPositions[1], radius0, radius1, radius2));
-            space.setViews(views);
-        }
-
-        // measure time to categorizeAndGetChanges everything
-        std::vector<workload::Space::Change> changes;
+        // measure time to categorize everything the first time
+        Changes changes;
         startTime = usecTimestampNow();
         space.categorizeAndGetChanges(changes);
         usec = usecTimestampNow() - startTime;
+        timeToCategorizeAll.push_back(usec);
+
+        // measure time per frame to categorize with the views walking along
+        startTime = usecTimestampNow();
+        for (uint32_t frame = 1; frame <= NUM_FRAMES; ++frame) {
+            space.setViews(generateViews(glm::vec3(0.5f * frame, 0.0f, 0.0f)));
+            changes.clear();
+            space.categorizeAndGetChanges(changes);
+        }
+        usec = (usecTimestampNow() - startTime) / NUM_FRAMES;
         timeToMoveView.push_back(usec);
 
-        // move every 10th proxy around
+        // measure time per frame to move every 100th proxy around and categorize, with the views still moving
         const float proxySpeed = 1.0f;
-        std::vector<workload::Space::Sphere> newSpheres;
-        uint32_t numMovingProxies = n / 10;
-        uint32_t jstep = n / numMovingProxies;
-        uint32_t maxJ = numMovingProxies * jstep - 1;
-        glm::vec3 direction;
-        for (uint32_t j = 0; j < maxJ - jstep; j += jstep) {
-            glm::vec3 position = (glm::vec3)proxySpheres[j];
-            glm::vec3 destination = (glm::vec3)proxySpheres[j + jstep];
-            direction = glm::normalize(destination - position);
-            glm::vec3 newPosition = position + proxySpeed * direction;
-            newSpheres.push_back(workload::Space::Sphere(newPosition, proxySpheres[j].w));
-        }
-        glm::vec3 position = (glm::vec3)proxySpheres[maxJ = jstep];
-        glm::vec3 destination = (glm::vec3)proxySpheres[0];
-        direction = glm::normalize(destination - position);
-        direction = position + proxySpeed * direction;
-        newSpheres.push_back(workload::Space::Sphere(direction, proxySpheres[0].w));
-        uint32_t k = 0;
         startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < maxJ; j += jstep) {
-            space.updateProxy(proxyKeys[j], newSpheres[k++]);
+        for (uint32_t frame = 1; frame <= NUM_FRAMES; ++frame) {
+            space.setViews(generateViews(glm::vec3(0.5f * (NUM_FRAMES + frame), 0.0f, 0.0f)));
+            workload::Transaction transaction;
+            for (uint32_t j = frame % 100; j < n; j += 100) {
+                proxySpheres[j] += workload::Sphere(proxySpeed * randomVec3(), 0.0f);
+                transaction.update(proxyKeys[j], proxySpheres[j]);
+            }
+            processTransaction(space, transaction);
+            changes.clear();
+            space.categorizeAndGetChanges(changes);
         }
-        changes.clear();
-        space.categorizeAndGetChanges(changes);
-        usec = usecTimestampNow() - startTime;
+        usec = (usecTimestampNow() - startTime) / NUM_FRAMES;
         timeToMoveProxies.push_back(usec);
 
         // measure time to remove proxies from space
         startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < n; ++j) {
-            space.deleteProxy(proxyKeys[j]);
+        {
+            workload::Transaction transaction;
+            for (uint32_t j = 0; j < n; ++j) {
+                transaction.remove(proxyKeys[j]);
+            }
+            processTransaction(space, transaction);
         }
         usec = usecTimestampNow() - startTime;
         timeToRemoveAll.push_back(usec);
@@ -255,6 +322,13 @@ void SpaceTests::benchmark() {
     }
     std::cout << "];" << std::endl;
 
+    std::cout << "[numProxies, timeToCategorizeAll] = [" << std::endl;
+    for (uint32_t i = 0; i < timeToCategorizeAll.size(); ++i) {
+        uint32_t n = numProxies[i];
+        std::cout << "    " << n << ", " << timeToCategorizeAll[i] << std::endl;
+    }
+    std::cout << "];" << std::endl;
+
     std::cout << "[numProxies, timeToMoveView] = [" << std::endl;
     for (uint32_t i = 0; i < timeToMoveView.size(); ++i) {
         uint32_t n = numProxies[i];
@@ -265,7 +339,7 @@ void SpaceTests::benchmark() {
     std::cout << "[numProxies, timeToMoveProxies] = [" << std::endl;
     for (uint32_t i = 0; i < timeToMoveProxies.size(); ++i) {
         uint32_t n = numProxies[i];
-        std::cout << "    " << n << "/10, " << timeToMoveProxies[i] << std::endl;
+        std::cout << "    " << n << "/100, " << timeToMoveProxies[i] << std::endl;
     }
     std::cout << "];" << std::endl;
 
@@ -1,6 +1,6 @@
 //
 //  SpaceTests.h
-//  tests/physics/src
+//  tests/workload/src
 //
 //  Created by Andrew Meadows on 2017.01.26
 //  Copyright 2017 High Fidelity, Inc.
@@ -21,6 +21,7 @@ class SpaceTests : public QObject {
 
 private slots:
     void testOverlaps();
+    void testCategorizeMatchesBruteForce();
 #ifdef MANUAL_TEST
     void benchmark();
 #endif // MANUAL_TEST
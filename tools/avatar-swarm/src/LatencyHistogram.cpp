@@ -0,0 +1,60 @@
+//
+//  LatencyHistogram.cpp
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+
+LatencyHistogram::LatencyHistogram() :
+    _buckets(NUM_BUCKETS + 1, 0)
+{
+}
+
+void LatencyHistogram::add(quint64 usecs) {
+    size_t bucket = std::min((size_t)(usecs / BUCKET_USECS), (size_t)NUM_BUCKETS);
+    ++_buckets[bucket];
+    ++_count;
+    _sum += usecs;
+    _max = std::max(_max, usecs);
+}
+
+void LatencyHistogram::reset() {
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _count = 0;
+    _sum = 0;
+    _max = 0;
+}
+
+quint64 LatencyHistogram::getPercentile(float fraction) const {
+    if (_count == 0) {
+        return 0;
+    }
+
+    quint64 target = std::max((quint64)1, (quint64)(fraction * (float)_count + 0.5f));
+    quint64 seen = 0;
+    for (size_t i = 0; i < (size_t)NUM_BUCKETS; ++i) {
+        seen += _buckets[i];
+        if (seen >= target) {
+            return std::min((quint64)(i + 1) * BUCKET_USECS, _max);
+        }
+    }
+    return _max;
+}
+
+QJsonObject LatencyHistogram::toJson() const {
+    QJsonObject result;
+    result["count"] = (qint64)_count;
+    result["mean"] = getMean();
+    result["p50"] = (qint64)getPercentile(0.50f);
+    result["p95"] = (qint64)getPercentile(0.95f);
+    result["p99"] = (qint64)getPercentile(0.99f);
+    result["max"] = (qint64)_max;
+    return result;
+}
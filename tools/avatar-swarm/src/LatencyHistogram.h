@@ -0,0 +1,47 @@
+//
+//  LatencyHistogram.h
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LatencyHistogram_h
+#define hifi_LatencyHistogram_h
+
+#include <vector>
+
+#include <QJsonObject>
+
+// microsecond samples in fixed 100us buckets up to one second, so a long run with thousands of bots
+// keeps its percentiles in constant memory
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void add(quint64 usecs);
+    void reset();
+
+    quint64 getCount() const { return _count; }
+    quint64 getMax() const { return _max; }
+    double getMean() const { return _count > 0 ? (double)_sum / (double)_count : 0.0; }
+
+    // upper bound of the bucket holding the given fraction of the samples
+    quint64 getPercentile(float fraction) const;
+
+    // { count, mean, p50, p95, p99, max } in microseconds
+    QJsonObject toJson() const;
+
+private:
+    static const quint64 BUCKET_USECS = 100;
+    static const int NUM_BUCKETS = 10000;
+
+    std::vector<quint32> _buckets;  // the last bucket holds everything past a second
+    quint64 _count { 0 };
+    quint64 _sum { 0 };
+    quint64 _max { 0 };
+};
+
+#endif // hifi_LatencyHistogram_h
@@ -0,0 +1,227 @@
+//
+//  SwarmApp.cpp
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SwarmApp.h"
+
+#include <QCommandLineParser>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QTimer>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AvatarLogging.h>
+#include <BuildInfo.h>
+#include <DependencyManager.h>
+#include <NetworkLogging.h>
+#include <NodeList.h>
+#include <SharedLogging.h>
+#include <ShutdownEventListener.h>
+#include <plugins/PluginManager.h>
+
+#include "SwarmBot.h"
+#include "SwarmCoordinator.h"
+
+static void silence(const QLoggingCategory& category) {
+    const_cast<QLoggingCategory*>(&category)->setEnabled(QtDebugMsg, false);
+    const_cast<QLoggingCategory*>(&category)->setEnabled(QtInfoMsg, false);
+    const_cast<QLoggingCategory*>(&category)->setEnabled(QtWarningMsg, false);
+}
+
+SwarmApp::SwarmApp(int argc, char* argv[]) :
+    QCoreApplication(argc, argv)
+{
+#   ifndef WIN32
+    setvbuf(stdout, NULL, _IOLBF, 0);
+#   endif
+
+    // setup a shutdown event listener to handle SIGTERM or WM_CLOSE for us
+#   ifdef _WIN32
+    installNativeEventFilter(&ShutdownEventListener::getInstance());
+#   else
+    ShutdownEventListener::getInstance();
+#   endif
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Tivoli Cloud VR avatar swarm load generator");
+
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption verboseOutput("v", "verbose output");
+    parser.addOption(verboseOutput);
+
+    const QCommandLineOption domainAddressOption("d", "domain-server address", "address", "127.0.0.1:40103");
+    parser.addOption(domainAddressOption);
+
+    const QCommandLineOption numBotsOption("n", "number of avatars to simulate", "count", "100");
+    parser.addOption(numBotsOption);
+
+    const QCommandLineOption rampOption("ramp", "avatars to add per second", "rate", "20");
+    parser.addOption(rampOption);
+
+    const QCommandLineOption durationOption("duration", "seconds to run for", "seconds", "60");
+    parser.addOption(durationOption);
+
+    const QCommandLineOption progressOption("progress", "seconds between progress lines, 0 for none", "seconds", "5");
+    parser.addOption(progressOption);
+
+    const QCommandLineOption statsURLOption("stats-url",
+        "domain-server HTTP address to poll for mixer frame times, empty for none", "url", "http://127.0.0.1:40100");
+    parser.addOption(statsURLOption);
+
+    const QCommandLineOption reportOption("report", "write the final JSON report to this file", "path");
+    parser.addOption(reportOption);
+
+    const QCommandLineOption avatarURLOption("avatar", "avatar model URL", "url");
+    parser.addOption(avatarURLOption);
+
+    const QCommandLineOption recordingOption("recording", "recording (.hfr) each avatar plays in a loop", "path");
+    parser.addOption(recordingOption);
+
+    const QCommandLineOption audioOption("audio", "raw 24kHz mono 16 bit PCM each avatar talks with", "path");
+    parser.addOption(audioOption);
+
+    const QCommandLineOption codecOption("codec", "audio codec to negotiate, PCM if not given", "name");
+    parser.addOption(codecOption);
+
+    const QCommandLineOption spreadOption("spread", "side in meters of the square avatars spawn in", "meters", "20");
+    parser.addOption(spreadOption);
+
+    const QCommandLineOption talkRatioOption("talk-ratio", "fraction of the time each avatar talks", "ratio", "0.25");
+    parser.addOption(talkRatioOption);
+
+    const QCommandLineOption queryRateOption("query-rate", "entity queries per second", "rate", "0.5");
+    parser.addOption(queryRateOption);
+
+    const QCommandLineOption pingRateOption("ping-rate", "pings per second to each server", "rate", "10");
+    parser.addOption(pingRateOption);
+
+    const QCommandLineOption botOption("bot", "run as the bot with this index (used by the swarm itself)", "index");
+    parser.addOption(botOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << endl;
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    _verbose = parser.isSet(verboseOutput);
+
+    if (parser.isSet(botOption)) {
+        if (!_verbose) {
+            QLoggingCategory::setFilterRules("qt.network.ssl.warning=false");
+            silence(networking());
+            silence(shared());
+            silence(avatars());
+        }
+
+        SwarmBotConfig config;
+        config.index = parser.value(botOption).toInt();
+        config.domainAddress = parser.value(domainAddressOption);
+        config.avatarURL = QUrl(parser.value(avatarURLOption));
+        config.recordingPath = parser.value(recordingOption);
+        config.audioPath = parser.value(audioOption);
+        config.codecName = parser.value(codecOption);
+        config.spread = parser.value(spreadOption).toFloat();
+        config.talkRatio = parser.value(talkRatioOption).toFloat();
+        config.queryRate = parser.value(queryRateOption).toFloat();
+        config.pingRate = parser.value(pingRateOption).toInt();
+        setupBot(config);
+        return;
+    }
+
+    SwarmCoordinatorConfig config;
+    config.numBots = parser.value(numBotsOption).toInt();
+    config.rampRate = parser.value(rampOption).toFloat();
+    config.durationSecs = parser.value(durationOption).toInt();
+    config.progressIntervalSecs = parser.value(progressOption).toInt();
+    config.statsURL = QUrl(parser.value(statsURLOption));
+    config.reportPath = parser.value(reportOption);
+    config.verbose = _verbose;
+    // the bots parse the same options, and ignore the ones that are only ours
+    config.botArguments = QCoreApplication::arguments().mid(1);
+
+    _coordinator = new SwarmCoordinator(config, this);
+    connect(_coordinator, &SwarmCoordinator::finished, this, [](int exitCode) {
+        QCoreApplication::exit(exitCode);
+    });
+}
+
+SwarmApp::~SwarmApp() {
+}
+
+void SwarmApp::setupBot(const SwarmBotConfig& config) {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+
+    DependencyManager::set<AccountManager>(false, [&]{
+        return QString(
+            "TivoliCloudVR/" +
+            (BuildInfo::BUILD_TYPE == BuildInfo::BuildType::Stable ? BuildInfo::VERSION : "dev")
+        );
+    });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent, config.listenPort);
+
+    auto accountManager = DependencyManager::get<AccountManager>();
+    accountManager->setIsAgent(true);
+
+    if (!config.codecName.isEmpty()) {
+        // only load codec plugins, the same way the audio-mixer does
+        auto pluginManager = DependencyManager::set<PluginManager>();
+        pluginManager->setPluginFilter([](const QJsonObject& metaData) {
+            QJsonValue nameValue = metaData["MetaData"]["name"];
+            return nameValue.toString().contains("codec", Qt::CaseInsensitive);
+        });
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // setup a timer for domain-server check ins
+    QTimer* domainCheckInTimer = new QTimer(nodeList.data());
+    connect(domainCheckInTimer, &QTimer::timeout, nodeList.data(), &NodeList::sendDomainServerCheckIn);
+    domainCheckInTimer->start(DOMAIN_SERVER_CHECK_IN_MSECS);
+
+    // start the nodeThread so its event loop is running
+    // (must happen after the checkin timer is created with the nodelist as it's parent)
+    nodeList->startThread();
+
+    nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer
+                                                 << NodeType::EntityServer << NodeType::MessagesMixer);
+
+    _bot = new SwarmBot(config, this);
+    connect(this, &QCoreApplication::aboutToQuit, this, &SwarmApp::finishBot);
+
+    DependencyManager::get<AddressManager>()->handleLookupString(config.domainAddress, false);
+}
+
+void SwarmApp::finishBot() {
+    _bot->stop();
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // send the domain a disconnect packet, force stoppage of domain-server check-ins
+    nodeList->getDomainHandler().disconnect("Finishing");
+    nodeList->setIsShuttingDown(true);
+
+    // tell the packet receiver we're shutting down, so it can drop packets
+    nodeList->getPacketReceiver().setShouldDropPackets(true);
+
+    delete _bot;
+    _bot = nullptr;
+
+    // remove the NodeList from the DependencyManager
+    DependencyManager::destroy<NodeList>();
+}
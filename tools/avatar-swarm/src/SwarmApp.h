@@ -0,0 +1,37 @@
+//
+//  SwarmApp.h
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SwarmApp_h
+#define hifi_SwarmApp_h
+
+#include <QCoreApplication>
+
+class SwarmBot;
+class SwarmCoordinator;
+struct SwarmBotConfig;
+
+// Every simulated avatar needs a NodeList, and so a process, of its own: run without --bot this launches
+// and watches the swarm, with --bot it is one member of it.
+class SwarmApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    SwarmApp(int argc, char* argv[]);
+    ~SwarmApp();
+
+private:
+    void setupBot(const SwarmBotConfig& config);
+    void finishBot();
+
+    bool _verbose { false };
+    SwarmBot* _bot { nullptr };
+    SwarmCoordinator* _coordinator { nullptr };
+};
+
+#endif // hifi_SwarmApp_h
@@ -0,0 +1,574 @@
+//
+//  SwarmBot.cpp
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SwarmBot.h"
+
+#include <cstdio>
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <AbstractAudioInterface.h>
+#include <AudioConstants.h>
+#include <AudioStreamStats.h>
+#include <AvatarHashMap.h>
+#include <ClientTraitsHandler.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <PositionalAudioStream.h>
+#include <Transform.h>
+#include <ViewFrustum.h>
+#include <plugins/PluginManager.h>
+#include <recording/Clip.h>
+#include <recording/Frame.h>
+#include <shared/ConicalViewFrustum.h>
+
+static const quint64 PING_TIMEOUT_USECS = 2 * USECS_PER_SECOND;
+static const int REPORT_INTERVAL_MSECS = 1000;
+static const int AUDIO_TIMER_INTERVAL_MSECS = 5;
+static const int MAX_AUDIO_FRAMES_BEHIND = 10;
+static const int AVATAR_QUERY_INTERVAL_MSECS = 1000;
+
+// talking comes and goes in segments of this length, picked per bot so the swarm doesn't talk in unison
+static const quint64 TALK_SEGMENT_USECS = 4 * USECS_PER_SECOND;
+static const float TONE_FREQUENCY = 220.0f;
+static const float TONE_AMPLITUDE = 4000.0f;
+
+// walking in a circle around the spawn point when there is no clip to play
+static const float WALK_RADIUS = 2.0f;
+static const float WALK_ANGULAR_SPEED = 0.5f; // radians per second
+
+static const NodeSet LINKED_NODE_TYPES { NodeType::AudioMixer, NodeType::AvatarMixer,
+                                         NodeType::EntityServer, NodeType::MessagesMixer };
+
+static QString linkNameForNodeType(NodeType_t type) {
+    // the same name the domain-server reports this node type's stats under
+    QString name = NodeType::getNodeTypeName(type).toLower();
+    name.replace(' ', '-');
+    return name;
+}
+
+static float hashToUnit(quint32 value) {
+    value *= 2654435761u;
+    return (float)(value >> 8) / (float)(1 << 24);
+}
+
+SwarmAvatar::SwarmAvatar() {
+    _clientTraitsHandler.reset(new ClientTraitsHandler(this));
+}
+
+QByteArray SwarmAvatar::toByteArrayStateful(AvatarDataDetail dataDetail, bool dropFaceTracking) {
+    _globalPosition = getWorldPosition();
+    return AvatarData::toByteArrayStateful(dataDetail, dropFaceTracking);
+}
+
+int SwarmAvatar::sendAvatarDataPacket(bool sendAll) {
+    int bytesSent = 0;
+    if (getIdentityDataChanged()) {
+        bytesSent += sendIdentityPacket();
+    }
+    bytesSent += _clientTraitsHandler->sendChangedTraitsToMixer();
+    bytesSent += AvatarData::sendAvatarDataPacket(sendAll);
+    return bytesSent;
+}
+
+SwarmBot::SwarmBot(const SwarmBotConfig& config, QObject* parent) :
+    QObject(parent),
+    _config(config),
+    _octreeQuery(true)
+{
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    _avatar = QSharedPointer<SwarmAvatar>::create();
+    _avatar->setDisplayName(QString("swarm-%1").arg(_config.index));
+    _avatar->setSkeletonModelURL(_config.avatarURL);
+
+    // force lazy initialization of the head data, it is read by every packet
+    _avatar->getHeadOrientation();
+
+    _spawnPosition = glm::vec3((hashToUnit(2 * _config.index) - 0.5f) * _config.spread, 0.0f,
+                               (hashToUnit(2 * _config.index + 1) - 0.5f) * _config.spread);
+    _avatar->setWorldPosition(_spawnPosition);
+
+    connect(nodeList.data(), &NodeList::nodeActivated, this, &SwarmBot::nodeActivated);
+    connect(nodeList.data(), &NodeList::nodeKilled, this, &SwarmBot::nodeKilled);
+    connect(nodeList.data(), &NodeList::uuidChanged, this, &SwarmBot::sessionUUIDChanged);
+    connect(nodeList.data(), &NodeList::pingReplyReceived, this, &SwarmBot::pingReplyReceived);
+
+    auto& packetReceiver = nodeList->getPacketReceiver();
+    packetReceiver.registerListener(PacketType::SelectedAudioFormat, this, "handleSelectedAudioFormat");
+    packetReceiver.registerListenerForTypes({ PacketType::MixedAudio, PacketType::SilentAudioFrame },
+                                            this, "handleMixedAudio");
+    packetReceiver.registerListener(PacketType::AudioStreamStats, this, "handleAudioStreamStats");
+    packetReceiver.registerListenerForTypes({ PacketType::AudioEnvironment, PacketType::BulkAvatarData,
+                                              PacketType::AvatarIdentity, PacketType::BulkAvatarTraits,
+                                              PacketType::KillAvatar, PacketType::EntityData, PacketType::EntityErase,
+                                              PacketType::OctreeStats, PacketType::EntityQueryInitialResultsComplete },
+                                            this, "handleDownstreamPacket");
+
+    // recordings drive the avatar, and its audio if they have any
+    if (!_config.recordingPath.isEmpty()) {
+        auto clip = recording::Clip::fromFile(_config.recordingPath);
+        if (clip) {
+            using namespace recording;
+            static const FrameType AVATAR_FRAME_TYPE = Frame::registerFrameType(AvatarData::FRAME_NAME);
+            Frame::registerFrameHandler(AVATAR_FRAME_TYPE, [this](Frame::ConstPointer frame) {
+                AvatarData::fromFrame(frame->data, *_avatar);
+            });
+
+            static const FrameType AUDIO_FRAME_TYPE = Frame::registerFrameType(AudioConstants::getAudioFrameName());
+            Frame::registerFrameHandler(AUDIO_FRAME_TYPE, [this](Frame::ConstPointer frame) {
+                _clipHasAudio = true;
+                _recordedAudioFrames.push_back(frame->data);
+                if (_recordedAudioFrames.size() > MAX_AUDIO_FRAMES_BEHIND) {
+                    _recordedAudioFrames.pop_front();
+                }
+            });
+
+            _deck.queueClip(clip);
+            _deck.loop(true);
+            // start everyone at a different point in the clip
+            _deck.seek(hashToUnit(_config.index) * _deck.length());
+        } else {
+            qWarning() << "Could not load recording" << _config.recordingPath;
+        }
+    }
+
+    loadAudioFile();
+
+    QJsonObject queryFlags;
+    queryFlags["includeDescendants"] = true;
+    queryFlags["includeAncestors"] = true;
+    queryFlags["serverScripts"] = true;
+    QJsonObject queryJSONParameters;
+    queryJSONParameters["flags"] = queryFlags;
+    _octreeQuery.setJSONParameters(queryJSONParameters);
+
+    _avatarTimer.setInterval(MSECS_PER_SECOND / CLIENT_TO_AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
+    _avatarTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_avatarTimer, &QTimer::timeout, this, &SwarmBot::update);
+
+    _audioTimer.setInterval(AUDIO_TIMER_INTERVAL_MSECS);
+    _audioTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_audioTimer, &QTimer::timeout, this, &SwarmBot::sendAudio);
+
+    _queryTimer.setInterval(_config.queryRate > 0.0f ? (int)(MSECS_PER_SECOND / _config.queryRate) : 0);
+    connect(&_queryTimer, &QTimer::timeout, this, &SwarmBot::sendEntityQuery);
+
+    _pingTimer.setInterval(_config.pingRate > 0 ? MSECS_PER_SECOND / _config.pingRate : 0);
+    _pingTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_pingTimer, &QTimer::timeout, this, &SwarmBot::sendPings);
+
+    _reportTimer.setInterval(REPORT_INTERVAL_MSECS);
+    connect(&_reportTimer, &QTimer::timeout, this, &SwarmBot::report);
+
+    _startTime = usecTimestampNow();
+    _avatarTimer.start();
+    _audioTimer.start();
+    _reportTimer.start();
+    if (_config.queryRate > 0.0f) {
+        _queryTimer.start();
+    }
+    if (_config.pingRate > 0) {
+        _pingTimer.start();
+    }
+}
+
+SwarmBot::~SwarmBot() {
+    stop();
+}
+
+void SwarmBot::stop() {
+    _avatarTimer.stop();
+    _audioTimer.stop();
+    _queryTimer.stop();
+    _pingTimer.stop();
+    _reportTimer.stop();
+    _deck.stop();
+
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+        _encoder = nullptr;
+    }
+}
+
+void SwarmBot::nodeActivated(SharedNodePointer node) {
+    if (LINKED_NODE_TYPES.contains(node->getType())) {
+        _links[linkNameForNodeType(node->getType())] = Link();
+    }
+
+    if (node->getType() == NodeType::AudioMixer) {
+        _downstreamAudioStats.reset();
+        _upstreamAudioReceived = 0;
+        _upstreamAudioLost = 0;
+        negotiateAudioFormat();
+    } else if (node->getType() == NodeType::AvatarMixer) {
+        _avatar->markIdentityDataChanged();
+        if (_deck.length() > 0.0f && !_deck.isPlaying()) {
+            _avatar->setWorldPosition(_spawnPosition);
+            _avatar->setRecordingBasis();
+            _deck.play();
+        }
+    } else if (node->getType() == NodeType::EntityServer) {
+        _octreeQuery.incrementConnectionID();
+        sendEntityQuery();
+    }
+}
+
+void SwarmBot::nodeKilled(SharedNodePointer node) {
+    _links.erase(linkNameForNodeType(node->getType()));
+}
+
+void SwarmBot::sessionUUIDChanged(const QUuid& sessionUUID, const QUuid& oldUUID) {
+    _avatar->setSessionUUID(sessionUUID);
+}
+
+void SwarmBot::pingReplyReceived(SharedNodePointer sendingNode, quint64 originalTimestamp, quint64 pingUsecs) {
+    auto it = _links.find(linkNameForNodeType(sendingNode->getType()));
+    if (it == _links.end()) {
+        return;
+    }
+
+    // replies to the NodeList's own keep-alive pings aren't ours to count
+    Link& link = it->second;
+    if (link.pendingPings.erase(originalTimestamp) == 0) {
+        return;
+    }
+
+    link.rttSamples.append((qint64)pingUsecs);
+    if (link.lastRTT >= 0) {
+        float difference = (float)std::abs((qint64)pingUsecs - link.lastRTT);
+        link.jitter += (difference - link.jitter) / 16.0f;
+    }
+    link.lastRTT = (qint64)pingUsecs;
+}
+
+void SwarmBot::sendPings() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    quint64 now = usecTimestampNow();
+
+    nodeList->eachNode([&](const SharedNodePointer& node) {
+        auto it = _links.find(linkNameForNodeType(node->getType()));
+        if (it == _links.end() || !node->getActiveSocket()) {
+            return;
+        }
+        Link& link = it->second;
+
+        // anything unanswered by now is lost
+        while (!link.pendingPings.empty() && now - link.pendingPings.begin()->second > PING_TIMEOUT_USECS) {
+            link.pendingPings.erase(link.pendingPings.begin());
+            ++link.lost;
+        }
+
+        auto pingPacket = nodeList->constructPingPacket(node->getUUID());
+        quint64 timestamp;
+        memcpy(&timestamp, pingPacket->getPayload() + sizeof(PingType_t), sizeof(timestamp));
+        link.pendingPings[timestamp] = now;
+
+        nodeList->sendPacket(std::move(pingPacket), *node);
+    });
+}
+
+void SwarmBot::update() {
+    if (!_deck.isPlaying()) {
+        float elapsed = (float)(usecTimestampNow() - _startTime) / (float)USECS_PER_SECOND;
+        float angle = elapsed * WALK_ANGULAR_SPEED + hashToUnit(_config.index) * TWO_PI;
+        glm::vec3 offset = WALK_RADIUS * glm::vec3(cosf(angle), 0.0f, sinf(angle));
+        _avatar->setWorldPosition(_spawnPosition + offset);
+        // face along the circle
+        _avatar->setWorldOrientation(glm::angleAxis(-angle, Vectors::UNIT_Y));
+    }
+
+    _avatarBytesSent += _avatar->sendAvatarDataPacket();
+
+    quint64 now = usecTimestampNow();
+    if (now - _lastAvatarQueryTime >= AVATAR_QUERY_INTERVAL_MSECS * USECS_PER_MSEC) {
+        _lastAvatarQueryTime = now;
+        sendAvatarQuery();
+    }
+}
+
+static ConicalViewFrustum viewForAvatar(const AvatarData& avatar) {
+    ViewFrustum view;
+    view.setPosition(avatar.getWorldPosition());
+    view.setOrientation(avatar.getWorldOrientation());
+    view.setProjection(DEFAULT_FIELD_OF_VIEW_DEGREES, DEFAULT_ASPECT_RATIO, DEFAULT_NEAR_CLIP, DEFAULT_FAR_CLIP);
+    view.calculate();
+    return ConicalViewFrustum { view };
+}
+
+void SwarmBot::sendEntityQuery() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto entityServer = nodeList->soloNodeOfType(NodeType::EntityServer);
+    if (!entityServer || !entityServer->getActiveSocket()) {
+        return;
+    }
+
+    _octreeQuery.setConicalViews({ viewForAvatar(*_avatar) });
+
+    auto queryPacket = NLPacket::create(PacketType::EntityQuery);
+    auto packetData = reinterpret_cast<unsigned char*>(queryPacket->getPayload());
+    int packetSize = _octreeQuery.getBroadcastData(packetData);
+    queryPacket->setPayloadSize(packetSize);
+
+    _queryBytesSent += queryPacket->getWireSize();
+    nodeList->sendUnreliablePacket(*queryPacket, *entityServer);
+}
+
+void SwarmBot::sendAvatarQuery() {
+    auto avatarPacket = NLPacket::create(PacketType::AvatarQuery);
+    auto destinationBuffer = reinterpret_cast<unsigned char*>(avatarPacket->getPayload());
+    auto bufferStart = destinationBuffer;
+
+    uint8_t numFrustums = 1;
+    memcpy(destinationBuffer, &numFrustums, sizeof(numFrustums));
+    destinationBuffer += sizeof(numFrustums);
+    destinationBuffer += viewForAvatar(*_avatar).serialize(destinationBuffer);
+    avatarPacket->setPayloadSize(destinationBuffer - bufferStart);
+
+    _queryBytesSent += avatarPacket->getWireSize();
+    DependencyManager::get<NodeList>()->broadcastToNodes(std::move(avatarPacket), { NodeType::AvatarMixer });
+}
+
+void SwarmBot::negotiateAudioFormat() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto audioMixer = nodeList->soloNodeOfType(NodeType::AudioMixer);
+    if (!audioMixer) {
+        return;
+    }
+
+    QStringList codecNames;
+    auto pluginManager = PluginManager::getInstance();
+    if (pluginManager) {
+        for (auto& plugin : pluginManager->getCodecPlugins()) {
+            if (plugin->getName() == _config.codecName) {
+                codecNames << plugin->getName();
+            }
+        }
+        if (codecNames.isEmpty()) {
+            qWarning() << "Codec" << _config.codecName << "is not loaded, sending PCM";
+        }
+    }
+
+    auto negotiateFormatPacket = NLPacket::create(PacketType::NegotiateAudioFormat);
+    negotiateFormatPacket->writePrimitive((quint8)codecNames.size());
+    for (auto& codecName : codecNames) {
+        negotiateFormatPacket->writeString(codecName);
+    }
+    nodeList->sendPacket(std::move(negotiateFormatPacket), *audioMixer);
+}
+
+void SwarmBot::handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message) {
+    QString selectedCodecName = message->readString();
+    if (_selectedCodecName == selectedCodecName) {
+        return;
+    }
+    _selectedCodecName = selectedCodecName;
+
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+        _encoder = nullptr;
+        _codec = nullptr;
+    }
+
+    auto pluginManager = PluginManager::getInstance();
+    if (!pluginManager) {
+        return;
+    }
+    for (auto& plugin : pluginManager->getCodecPlugins()) {
+        if (_selectedCodecName == plugin->getName()) {
+            _codec = plugin;
+            _encoder = plugin->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
+            break;
+        }
+    }
+}
+
+void SwarmBot::loadAudioFile() {
+    if (_config.audioPath.isEmpty()) {
+        return;
+    }
+
+    QFile file(_config.audioPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not open audio file" << _config.audioPath;
+        return;
+    }
+
+    _audioFile = file.readAll();
+    // whole frames only
+    _audioFile.truncate(_audioFile.size() - _audioFile.size() % AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
+    _audioFileOffset = ((int)(hashToUnit(_config.index) * _audioFile.size()) /
+                        AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL) * AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL;
+}
+
+void SwarmBot::nextAudioFrame(QByteArray& frame, bool& isSilent) {
+    if (_clipHasAudio) {
+        isSilent = _recordedAudioFrames.empty();
+        if (!isSilent) {
+            frame = _recordedAudioFrames.front();
+            _recordedAudioFrames.pop_front();
+        }
+        return;
+    }
+
+    quint64 segment = (usecTimestampNow() - _startTime) / TALK_SEGMENT_USECS;
+    isSilent = hashToUnit((quint32)segment * 7919u + (quint32)_config.index) >= _config.talkRatio;
+    if (isSilent) {
+        return;
+    }
+
+    if (!_audioFile.isEmpty()) {
+        frame = _audioFile.mid(_audioFileOffset, AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
+        _audioFileOffset = (_audioFileOffset + AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL) % _audioFile.size();
+        return;
+    }
+
+    frame.resize(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
+    auto samples = reinterpret_cast<int16_t*>(frame.data());
+    const float PHASE_STEP = TWO_PI * TONE_FREQUENCY / (float)AudioConstants::SAMPLE_RATE;
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; ++i) {
+        samples[i] = (int16_t)(TONE_AMPLITUDE * sinf(_tonePhase));
+        _tonePhase = fmodf(_tonePhase + PHASE_STEP, TWO_PI);
+    }
+}
+
+void SwarmBot::sendAudio() {
+    // the timer only wakes us up, frames go out on the audio clock
+    quint64 now = usecTimestampNow();
+    if (_nextAudioFrameTime == 0 || now - _nextAudioFrameTime > MAX_AUDIO_FRAMES_BEHIND * AudioConstants::NETWORK_FRAME_USECS) {
+        _nextAudioFrameTime = now;
+    }
+
+    while (_nextAudioFrameTime <= now) {
+        sendAudioFrame();
+        _nextAudioFrameTime += AudioConstants::NETWORK_FRAME_USECS;
+    }
+}
+
+void SwarmBot::sendAudioFrame() {
+    QByteArray frame;
+    bool isSilent = true;
+    nextAudioFrame(frame, isSilent);
+
+    // the codec must be flushed with a frame of silence before we switch to silent packets
+    bool flush = isSilent && _wasTalking;
+    _wasTalking = !isSilent;
+    if (flush) {
+        frame = QByteArray(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL, 0);
+    }
+
+    float loudness = 0.0f;
+    QByteArray encodedBuffer;
+    if (!isSilent || flush) {
+        auto samples = reinterpret_cast<const int16_t*>(frame.constData());
+        int numSamples = frame.size() / AudioConstants::SAMPLE_SIZE;
+        int32_t sum = 0;
+        for (int i = 0; i < numSamples; ++i) {
+            sum += std::abs((int32_t)samples[i]);
+        }
+        loudness = numSamples > 0 ? (float)sum / numSamples : 0.0f;
+
+        if (_encoder) {
+            _encoder->encode(frame, encodedBuffer);
+        } else {
+            encodedBuffer = frame;
+        }
+    }
+    _avatar->setAudioLoudness(loudness);
+
+    Transform audioTransform;
+    audioTransform.setTranslation(_avatar->getWorldPosition());
+    audioTransform.setRotation(_avatar->getWorldOrientation());
+
+    auto packetType = isSilent && !flush ? PacketType::SilentAudioFrame : PacketType::MicrophoneAudioNoEcho;
+    AbstractAudioInterface::emitAudioPacket(encodedBuffer.data(), encodedBuffer.size(), _audioSequenceNumber, false,
+                                            audioTransform, _avatar->getWorldPosition(), glm::vec3(0),
+                                            packetType, _selectedCodecName);
+    ++_audioFramesSent;
+}
+
+void SwarmBot::handleMixedAudio(QSharedPointer<ReceivedMessage> message) {
+    _bytesReceived += message->getSize();
+
+    quint16 sequence;
+    message->readPrimitive(&sequence);
+    _downstreamAudioStats.sequenceNumberReceived(sequence);
+}
+
+void SwarmBot::handleAudioStreamStats(QSharedPointer<ReceivedMessage> message) {
+    _bytesReceived += message->getSize();
+
+    quint8 appendFlag;
+    message->readPrimitive(&appendFlag);
+    quint16 numStreamStats;
+    message->readPrimitive(&numStreamStats);
+
+    // the mixer's view of the stream we send it
+    AudioStreamStats streamStats;
+    for (quint16 i = 0; i < numStreamStats; i++) {
+        message->readPrimitive(&streamStats);
+        if (streamStats._streamType == PositionalAudioStream::Microphone) {
+            _upstreamAudioReceived = streamStats._packetStreamStats._received;
+            _upstreamAudioLost = streamStats._packetStreamStats._lost;
+        }
+    }
+}
+
+void SwarmBot::handleDownstreamPacket(QSharedPointer<ReceivedMessage> message) {
+    _bytesReceived += message->getSize();
+}
+
+void SwarmBot::report() {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    QJsonObject links;
+    for (auto& entry : _links) {
+        Link& link = entry.second;
+        QJsonObject linkJSON;
+        linkJSON["rtt"] = link.rttSamples;
+        linkJSON["lost"] = (qint64)link.lost;
+        linkJSON["jitter"] = (qint64)link.jitter;
+        links[entry.first] = linkJSON;
+
+        link.rttSamples = QJsonArray();
+        link.lost = 0;
+    }
+
+    QJsonObject audio;
+    audio["up_received"] = (qint64)_upstreamAudioReceived;
+    audio["up_lost"] = (qint64)_upstreamAudioLost;
+    audio["down_received"] = (qint64)_downstreamAudioStats.getReceived();
+    audio["down_lost"] = (qint64)_downstreamAudioStats.getLost();
+
+    QJsonObject sent;
+    sent["avatar_bytes"] = (qint64)_avatarBytesSent;
+    sent["audio_frames"] = (qint64)_audioFramesSent;
+    sent["query_bytes"] = (qint64)_queryBytesSent;
+
+    QJsonObject stats;
+    stats["bot"] = _config.index;
+    stats["connected"] = nodeList->getDomainHandler().isConnected();
+    stats["links"] = links;
+    stats["audio"] = audio;
+    stats["sent"] = sent;
+    stats["received_bytes"] = (qint64)_bytesReceived;
+
+    _avatarBytesSent = 0;
+    _audioFramesSent = 0;
+    _queryBytesSent = 0;
+    _bytesReceived = 0;
+
+    // one line per report, the coordinator ignores anything else we print
+    QByteArray line = "SWARM " + QJsonDocument(stats).toJson(QJsonDocument::Compact) + "\n";
+    fwrite(line.constData(), 1, line.size(), stdout);
+    fflush(stdout);
+}
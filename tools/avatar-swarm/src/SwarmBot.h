@@ -0,0 +1,139 @@
+//
+//  SwarmBot.h
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SwarmBot_h
+#define hifi_SwarmBot_h
+
+#include <map>
+
+#include <QJsonArray>
+#include <QObject>
+#include <QTimer>
+#include <QUrl>
+
+#include <AvatarData.h>
+#include <NodeList.h>
+#include <OctreeQuery.h>
+#include <ReceivedMessage.h>
+#include <SequenceNumberStats.h>
+#include <plugins/CodecPlugin.h>
+#include <recording/Deck.h>
+
+struct SwarmBotConfig {
+    int index { 0 };
+    QString domainAddress;
+    int listenPort { INVALID_PORT };
+    QUrl avatarURL;
+    QString recordingPath;  // .hfr clip, played in a loop relative to the bot's spawn point
+    QString audioPath;      // raw 24kHz mono 16 bit PCM, looped
+    QString codecName;      // codec to ask the audio-mixer for, PCM if empty or not loaded
+    float spread { 20.0f };     // meters, side of the square bots are spawned in
+    float talkRatio { 0.25f };  // fraction of the time a bot without audio frames in its clip is talking
+    float queryRate { 0.5f };   // entity queries per second
+    int pingRate { 10 };        // pings per second to each server
+};
+
+// the AvatarData we drive, packing its own global position the way the ScriptableAvatar does
+class SwarmAvatar : public AvatarData {
+    Q_OBJECT
+public:
+    SwarmAvatar();
+
+    QByteArray toByteArrayStateful(AvatarDataDetail dataDetail, bool dropFaceTracking = false) override;
+    int sendAvatarDataPacket(bool sendAll = false) override;
+};
+
+// one simulated user: avatar data, microphone audio, entity queries and pings to every server it is connected to,
+// with a line of JSON stats written to stdout every second for the coordinating process to aggregate
+class SwarmBot : public QObject {
+    Q_OBJECT
+public:
+    SwarmBot(const SwarmBotConfig& config, QObject* parent = nullptr);
+    ~SwarmBot();
+
+    void stop();
+
+private slots:
+    void nodeActivated(SharedNodePointer node);
+    void nodeKilled(SharedNodePointer node);
+    void sessionUUIDChanged(const QUuid& sessionUUID, const QUuid& oldUUID);
+    void pingReplyReceived(SharedNodePointer sendingNode, quint64 originalTimestamp, quint64 pingUsecs);
+
+    void handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message);
+    void handleMixedAudio(QSharedPointer<ReceivedMessage> message);
+    void handleAudioStreamStats(QSharedPointer<ReceivedMessage> message);
+    void handleDownstreamPacket(QSharedPointer<ReceivedMessage> message);
+
+private:
+    struct Link {
+        std::map<quint64, quint64> pendingPings;  // send timestamp -> usecTimestampNow() when sent
+        QJsonArray rttSamples;
+        quint32 lost { 0 };
+        qint64 lastRTT { -1 };
+        float jitter { 0.0f };  // RFC 3550 interarrival jitter over successive round trips
+    };
+
+    void update();
+    void sendAudio();
+    void sendAudioFrame();
+    void sendEntityQuery();
+    void sendAvatarQuery();
+    void sendPings();
+    void report();
+
+    void negotiateAudioFormat();
+    void loadAudioFile();
+    void nextAudioFrame(QByteArray& frame, bool& isSilent);
+
+    SwarmBotConfig _config;
+
+    QSharedPointer<SwarmAvatar> _avatar;
+    recording::Deck _deck;
+    glm::vec3 _spawnPosition;
+    quint64 _startTime { 0 };
+
+    QTimer _avatarTimer;
+    QTimer _audioTimer;
+    QTimer _queryTimer;
+    QTimer _pingTimer;
+    QTimer _reportTimer;
+
+    // audio
+    QString _selectedCodecName;
+    CodecPluginPointer _codec;
+    Encoder* _encoder { nullptr };
+    quint16 _audioSequenceNumber { 0 };
+    quint64 _nextAudioFrameTime { 0 };
+    QByteArray _audioFile;
+    int _audioFileOffset { 0 };
+    std::list<QByteArray> _recordedAudioFrames;
+    bool _clipHasAudio { false };
+    bool _wasTalking { false };
+    float _tonePhase { 0.0f };
+
+    SequenceNumberStats _downstreamAudioStats;
+    quint32 _upstreamAudioReceived { 0 };
+    quint32 _upstreamAudioLost { 0 };
+
+    // entity and avatar queries
+    OctreeQuery _octreeQuery;
+    quint64 _lastAvatarQueryTime { 0 };
+
+    // per server, keyed by the name the domain-server reports node stats under
+    std::map<QString, Link> _links;
+
+    // totals since the last report
+    quint64 _avatarBytesSent { 0 };
+    quint64 _audioFramesSent { 0 };
+    quint64 _queryBytesSent { 0 };
+    quint64 _bytesReceived { 0 };
+};
+
+#endif // hifi_SwarmBot_h
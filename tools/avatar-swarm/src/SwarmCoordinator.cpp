@@ -0,0 +1,329 @@
+//
+//  SwarmCoordinator.cpp
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SwarmCoordinator.h"
+
+#include <cstdio>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+#include <NetworkAccessManager.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+static const int STATS_POLL_INTERVAL_MSECS = 1000;
+static const int BOT_EXIT_TIMEOUT_MSECS = 5000;
+static const QByteArray BOT_STATS_PREFIX = "SWARM ";
+
+// the domain-server keeps the last stats each mixer sent it, which are averages over about a second of frames;
+// the time a frame took is the sum of the listed stats
+static const std::map<QString, std::vector<QStringList>> SERVER_FRAME_TIME_STATS {
+    { "audio-mixer", { { "avg_timing_stats", "us_per_frame" } } },
+    { "avatar-mixer", { { "parallelTasks", "processQueuedAvatarDataPackets", "1_total" },
+                        { "parallelTasks", "broadcastAvatarData", "1_total" } } }
+};
+
+static double ratio(quint64 part, quint64 whole) {
+    return whole > 0 ? (double)part / (double)whole : 0.0;
+}
+
+SwarmCoordinator::SwarmCoordinator(const SwarmCoordinatorConfig& config, QObject* parent) :
+    QObject(parent),
+    _config(config)
+{
+    _startTime = usecTimestampNow();
+
+    _launchTimer.setInterval(std::max(1, (int)(MSECS_PER_SECOND / std::max(_config.rampRate, 0.001f))));
+    connect(&_launchTimer, &QTimer::timeout, this, &SwarmCoordinator::launchNextBot);
+    _launchTimer.start();
+    launchNextBot();
+
+    if (_config.statsURL.isValid()) {
+        _statsTimer.setInterval(STATS_POLL_INTERVAL_MSECS);
+        connect(&_statsTimer, &QTimer::timeout, this, &SwarmCoordinator::pollServerStats);
+        _statsTimer.start();
+    }
+
+    if (_config.progressIntervalSecs > 0) {
+        _progressTimer.setInterval(_config.progressIntervalSecs * MSECS_PER_SECOND);
+        connect(&_progressTimer, &QTimer::timeout, this, &SwarmCoordinator::printProgress);
+        _progressTimer.start();
+    }
+
+    QTimer::singleShot(_config.durationSecs * MSECS_PER_SECOND, this, &SwarmCoordinator::finish);
+}
+
+SwarmCoordinator::~SwarmCoordinator() {
+    for (auto bot : _bots) {
+        if (bot->state() != QProcess::NotRunning) {
+            bot->kill();
+            bot->waitForFinished();
+        }
+    }
+}
+
+void SwarmCoordinator::launchNextBot() {
+    int index = (int)_bots.size();
+    if (index >= _config.numBots || _isFinishing) {
+        _launchTimer.stop();
+        return;
+    }
+
+    auto bot = new QProcess(this);
+    if (_config.verbose) {
+        bot->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    } else {
+        bot->setProcessChannelMode(QProcess::SeparateChannels);
+        bot->setStandardErrorFile(QProcess::nullDevice());
+    }
+    connect(bot, &QProcess::readyReadStandardOutput, this, [this, index] { readBotOutput(index); });
+    connect(bot, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+            this, [this, index](int exitCode, QProcess::ExitStatus exitStatus) {
+        _connectedBots.remove(index);
+        if (!_isFinishing) {
+            qWarning() << "Bot" << index << "exited with code" << exitCode;
+        }
+    });
+
+    _bots.push_back(bot);
+    bot->start(QCoreApplication::applicationFilePath(),
+               QStringList(_config.botArguments) << "--bot" << QString::number(index));
+}
+
+void SwarmCoordinator::readBotOutput(int index) {
+    auto bot = _bots[index];
+    while (bot->canReadLine()) {
+        QByteArray line = bot->readLine();
+        if (line.startsWith(BOT_STATS_PREFIX)) {
+            auto document = QJsonDocument::fromJson(line.mid(BOT_STATS_PREFIX.size()));
+            if (document.isObject()) {
+                processBotStats(document.object());
+            }
+        } else if (_config.verbose) {
+            fprintf(stdout, "[bot %d] %s", index, line.constData());
+        }
+    }
+}
+
+void SwarmCoordinator::processBotStats(const QJsonObject& stats) {
+    int index = stats["bot"].toInt();
+
+    if (stats["connected"].toBool()) {
+        _connectedBots.insert(index);
+        _everConnectedBots.insert(index);
+    } else {
+        _connectedBots.remove(index);
+    }
+
+    auto links = stats["links"].toObject();
+    for (auto it = links.constBegin(); it != links.constEnd(); ++it) {
+        auto link = it.value().toObject();
+        auto& linkStats = _links[it.key()];
+
+        auto rttSamples = link["rtt"].toArray();
+        for (const auto& sample : rttSamples) {
+            linkStats.rtt.add((quint64)sample.toDouble());
+        }
+        if (!rttSamples.isEmpty()) {
+            linkStats.jitter.add((quint64)link["jitter"].toDouble());
+        }
+        linkStats.answered += rttSamples.size();
+        linkStats.lost += (quint64)link["lost"].toDouble();
+    }
+
+    _botAudio[index] = stats["audio"].toObject();
+
+    auto sent = stats["sent"].toObject();
+    _avatarBytesSent += (quint64)sent["avatar_bytes"].toDouble();
+    _audioFramesSent += (quint64)sent["audio_frames"].toDouble();
+    _queryBytesSent += (quint64)sent["query_bytes"].toDouble();
+    _bytesReceived += (quint64)stats["received_bytes"].toDouble();
+}
+
+QNetworkReply* SwarmCoordinator::getStats(const QString& path) {
+    QUrl url = _config.statsURL;
+    url.setPath(path);
+    url.setUserInfo(QString());
+
+    QNetworkRequest request(url);
+    if (!_config.statsURL.userInfo().isEmpty()) {
+        // the domain-server's settings username and password
+        request.setRawHeader("Authorization", "Basic " + _config.statsURL.userInfo().toUtf8().toBase64());
+    }
+    return NetworkAccessManager::getInstance().get(request);
+}
+
+void SwarmCoordinator::pollServerStats() {
+    auto nodesReply = getStats("/nodes.json");
+    connect(nodesReply, &QNetworkReply::finished, this, [this, nodesReply] {
+        nodesReply->deleteLater();
+        if (nodesReply->error() == QNetworkReply::NoError) {
+            processNodeList(QJsonDocument::fromJson(nodesReply->readAll()).object());
+        }
+    });
+
+    for (auto it = _serverNodeIDs.constBegin(); it != _serverNodeIDs.constEnd(); ++it) {
+        QString nodeType = it.key();
+        auto statsReply = getStats(QString("/nodes/%1.json").arg(it.value()));
+        connect(statsReply, &QNetworkReply::finished, this, [this, statsReply, nodeType] {
+            statsReply->deleteLater();
+            if (statsReply->error() == QNetworkReply::NoError) {
+                processNodeStats(nodeType, QJsonDocument::fromJson(statsReply->readAll()).object());
+            }
+        });
+    }
+}
+
+void SwarmCoordinator::processNodeList(const QJsonObject& nodes) {
+    _serverNodeIDs.clear();
+    for (const auto& node : nodes["nodes"].toArray()) {
+        QString type = node.toObject()["type"].toString();
+        if (SERVER_FRAME_TIME_STATS.find(type) != SERVER_FRAME_TIME_STATS.end()) {
+            _serverNodeIDs[type] = node.toObject()["uuid"].toString();
+        }
+    }
+}
+
+void SwarmCoordinator::processNodeStats(const QString& nodeType, const QJsonObject& stats) {
+    auto it = SERVER_FRAME_TIME_STATS.find(nodeType);
+    if (it == SERVER_FRAME_TIME_STATS.end()) {
+        return;
+    }
+
+    double frameUsecs = 0.0;
+    for (const auto& path : it->second) {
+        QJsonValue value = stats;
+        for (const auto& key : path) {
+            value = value.toObject()[key];
+        }
+        if (!value.isDouble()) {
+            // the mixer hasn't sent its stats yet
+            return;
+        }
+        frameUsecs += value.toDouble();
+    }
+    _serverFrameTimes[nodeType].add((quint64)frameUsecs);
+}
+
+void SwarmCoordinator::printProgress() {
+    QString progress = QString("%1/%2 bots connected").arg(_connectedBots.size()).arg(_bots.size());
+    for (const auto& entry : _links) {
+        const auto& link = entry.second;
+        progress += QString(" | %1 rtt p50 %2ms p99 %3ms loss %4%")
+            .arg(entry.first)
+            .arg((double)link.rtt.getPercentile(0.50f) / USECS_PER_MSEC, 0, 'f', 1)
+            .arg((double)link.rtt.getPercentile(0.99f) / USECS_PER_MSEC, 0, 'f', 1)
+            .arg(100.0 * ratio(link.lost, link.answered + link.lost), 0, 'f', 2);
+    }
+    for (const auto& entry : _serverFrameTimes) {
+        progress += QString(" | %1 frame p99 %2us").arg(entry.first).arg(entry.second.getPercentile(0.99f));
+    }
+    qInfo().noquote() << progress;
+}
+
+QJsonObject SwarmCoordinator::buildReport() const {
+    double elapsedSecs = (double)(usecTimestampNow() - _startTime) / USECS_PER_SECOND;
+
+    QJsonObject bots;
+    bots["launched"] = (int)_bots.size();
+    bots["connected"] = _connectedBots.size();
+    bots["ever_connected"] = _everConnectedBots.size();
+
+    QJsonObject links;
+    for (const auto& entry : _links) {
+        const auto& link = entry.second;
+        QJsonObject linkJSON;
+        linkJSON["rtt_usecs"] = link.rtt.toJson();
+        linkJSON["jitter_usecs"] = link.jitter.toJson();
+        linkJSON["pings_answered"] = (qint64)link.answered;
+        linkJSON["pings_lost"] = (qint64)link.lost;
+        linkJSON["loss"] = ratio(link.lost, link.answered + link.lost);
+        links[entry.first] = linkJSON;
+    }
+
+    quint64 upReceived = 0, upLost = 0, downReceived = 0, downLost = 0;
+    for (const auto& audio : _botAudio) {
+        upReceived += (quint64)audio["up_received"].toDouble();
+        upLost += (quint64)audio["up_lost"].toDouble();
+        downReceived += (quint64)audio["down_received"].toDouble();
+        downLost += (quint64)audio["down_lost"].toDouble();
+    }
+    QJsonObject upstream;
+    upstream["received"] = (qint64)upReceived;
+    upstream["lost"] = (qint64)upLost;
+    upstream["loss"] = ratio(upLost, upReceived + upLost);
+    QJsonObject downstream;
+    downstream["received"] = (qint64)downReceived;
+    downstream["lost"] = (qint64)downLost;
+    downstream["loss"] = ratio(downLost, downReceived + downLost);
+    QJsonObject audio;
+    audio["upstream"] = upstream;
+    audio["downstream"] = downstream;
+
+    QJsonObject traffic;
+    traffic["avatar_kbps"] = (double)_avatarBytesSent / BYTES_PER_KILOBIT / elapsedSecs;
+    traffic["query_kbps"] = (double)_queryBytesSent / BYTES_PER_KILOBIT / elapsedSecs;
+    traffic["audio_frames_per_second"] = (double)_audioFramesSent / elapsedSecs;
+    traffic["received_kbps"] = (double)_bytesReceived / BYTES_PER_KILOBIT / elapsedSecs;
+
+    QJsonObject serverFrameTimes;
+    for (const auto& entry : _serverFrameTimes) {
+        serverFrameTimes[entry.first] = entry.second.toJson();
+    }
+
+    QJsonObject report;
+    report["duration_secs"] = elapsedSecs;
+    report["bots"] = bots;
+    report["links"] = links;
+    report["audio"] = audio;
+    report["traffic"] = traffic;
+    report["server_frame_usecs"] = serverFrameTimes;
+    return report;
+}
+
+void SwarmCoordinator::finish() {
+    _isFinishing = true;
+    _launchTimer.stop();
+    _statsTimer.stop();
+    _progressTimer.stop();
+
+    // take the report before the bots start dropping out
+    QJsonObject report = buildReport();
+
+    for (auto bot : _bots) {
+        bot->terminate();
+    }
+    for (auto bot : _bots) {
+        if (!bot->waitForFinished(BOT_EXIT_TIMEOUT_MSECS)) {
+            bot->kill();
+            bot->waitForFinished();
+        }
+    }
+
+    QByteArray reportJSON = QJsonDocument(report).toJson();
+    fwrite(reportJSON.constData(), 1, reportJSON.size(), stdout);
+    fflush(stdout);
+
+    if (!_config.reportPath.isEmpty()) {
+        QFile reportFile(_config.reportPath);
+        if (reportFile.open(QIODevice::WriteOnly)) {
+            reportFile.write(reportJSON);
+        } else {
+            qWarning() << "Could not write report to" << _config.reportPath;
+        }
+    }
+
+    emit finished(_everConnectedBots.isEmpty() ? 1 : 0);
+}
@@ -0,0 +1,99 @@
+//
+//  SwarmCoordinator.h
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SwarmCoordinator_h
+#define hifi_SwarmCoordinator_h
+
+#include <map>
+#include <vector>
+
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QProcess>
+#include <QSet>
+#include <QTimer>
+#include <QUrl>
+
+#include "LatencyHistogram.h"
+
+class QNetworkReply;
+
+struct SwarmCoordinatorConfig {
+    int numBots { 100 };
+    float rampRate { 20.0f };        // bots launched per second
+    int durationSecs { 60 };
+    int progressIntervalSecs { 5 };
+    QUrl statsURL;                   // domain-server HTTP root, polled for server-side frame times
+    QString reportPath;              // where the final JSON report is written, if anywhere
+    QStringList botArguments;        // passed through to every bot process
+    bool verbose { false };
+};
+
+// launches one bot process per simulated avatar, aggregates what they report and polls the domain-server
+// for the stats its mixers send it, then prints a JSON report
+// A process per avatar (see SwarmApp) limits a single machine to however many bot processes it can run: to go past
+// that, start swarms on several machines, each with its own -n, against the same domain.
+class SwarmCoordinator : public QObject {
+    Q_OBJECT
+public:
+    SwarmCoordinator(const SwarmCoordinatorConfig& config, QObject* parent = nullptr);
+    ~SwarmCoordinator();
+
+signals:
+    void finished(int exitCode);
+
+private slots:
+    void launchNextBot();
+    void pollServerStats();
+    void printProgress();
+    void finish();
+
+private:
+    struct LinkStats {
+        LatencyHistogram rtt;
+        LatencyHistogram jitter;
+        quint64 answered { 0 };
+        quint64 lost { 0 };
+    };
+
+    void readBotOutput(int index);
+    void processBotStats(const QJsonObject& stats);
+    void processNodeList(const QJsonObject& nodes);
+    void processNodeStats(const QString& nodeType, const QJsonObject& stats);
+    QNetworkReply* getStats(const QString& path);
+
+    QJsonObject buildReport() const;
+
+    SwarmCoordinatorConfig _config;
+
+    std::vector<QProcess*> _bots;
+    QTimer _launchTimer;
+    QTimer _statsTimer;
+    QTimer _progressTimer;
+    quint64 _startTime { 0 };
+    bool _isFinishing { false };
+
+    std::map<QString, LinkStats> _links;
+    std::map<QString, LatencyHistogram> _serverFrameTimes;
+    QHash<QString, QString> _serverNodeIDs;  // node type -> UUID, from the domain-server's node list
+
+    // latest cumulative audio stream stats of each bot
+    QHash<int, QJsonObject> _botAudio;
+    QSet<int> _connectedBots;
+    QSet<int> _everConnectedBots;
+
+    quint64 _avatarBytesSent { 0 };
+    quint64 _audioFramesSent { 0 };
+    quint64 _queryBytesSent { 0 };
+    quint64 _bytesReceived { 0 };
+};
+
+#endif // hifi_SwarmCoordinator_h
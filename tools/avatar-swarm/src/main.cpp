@@ -0,0 +1,37 @@
+//
+//  main.cpp
+//  tools/avatar-swarm/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <cstring>
+
+#include <BuildInfo.h>
+#include <SettingHandle.h>
+#include <SharedUtil.h>
+
+#include "SwarmApp.h"
+
+int main(int argc, char* argv[]) {
+    setupHifiApplication(BuildInfo::AVATAR_SWARM_NAME);
+
+    // like the assignment-client, bots keep no settings: hundreds of them running at once would otherwise race on,
+    // or each leave behind, a settings file
+    bool isBot = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--bot") == 0) {
+            isBot = true;
+            break;
+        }
+    }
+    if (!isBot) {
+        Setting::init();
+    }
+
+    SwarmApp app(argc, argv);
+    return app.exec();
+}
@@ -12,12 +12,19 @@
 #include "ICEClientApp.h"
 
 #include <QDataStream>
+#include <QFile>
 #include <QLoggingCategory>
 #include <QCommandLineParser>
 
+#include <algorithm>
+
 #include <PathUtils.h>
+#include <DataServerAccountInfo.h>
 #include <LimitedNodeList.h>
 #include <NetworkLogging.h>
+#include <NumericalConstants.h>
+#include <RSAKeypairGenerator.h>
+#include <SharedUtil.h>
 
 ICEClientApp::ICEClientApp(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
@@ -44,6 +51,27 @@ ICEClientApp::ICEClientApp(int argc, char* argv[]) :
     const QCommandLineOption cacheSTUNOption("s", "cache stun-server response");
     parser.addOption(cacheSTUNOption);
 
+    const QCommandLineOption stressOption("stress",
+        "query the ice-server for the domain given with -d as fast as --rate allows for this many seconds, "
+        "then report the peer exchanges per second it sustained", "seconds");
+    parser.addOption(stressOption);
+
+    const QCommandLineOption stressRateOption("rate", "queries or heartbeats per second in stress mode", "rate", "1000");
+    parser.addOption(stressRateOption);
+
+    const QCommandLineOption heartbeatFloodOption("heartbeat-flood",
+        "send signed heartbeats for the made up domains in --test-domain-keys as fast as --rate allows for this many "
+        "seconds, then report the heartbeats per second the ice-server acknowledged", "seconds");
+    parser.addOption(heartbeatFloodOption);
+
+    const QCommandLineOption testDomainKeysOption("test-domain-keys",
+        "file of made up domains and their keys, for --heartbeat-flood and for ice-server --test-domain-keys", "path");
+    parser.addOption(testDomainKeysOption);
+
+    const QCommandLineOption writeTestDomainKeysOption("write-test-domain-keys",
+        "make up this many domains sharing one new keypair, write them to the --test-domain-keys file and exit", "count");
+    parser.addOption(writeTestDomainKeysOption);
+
     if (!parser.parse(QCoreApplication::arguments())) {
         qCritical() << parser.errorText() << endl;
         parser.showHelp();
@@ -104,6 +132,42 @@ ICEClientApp::ICEClientApp(int argc, char* argv[]) :
         qDebug() << "ICE-server address is" << _iceServerAddr;
     }
 
+    if (parser.isSet(writeTestDomainKeysOption) || parser.isSet(heartbeatFloodOption)) {
+        _testDomainKeysPath = parser.value(testDomainKeysOption);
+        if (_testDomainKeysPath.isEmpty()) {
+            qCritical() << "Heartbeat floods need a file of test domain keys, given with --test-domain-keys";
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+            return;
+        }
+    }
+
+    if (parser.isSet(writeTestDomainKeysOption)) {
+        int exitCode = writeTestDomainKeys(_testDomainKeysPath, parser.value(writeTestDomainKeysOption).toInt()) ? 0 : 1;
+        QTimer::singleShot(0, this, [exitCode] { QCoreApplication::exit(exitCode); });
+        return;
+    }
+
+    if (parser.isSet(heartbeatFloodOption)) {
+        _stressMode = true;
+        _stressSeconds = parser.value(heartbeatFloodOption).toInt();
+        _stressRate = parser.value(stressRateOption).toInt();
+        startStress();
+        return;
+    }
+
+    if (parser.isSet(stressOption)) {
+        if (_domainID.isNull()) {
+            qCritical() << "Stress mode needs the ID of a domain heartbeating with the ice-server, given with -d";
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+            return;
+        }
+        _stressMode = true;
+        _stressSeconds = parser.value(stressOption).toInt();
+        _stressRate = parser.value(stressRateOption).toInt();
+        startStress();
+        return;
+    }
+
     setState(lookUpStunServer);
 
     QTimer* doTimer = new QTimer(this);
@@ -318,6 +382,17 @@ void ICEClientApp::processSTUNResponse(std::unique_ptr<udt::BasePacket> packet)
 void ICEClientApp::processPacket(std::unique_ptr<udt::Packet> packet) {
     std::unique_ptr<NLPacket> nlPacket = NLPacket::fromBase(std::move(packet));
 
+    if (_stressMode) {
+        // every answered query is one exchange, the domain-server is sent the other half
+        if (nlPacket->getType() == PacketType::ICEServerPeerInformation ||
+            nlPacket->getType() == PacketType::ICEServerHeartbeatACK) {
+            ++_stressReplies;
+        } else if (nlPacket->getType() == PacketType::ICEServerHeartbeatDenied) {
+            ++_stressHeartbeatsDenied;
+        }
+        return;
+    }
+
     if (nlPacket->getPayloadSize() < NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
         if (_verbose) {
             qDebug() << "got a short packet.";
@@ -384,3 +459,146 @@ void ICEClientApp::processPacket(std::unique_ptr<udt::Packet> packet) {
         }
     }
 }
+
+bool ICEClientApp::writeTestDomainKeys(const QString& path, int numDomains) {
+    // one keypair does for every domain, what the ice-server verifies costs the same whichever key signed it
+    QByteArray publicKey;
+    QByteArray privateKey;
+    RSAKeypairGenerator generator;
+    connect(&generator, &RSAKeypairGenerator::generatedKeypair, this, [&](QByteArray generatedPublicKey, QByteArray generatedPrivateKey) {
+        publicKey = generatedPublicKey;
+        privateKey = generatedPrivateKey;
+    });
+    generator.generateKeypair();
+
+    QFile keysFile { path };
+    if (publicKey.isEmpty() || !keysFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qCritical() << "Could not write test domain keys to" << path;
+        return false;
+    }
+
+    // the ice-server only reads the first two fields, the private key is there for us to sign with
+    auto keys = " " + publicKey.toBase64() + " " + privateKey.toBase64() + "\n";
+    for (int i = 0; i < numDomains; ++i) {
+        keysFile.write(QUuid::createUuid().toString().toLatin1() + keys);
+    }
+
+    qDebug() << "Wrote" << numDomains << "test domains to" << path << "- start the ice-server with --test-domain-keys" << path;
+    return true;
+}
+
+bool ICEClientApp::makeStressHeartbeats(const QString& path) {
+    QFile keysFile { path };
+    if (!keysFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qCritical() << "Could not open test domain keys file" << path;
+        return false;
+    }
+
+    // a domain-server signs its heartbeat once and sends it until its sockets change, so sign each domain's once too
+    DataServerAccountInfo accountInfo;
+    while (!keysFile.atEnd()) {
+        auto fields = keysFile.readLine().trimmed().split(' ');
+        if (fields.size() != 3) {
+            continue;
+        }
+
+        accountInfo.setPrivateKey(QByteArray::fromBase64(fields[2]));
+
+        auto heartbeat = NLPacket::create(PacketType::ICEServerHeartbeat);
+        QDataStream heartbeatStream(heartbeat.get());
+        heartbeatStream << QUuid(QString::fromLatin1(fields[0])) << _publicSockAddr << _localSockAddr;
+        auto plaintext = QByteArray::fromRawData(heartbeat->getPayload(), heartbeat->getPayloadSize());
+        heartbeatStream << accountInfo.signPlaintext(plaintext);
+
+        _stressHeartbeats.push_back(std::move(heartbeat));
+    }
+
+    if (_stressHeartbeats.empty()) {
+        qCritical() << "No test domains in" << path;
+        return false;
+    }
+    return true;
+}
+
+void ICEClientApp::startStress() {
+    // the ice-server only needs somewhere to send the domain's information, so skip STUN
+    openSocket();
+
+    if (!_testDomainKeysPath.isEmpty()) {
+        if (!makeStressHeartbeats(_testDomainKeysPath)) {
+            QTimer::singleShot(0, this, [this] { QCoreApplication::exit(iceFailureExitStatus); });
+            return;
+        }
+        qDebug() << "Sending heartbeats for" << _stressHeartbeats.size() << "domains to" << _iceServerAddr
+                 << "at" << _stressRate << "heartbeats per second for" << _stressSeconds << "seconds";
+    } else {
+        qDebug() << "Querying" << _iceServerAddr << "for domain" << uuidStringWithoutCurlyBraces(_domainID)
+                 << "at" << _stressRate << "queries per second for" << _stressSeconds << "seconds";
+    }
+
+    _stressStartTime = usecTimestampNow();
+
+    const int STRESS_SEND_INTERVAL_MSECS = 5;
+    connect(&_stressSendTimer, &QTimer::timeout, this, &ICEClientApp::sendStressQueries);
+    _stressSendTimer.setTimerType(Qt::PreciseTimer);
+    _stressSendTimer.start(STRESS_SEND_INTERVAL_MSECS);
+
+    connect(&_stressReportTimer, &QTimer::timeout, this, &ICEClientApp::reportStress);
+    _stressReportTimer.start((int)MSECS_PER_SECOND);
+}
+
+void ICEClientApp::sendStressQueries() {
+    // send however many queries we owe for the time that has passed, so the rate holds up under a busy event loop
+    auto elapsedUsecs = usecTimestampNow() - _stressStartTime;
+    auto queriesDue = elapsedUsecs * _stressRate / USECS_PER_SECOND;
+    for (; _stressQueriesSent < queriesDue; ++_stressQueriesSent) {
+        if (!_stressHeartbeats.empty()) {
+            // round robin over the domains, as if each of them was heartbeating at its share of the rate
+            _socket->writePacket(*_stressHeartbeats[_stressQueriesSent % _stressHeartbeats.size()], _iceServerAddr);
+        } else {
+            sendPacketToIceServer(PacketType::ICEServerQuery, _iceServerAddr, QUuid::createUuid(), _domainID);
+        }
+    }
+}
+
+void ICEClientApp::reportStress() {
+    auto replies = _stressReplies - _stressLastReplies;
+    _stressLastReplies = _stressReplies;
+    _stressRepliesPerSecond.push_back(replies);
+
+    bool isHeartbeatFlood = !_stressHeartbeats.empty();
+    qDebug() << "second" << _stressRepliesPerSecond.size() << "- sent" << _stressQueriesSent
+             << (isHeartbeatFlood ? "heartbeats," : "queries,") << replies
+             << (isHeartbeatFlood ? "acknowledged heartbeats per second" : "peer exchanges per second");
+
+    if ((int)_stressRepliesPerSecond.size() >= _stressSeconds) {
+        finishStress();
+    }
+}
+
+void ICEClientApp::finishStress() {
+    _stressSendTimer.stop();
+    _stressReportTimer.stop();
+
+    // the first second includes the ramp up, leave it out unless it's all we have
+    auto begin = _stressRepliesPerSecond.size() > 1 ? _stressRepliesPerSecond.begin() + 1 : _stressRepliesPerSecond.begin();
+    auto end = _stressRepliesPerSecond.end();
+    quint64 total = 0;
+    for (auto it = begin; it != end; ++it) {
+        total += *it;
+    }
+    auto seconds = std::max((quint64)(end - begin), (quint64)1);
+    quint64 minimum = begin != end ? *std::min_element(begin, end) : 0;
+
+    bool isHeartbeatFlood = !_stressHeartbeats.empty();
+    qDebug() << "Sent" << _stressQueriesSent << (isHeartbeatFlood ? "heartbeats, acknowledged" : "queries, answered")
+             << _stressReplies << "- lost" << (_stressQueriesSent - std::min(_stressQueriesSent, _stressReplies));
+    if (isHeartbeatFlood) {
+        qDebug() << "Denied" << _stressHeartbeatsDenied << "heartbeats";
+    }
+    qDebug() << "Sustained" << total / seconds
+             << (isHeartbeatFlood ? "acknowledged heartbeats per second, minimum" : "peer exchanges per second, minimum")
+             << minimum;
+
+    QCoreApplication::exit(_stressReplies > 0 ? 0 : iceFailureExitStatus);
+}
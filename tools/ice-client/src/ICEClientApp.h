@@ -13,9 +13,13 @@
 #ifndef hifi_ICEClientApp_h
 #define hifi_ICEClientApp_h
 
+#include <vector>
+
 #include <QCoreApplication>
+#include <QTimer>
 #include <udt/Constants.h>
 #include <udt/Socket.h>
+#include <NLPacket.h>
 #include <ReceivedMessage.h>
 #include <NetworkPeer.h>
 
@@ -37,6 +41,10 @@ public slots:
     void iceResponseTimeout();
     void stunResponseTimeout();
 
+private slots:
+    void sendStressQueries();
+    void reportStress();
+
 private:
     enum State {
         lookUpStunServer, // 0
@@ -61,6 +69,15 @@ private:
     void processPacket(std::unique_ptr<udt::Packet> packet);
     void checkDomainPingCount();
 
+    // stress mode: queries for the domain from a stream of made up clients, counting the peer exchanges
+    // the ice-server answers with.  With test domain keys it instead sends signed heartbeats for many made up
+    // domains, counting the ones the ice-server acknowledges
+    void startStress();
+    void finishStress();
+
+    bool writeTestDomainKeys(const QString& path, int numDomains);
+    bool makeStressHeartbeats(const QString& path);
+
     bool _verbose;
     bool _cacheSTUNResult; // should we only talk to stun server once?
     bool _stunResultSet { false }; // have we already talked to stun server?
@@ -89,6 +106,20 @@ private:
     QTimer _stunResponseTimer;
     QTimer _iceResponseTimer;
     int _domainPingCount { 0 };
+
+    bool _stressMode { false };
+    int _stressSeconds { 0 };
+    int _stressRate { 0 };              // queries per second
+    quint64 _stressStartTime { 0 };
+    quint64 _stressQueriesSent { 0 };
+    quint64 _stressReplies { 0 };
+    quint64 _stressLastReplies { 0 };
+    std::vector<quint64> _stressRepliesPerSecond;
+    QString _testDomainKeysPath;
+    std::vector<std::unique_ptr<NLPacket>> _stressHeartbeats;
+    quint64 _stressHeartbeatsDenied { 0 };
+    QTimer _stressSendTimer;
+    QTimer _stressReportTimer;
 };
 
 
@@ -0,0 +1,314 @@
+//
+//  BakeCache.cpp
+//  tools/oven/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QRegExp>
+#include <QtCore/QUuid>
+
+#include "ModelBakingLoggingCategory.h"
+
+// Bump whenever baker output or the entry layout changes so stale entries are not restored
+static const QByteArray BAKE_CACHE_VERSION = "2";
+// Written last into an entry; holds the dependencies the entry was baked against
+static const QString BAKE_CACHE_COMPLETE_MARKER = ".complete";
+static const QString DEPENDENCIES_KEY = "dependencies";
+static const QString DEPENDENCY_PATH_KEY = "path";
+static const QString DEPENDENCY_HASH_KEY = "hash";
+static const qint64 HASH_READ_CHUNK_SIZE = 1024 * 1024;
+// Its serializer loads external buffers directly, so those files never show up as dependencies
+static const QStringList UNTRACKED_DEPENDENCY_EXTENSIONS { "gltf" };
+static const QString OBJ_EXTENSION = "obj";
+// What the OBJ serializer reads from a material library, and the textures it looks for when an OBJ has none
+static const QStringList OBJ_LIBRARY_TEXTURE_TOKENS { "map_Kd", "map_Ke", "map_Ks", "map_bump", "bump", "map_d" };
+static const QStringList OBJ_DEFAULT_TEXTURE_EXTENSIONS { "jpg", "jpeg", "png", "tga" };
+
+static void hashFileContent(QFile& file, QCryptographicHash& hash) {
+    while (!file.atEnd()) {
+        hash.addData(file.read(HASH_READ_CHUNK_SIZE));
+    }
+}
+
+// Missing files hash to an empty value, so a dependency that was absent at bake time must still be absent
+static QByteArray hashDependency(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hashFileContent(file, hash);
+    return hash.result().toHex();
+}
+
+static bool hasUntrackedDependencies(const QUrl& url) {
+    return UNTRACKED_DEPENDENCY_EXTENSIONS.contains(QFileInfo(url.path()).suffix().toLower());
+}
+
+static QString uniqueSuffix() {
+    return "." + QUuid::createUuid().toString(QUuid::WithoutBraces);
+}
+
+// The OBJ serializer reads the material libraries an OBJ names, and looks for a texture named after the OBJ, without
+// going through a baker, so the cache finds those files itself. Missing ones are recorded too: they must stay missing.
+static std::vector<QUrl> objDependencies(const QUrl& objUrl) {
+    std::vector<QUrl> dependencies;
+    QFile file(objUrl.toLocalFile());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return dependencies;
+    }
+
+    QFileInfo objInfo(file.fileName());
+    QDir objDirectory = objInfo.absoluteDir();
+    for (const auto& extension : OBJ_DEFAULT_TEXTURE_EXTENSIONS) {
+        dependencies.push_back(QUrl::fromLocalFile(objDirectory.absoluteFilePath(objInfo.completeBaseName() + "." + extension)));
+    }
+
+    while (!file.atEnd()) {
+        auto tokens = QString::fromUtf8(file.readLine()).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+        if (tokens.size() < 2 || tokens.first() != "mtllib") {
+            continue;
+        }
+
+        // like the serializer, only the file name of the library counts
+        QString libraryPath = objDirectory.absoluteFilePath(QFileInfo(tokens[1]).fileName());
+        dependencies.push_back(QUrl::fromLocalFile(libraryPath));
+
+        QFile library(libraryPath);
+        if (!library.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        while (!library.atEnd()) {
+            auto libraryTokens = QString::fromUtf8(library.readLine()).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+            if (libraryTokens.size() >= 2 && OBJ_LIBRARY_TEXTURE_TOKENS.contains(libraryTokens.first())) {
+                dependencies.push_back(QUrl::fromLocalFile(objDirectory.absoluteFilePath(libraryTokens.last())));
+            }
+        }
+    }
+    return dependencies;
+}
+
+static bool isObj(const QUrl& url) {
+    return QFileInfo(url.path()).suffix().toLower() == OBJ_EXTENSION;
+}
+
+static bool copyFiles(const QDir& source, const QStringList& files, const QDir& destination) {
+    if (!destination.mkpath(".")) {
+        return false;
+    }
+
+    for (const auto& relativePath : files) {
+        QString destinationPath = destination.absoluteFilePath(relativePath);
+        destination.mkpath(QFileInfo(destinationPath).absolutePath());
+        QFile::remove(destinationPath);
+        if (!QFile::copy(source.absoluteFilePath(relativePath), destinationPath)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BakeCache::BakeCache(const QString& cacheDirectory) :
+    _cacheDirectory(cacheDirectory)
+{
+    _isValid = !cacheDirectory.isEmpty() && _cacheDirectory.mkpath(".");
+    if (!_isValid) {
+        qCWarning(model_baking) << "Unable to use bake cache directory" << cacheDirectory;
+    }
+}
+
+QByteArray BakeCache::computeKey(const QUrl& inputUrl, const QString& type, const QByteArray& bakeOptions) {
+    if (!inputUrl.isLocalFile() || hasUntrackedDependencies(inputUrl)) {
+        return QByteArray();
+    }
+
+    QFile file(inputUrl.toLocalFile());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(BAKE_CACHE_VERSION);
+    hash.addData(type.toUtf8());
+    hash.addData(bakeOptions);
+    // Baked output files are named after the input and the extension selects the serializer,
+    // so identical bytes under a different file name must not share an entry
+    hash.addData(QFileInfo(file.fileName()).fileName().toUtf8());
+
+    hashFileContent(file, hash);
+
+    return hash.result().toHex();
+}
+
+QString BakeCache::entryPath(const QByteArray& key) const {
+    // Fan out on the first two hex digits to keep directories small
+    return _cacheDirectory.absoluteFilePath(QString::fromLatin1(key.left(2)) + "/" + QString::fromLatin1(key));
+}
+
+BakeCache::DirectorySnapshot BakeCache::snapshot(const QDir& directory) {
+    DirectorySnapshot files;
+    QDirIterator it(directory.absolutePath(), QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        QFileInfo info = it.fileInfo();
+        files.insert(directory.relativeFilePath(info.absoluteFilePath()), { info.size(), info.lastModified() });
+    }
+    return files;
+}
+
+QStringList BakeCache::changedFiles(const QDir& directory, const DirectorySnapshot& before) {
+    QStringList changed;
+    auto after = snapshot(directory);
+    for (auto it = after.cbegin(); it != after.cend(); ++it) {
+        auto previous = before.find(it.key());
+        if (previous == before.end() || previous.value() != it.value()) {
+            changed << it.key();
+        }
+    }
+    return changed;
+}
+
+bool BakeCache::restore(const QByteArray& key, const QUrl& inputUrl, const QDir& outputDirectory) const {
+    if (!_isValid || key.isEmpty()) {
+        return false;
+    }
+
+    QDir entry(entryPath(key));
+    QFile marker(entry.absoluteFilePath(BAKE_CACHE_COMPLETE_MARKER));
+    if (!marker.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QByteArray markerData = marker.readAll();
+    marker.close();
+
+    QDir inputDirectory = QFileInfo(inputUrl.toLocalFile()).absoluteDir();
+    auto dependencies = QJsonDocument::fromJson(markerData).object()[DEPENDENCIES_KEY].toArray();
+    for (const auto& value : dependencies) {
+        auto dependency = value.toObject();
+        QString path = inputDirectory.absoluteFilePath(dependency[DEPENDENCY_PATH_KEY].toString());
+        if (hashDependency(path) != dependency[DEPENDENCY_HASH_KEY].toString().toLatin1()) {
+            qCDebug(model_baking) << "Bake cache entry" << key << "is stale," << path << "changed";
+            return false;
+        }
+    }
+
+    QStringList files;
+    QDirIterator it(entry.absolutePath(), QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QString relativePath = entry.relativeFilePath(it.next());
+        if (relativePath != BAKE_CACHE_COMPLETE_MARKER) {
+            files << relativePath;
+        }
+    }
+
+    // Another oven process may replace the entry while it is copied, so copy it aside and check that the marker
+    // is still the one that was validated before moving anything into the output directory
+    QDir stagingDir(outputDirectory.absoluteFilePath(".bake-cache-restore" + uniqueSuffix()));
+    if (!copyFiles(entry, files, stagingDir) || !marker.open(QIODevice::ReadOnly) || marker.readAll() != markerData) {
+        stagingDir.removeRecursively();
+        qCWarning(model_baking) << "Failed to restore bake cache entry" << key;
+        return false;
+    }
+
+    bool restored = true;
+    for (const auto& relativePath : files) {
+        QString destinationPath = outputDirectory.absoluteFilePath(relativePath);
+        outputDirectory.mkpath(QFileInfo(destinationPath).absolutePath());
+        QFile::remove(destinationPath);
+        if (!QFile::rename(stagingDir.absoluteFilePath(relativePath), destinationPath)) {
+            restored = false;
+        }
+    }
+    stagingDir.removeRecursively();
+    if (!restored) {
+        qCWarning(model_baking) << "Failed to restore bake cache entry" << key;
+    }
+    return restored;
+}
+
+bool BakeCache::store(const QByteArray& key, const QUrl& inputUrl, const QDir& outputDirectory, const QStringList& files,
+                      const std::vector<QUrl>& dependencies) {
+    if (!_isValid || key.isEmpty()) {
+        return false;
+    }
+
+    // Dependencies are recorded relative to the input, the way the bakers resolve them, so the entry
+    // applies to the same content baked from another directory
+    QDir inputDirectory = QFileInfo(inputUrl.toLocalFile()).absoluteDir();
+    std::vector<QUrl> allDependencies = dependencies;
+    if (isObj(inputUrl)) {
+        allDependencies = objDependencies(inputUrl);
+        allDependencies.insert(allDependencies.end(), dependencies.begin(), dependencies.end());
+    }
+    for (const auto& url : dependencies) {
+        if (url.isLocalFile() && isObj(url)) {
+            auto materialDependencies = objDependencies(url);
+            allDependencies.insert(allDependencies.end(), materialDependencies.begin(), materialDependencies.end());
+        }
+    }
+
+    QJsonArray dependencyHashes;
+    for (const auto& url : allDependencies) {
+        if (!url.isLocalFile() || hasUntrackedDependencies(url)) {
+            qCDebug(model_baking) << "Not caching bake" << key << "with dependency" << url;
+            return false;
+        }
+        QJsonObject dependency;
+        dependency[DEPENDENCY_PATH_KEY] = inputDirectory.relativeFilePath(url.toLocalFile());
+        dependency[DEPENDENCY_HASH_KEY] = QString::fromLatin1(hashDependency(url.toLocalFile()));
+        dependencyHashes.append(dependency);
+    }
+
+    // Write into a private staging directory and rename it into place, so concurrent oven processes sharing
+    // the cache never observe a partially written entry
+    QString finalPath = entryPath(key);
+    QDir stagingDir(finalPath + uniqueSuffix());
+    if (!copyFiles(outputDirectory, files, stagingDir)) {
+        stagingDir.removeRecursively();
+        qCWarning(model_baking) << "Failed to write bake cache entry" << key;
+        return false;
+    }
+
+    QFile marker(stagingDir.absoluteFilePath(BAKE_CACHE_COMPLETE_MARKER));
+    QJsonObject markerObject;
+    markerObject[DEPENDENCIES_KEY] = dependencyHashes;
+    if (!marker.open(QIODevice::WriteOnly) || marker.write(QJsonDocument(markerObject).toJson(QJsonDocument::Compact)) == -1) {
+        stagingDir.removeRecursively();
+        qCWarning(model_baking) << "Failed to write bake cache entry" << key;
+        return false;
+    }
+    marker.close();
+
+    // An entry is never deleted where it is, since a concurrent restore may be copying from it: a stale one is
+    // moved aside first and only removed once the new one has taken its place
+    QString replacedPath;
+    if (QDir(finalPath).exists()) {
+        replacedPath = finalPath + ".replaced" + uniqueSuffix();
+        if (!_cacheDirectory.rename(finalPath, replacedPath)) {
+            stagingDir.removeRecursively();
+            qCWarning(model_baking) << "Failed to replace bake cache entry" << key;
+            return false;
+        }
+    }
+    bool stored = _cacheDirectory.rename(stagingDir.absolutePath(), finalPath);
+    if (!stored) {
+        stagingDir.removeRecursively();
+    }
+    if (!replacedPath.isEmpty()) {
+        QDir(replacedPath).removeRecursively();
+    }
+    return stored;
+}
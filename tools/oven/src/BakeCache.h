@@ -0,0 +1,62 @@
+//
+//  BakeCache.h
+//  tools/oven/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeCache_h
+#define hifi_BakeCache_h
+
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QPair>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QUrl>
+
+// Persistent cache of bake results, keyed by the content and file name of the source rather than its location.
+// The same texture or model referenced from many entities, domains or asset uploads is baked once; later bakes
+// of identical content restore the cached output instead of running a baker.
+class BakeCache {
+public:
+    // Size and modification time of every file under a directory, keyed by relative path
+    using DirectorySnapshot = QHash<QString, QPair<qint64, QDateTime>>;
+
+    BakeCache(const QString& cacheDirectory);
+
+    bool isValid() const { return _isValid; }
+
+    // Returns an empty key if the input is not a readable local file, or is a format whose serializer reads
+    // further files (external glTF buffers) that the cache cannot find as dependencies
+    static QByteArray computeKey(const QUrl& inputUrl, const QString& type, const QByteArray& bakeOptions = QByteArray());
+
+    // Copies the cached output for key into outputDirectory. Returns false on a cache miss, which includes an
+    // entry whose recorded dependencies, resolved against inputUrl, no longer match their content on disk.
+    bool restore(const QByteArray& key, const QUrl& inputUrl, const QDir& outputDirectory) const;
+
+    // Stores files (relative to outputDirectory) as the result for key, replacing any previous entry, along with
+    // the content hash of every dependency and of the material libraries and textures OBJ models read. Returns false
+    // without storing if a dependency cannot be verified on a later restore, such as a remote URL.
+    bool store(const QByteArray& key, const QUrl& inputUrl, const QDir& outputDirectory, const QStringList& files,
+               const std::vector<QUrl>& dependencies);
+
+    static DirectorySnapshot snapshot(const QDir& directory);
+    // Files under directory that were added or modified since before was taken
+    static QStringList changedFiles(const QDir& directory, const DirectorySnapshot& before);
+
+private:
+    QString entryPath(const QByteArray& key) const;
+
+    QDir _cacheDirectory;
+    bool _isValid { false };
+};
+
+#endif // hifi_BakeCache_h
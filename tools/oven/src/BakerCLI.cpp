@@ -29,7 +29,7 @@ BakerCLI::BakerCLI(OvenCLIApplication* parent) : QObject(parent) {
     
 }
 
-void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type) {
+void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type, const QString& cacheDirectory) {
 
     // if the URL doesn't have a scheme, assume it is a local file
     if (inputUrl.scheme() != "http" && inputUrl.scheme() != "https" && inputUrl.scheme() != "ftp" && inputUrl.scheme() != "file") {
@@ -45,6 +45,21 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
 
     _outputPath.setPath(outputPath);
 
+    // skip the bake entirely if identical content has already been baked with the same settings
+    if (!cacheDirectory.isEmpty()) {
+        _bakeCache.reset(new BakeCache(cacheDirectory));
+        QByteArray bakeOptions = TextureBaker::isCompressionEnabled() ? "compressed" : "uncompressed";
+        _bakeCacheKey = BakeCache::computeKey(inputUrl, type, bakeOptions);
+        if (_bakeCache->restore(_bakeCacheKey, inputUrl, _outputPath)) {
+            qCDebug(model_baking) << "Restored" << inputUrl << "from bake cache";
+            QCoreApplication::exit(OVEN_STATUS_CODE_SUCCESS);
+            return;
+        }
+        // the output directory may already hold other files, only the ones this bake writes belong in the cache
+        _inputUrl = inputUrl;
+        _outputSnapshot = BakeCache::snapshot(_outputPath);
+    }
+
     // create our appropiate baker
     if (type == MODEL_EXTENSION || type == FBX_EXTENSION) {
         QUrl bakeableModelURL = getBakeableModelURL(inputUrl);
@@ -124,6 +139,9 @@ void BakerCLI::handleFinishedBaker() {
             errorFile.write(_baker->getErrors().join('\n').toUtf8());
             errorFile.close();
         }
+    } else if (_bakeCache) {
+        _bakeCache->store(_bakeCacheKey, _inputUrl, _outputPath, BakeCache::changedFiles(_outputPath, _outputSnapshot),
+                          _baker->getDependencies());
     }
     QCoreApplication::exit(exitCode);
 }
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "Baker.h"
+#include "BakeCache.h"
 #include "OvenCLIApplication.h"
 
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
@@ -34,7 +35,8 @@ public:
     BakerCLI(OvenCLIApplication* parent);
 
 public slots:
-    void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString());
+    void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString(),
+                  const QString& cacheDirectory = QString());
 
 private slots:
     void handleFinishedBaker();  
@@ -42,6 +44,10 @@ private slots:
 private:
     QDir _outputPath;
     std::unique_ptr<Baker> _baker;
+    std::unique_ptr<BakeCache> _bakeCache;
+    QByteArray _bakeCacheKey;
+    QUrl _inputUrl;
+    BakeCache::DirectorySnapshot _outputSnapshot;
 };
 
 #endif // hifi_BakerCLI_h
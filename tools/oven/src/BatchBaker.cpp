@@ -0,0 +1,313 @@
+//
+//  BatchBaker.cpp
+//  tools/oven/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BatchBaker.h"
+
+#include <algorithm>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QProcess>
+#include <QImageReader>
+
+#include "BakeCache.h"
+#include "BakerCLI.h"
+#include "Gzip.h"
+#include "ModelBakingLoggingCategory.h"
+#include "TextureBaker.h"
+#include "baking/BakerLibrary.h"
+
+static const QString MODEL_TYPE = "model";
+static const QString MATERIAL_TYPE = "material";
+static const QString DEFAULT_TEXTURE_TYPE = "default";
+static const QString AMBIENT_TEXTURE_TYPE = "ambient";
+static const QString SKYBOX_TEXTURE_TYPE = "skybox";
+
+static const QString MANIFEST_FILENAME = "batch.json";
+static const QString LOGS_FOLDER_NAME = "logs";
+
+// Rough peak memory of a single bake. A texture bake holds the decoded source, the converted image with its mips
+// and the compressed result; a model bake parses the whole file and then bakes the textures it embeds.
+static const qint64 MEGABYTE = 1024 * 1024;
+static const qint64 TEXTURE_BYTES_PER_PIXEL = 4 * 3;
+static const qint64 UNKNOWN_TEXTURE_ESTIMATE = 256 * MEGABYTE;
+static const qint64 MODEL_FILE_SIZE_FACTOR = 16;
+static const qint64 MODEL_BASE_ESTIMATE = 256 * MEGABYTE;
+static const qint64 UNKNOWN_MODEL_ESTIMATE = 1024 * MEGABYTE;
+static const qint64 MATERIAL_ESTIMATE = 256 * MEGABYTE;
+
+BatchBaker::BatchBaker(const QStringList& inputs, const QString& outputPath, const QString& cacheDirectory,
+                       int maxConcurrentBakes, qint64 memoryBudget, QObject* parent) :
+    QObject(parent),
+    _inputs(inputs),
+    _outputDirectory(outputPath),
+    _cacheDirectory(cacheDirectory),
+    _maxConcurrentBakes(std::max(maxConcurrentBakes, 1)),
+    _memoryBudget(memoryBudget)
+{
+}
+
+void BatchBaker::bake() {
+    for (auto& input : _inputs) {
+        QFileInfo inputInfo { input };
+        if (inputInfo.isDir()) {
+            addDirectory(inputInfo.absoluteFilePath());
+        } else if (input.endsWith(".json", Qt::CaseInsensitive) || input.endsWith(".json.gz", Qt::CaseInsensitive)) {
+            addDomainEntities(inputInfo.absoluteFilePath());
+        } else {
+            qCWarning(model_baking) << "Skipping batch input that is neither a directory nor an entities file:" << input;
+        }
+    }
+
+    qCDebug(model_baking) << "Batch has" << _jobs.size() << "unique bakes";
+
+    if (!_outputDirectory.mkpath(LOGS_FOLDER_NAME)) {
+        qCWarning(model_baking) << "Could not create batch output directory" << _outputDirectory.absolutePath();
+        emit finished(OVEN_STATUS_CODE_FAIL);
+        return;
+    }
+
+    startBakes();
+}
+
+void BatchBaker::addDomainEntities(const QString& path) {
+    QFile entitiesFile { path };
+    if (!entitiesFile.open(QIODevice::ReadOnly)) {
+        qCWarning(model_baking) << "Could not open entities file" << path;
+        ++_failedBakes;
+        return;
+    }
+
+    auto fileContents = entitiesFile.readAll();
+    if (QFileInfo(path).suffix() == "gz") {
+        QByteArray uncompressedContents;
+        gunzip(fileContents, uncompressedContents);
+        fileContents = uncompressedContents;
+    }
+
+    // entity URLs relative to the entities file are resolved against its location
+    QUrl entitiesFileURL = QUrl::fromLocalFile(path);
+    auto addProperty = [&](const QJsonObject& object, const QString& key, const QString& type, const QString& entityID,
+                           const QString& property) {
+        QString url = object[key].toString();
+        if (!url.isEmpty()) {
+            addAsset(entitiesFileURL.resolved(QUrl(url)), type, path + ": " + entityID + " " + property);
+        }
+    };
+
+    auto entities = QJsonDocument::fromJson(fileContents).object()["Entities"].toArray();
+    for (const auto& value : entities) {
+        auto entity = value.toObject();
+        QString entityID = entity["id"].toString();
+
+        // the same properties DomainBaker bakes
+        addProperty(entity, "modelURL", MODEL_TYPE, entityID, "modelURL");
+        addProperty(entity["animation"].toObject(), "url", MODEL_TYPE, entityID, "animation.url");
+        addProperty(entity["grab"].toObject(), "equippableIndicatorURL", MODEL_TYPE, entityID, "grab.equippableIndicatorURL");
+
+        QString entityType = entity["type"].toString();
+        if (entityType == "ParticleEffect" || entityType == "PolyLine") {
+            addProperty(entity, "textures", DEFAULT_TEXTURE_TYPE, entityID, "textures");
+        }
+        addProperty(entity, "imageURL", DEFAULT_TEXTURE_TYPE, entityID, "imageURL");
+        addProperty(entity, "xTextureURL", DEFAULT_TEXTURE_TYPE, entityID, "xTextureURL");
+        addProperty(entity, "yTextureURL", DEFAULT_TEXTURE_TYPE, entityID, "yTextureURL");
+        addProperty(entity, "zTextureURL", DEFAULT_TEXTURE_TYPE, entityID, "zTextureURL");
+        addProperty(entity["ambientLight"].toObject(), "ambientURL", AMBIENT_TEXTURE_TYPE, entityID, "ambientLight.ambientURL");
+        addProperty(entity["skybox"].toObject(), "url", SKYBOX_TEXTURE_TYPE, entityID, "skybox.url");
+
+        if (!entity["materialURL"].toString().startsWith("materialData")) {
+            addProperty(entity, "materialURL", MATERIAL_TYPE, entityID, "materialURL");
+        }
+    }
+}
+
+void BatchBaker::addDirectory(const QString& path) {
+    auto imageFormats = QImageReader::supportedImageFormats();
+
+    QDirIterator it { path, QDir::Files, QDirIterator::Subdirectories };
+    while (it.hasNext()) {
+        QUrl url = QUrl::fromLocalFile(it.next());
+        QString extension = it.fileInfo().suffix().toLower();
+        if (extension == "fst" || extension == "fbx" || extension == "obj") {
+            if (!isModelBaked(url)) {
+                addAsset(url, MODEL_TYPE, it.filePath());
+            }
+        } else if (imageFormats.contains(extension.toLatin1())) {
+            addAsset(url, DEFAULT_TEXTURE_TYPE, it.filePath());
+        }
+    }
+}
+
+void BatchBaker::addAsset(const QUrl& url, const QString& type, const QString& reference) {
+    if (type == MODEL_TYPE && getBakeableModelURL(url).isEmpty()) {
+        return;
+    }
+    if (!url.isLocalFile() && url.scheme() != "http" && url.scheme() != "https" && url.scheme() != "ftp") {
+        qCWarning(model_baking) << "Skipping" << url << "referenced by" << reference << "- the oven cannot fetch it";
+        return;
+    }
+
+    // identical local content shares one bake; remote assets can only be matched by URL
+    QByteArray bakeOptions = TextureBaker::isCompressionEnabled() ? "compressed" : "uncompressed";
+    QByteArray key = BakeCache::computeKey(url, type, bakeOptions);
+    if (key.isEmpty()) {
+        key = QCryptographicHash::hash(url.toString().toUtf8() + '\n' + type.toUtf8() + '\n' + bakeOptions,
+                                       QCryptographicHash::Sha256).toHex();
+    }
+
+    auto existing = _jobsByKey.find(QString::fromLatin1(key));
+    if (existing != _jobsByKey.end()) {
+        _jobs[existing.value()].references << reference;
+        return;
+    }
+
+    Job job;
+    job.input = url;
+    job.type = type;
+    job.key = QString::fromLatin1(key);
+    job.memoryEstimate = estimateMemory(url, type);
+    job.references << reference;
+
+    _jobsByKey.insert(job.key, _jobs.size());
+    _pendingJobs.push_back(_jobs.size());
+    _jobs.push_back(job);
+}
+
+qint64 BatchBaker::estimateMemory(const QUrl& url, const QString& type) {
+    if (type == MATERIAL_TYPE) {
+        return MATERIAL_ESTIMATE;
+    }
+
+    if (type == MODEL_TYPE) {
+        QFileInfo modelInfo { url.toLocalFile() };
+        if (!url.isLocalFile() || !modelInfo.exists()) {
+            return UNKNOWN_MODEL_ESTIMATE;
+        }
+        return MODEL_BASE_ESTIMATE + modelInfo.size() * MODEL_FILE_SIZE_FACTOR;
+    }
+
+    if (url.isLocalFile()) {
+        // reads the image header only
+        QSize size = QImageReader(url.toLocalFile()).size();
+        if (size.isValid()) {
+            return (qint64)size.width() * size.height() * TEXTURE_BYTES_PER_PIXEL;
+        }
+    }
+    return UNKNOWN_TEXTURE_ESTIMATE;
+}
+
+void BatchBaker::startBakes() {
+    while (_runningBakes < _maxConcurrentBakes && !_pendingJobs.empty()) {
+        auto next = std::find_if(_pendingJobs.begin(), _pendingJobs.end(), [this](size_t jobIndex) {
+            return _memoryInFlight + _jobs[jobIndex].memoryEstimate <= _memoryBudget;
+        });
+        if (next == _pendingJobs.end()) {
+            if (_runningBakes > 0) {
+                // wait for a running bake to free its memory
+                break;
+            }
+            // larger than the whole budget, run it on its own
+            next = _pendingJobs.begin();
+        }
+
+        size_t jobIndex = *next;
+        _pendingJobs.erase(next);
+        startBake(jobIndex);
+    }
+
+    if (_runningBakes == 0 && _pendingJobs.empty()) {
+        writeManifest();
+        emit finished(_failedBakes > 0 ? OVEN_STATUS_CODE_FAIL : OVEN_STATUS_CODE_SUCCESS);
+    }
+}
+
+void BatchBaker::startBake(size_t jobIndex) {
+    auto& job = _jobs[jobIndex];
+
+    // a previous batch may have left output here, and model bakers pick a new folder rather than overwrite one
+    QDir jobOutputDirectory { _outputDirectory.absoluteFilePath(job.key) };
+    jobOutputDirectory.removeRecursively();
+    _outputDirectory.mkpath(job.key);
+
+    QStringList arguments {
+        "-i", job.input.isLocalFile() ? job.input.toLocalFile() : job.input.toString(),
+        "-o", jobOutputDirectory.absolutePath(),
+        "-t", job.type
+    };
+    if (!_cacheDirectory.isEmpty()) {
+        arguments << "--cache" << _cacheDirectory;
+    }
+    if (!TextureBaker::isCompressionEnabled()) {
+        arguments << "--disable-texture-compression";
+    }
+
+    // each bake runs in its own process, as the asset server does, so that a crash only fails its own asset
+    auto process = new QProcess(this);
+    process->setProcessChannelMode(QProcess::MergedChannels);
+    process->setStandardOutputFile(_outputDirectory.absoluteFilePath(LOGS_FOLDER_NAME + "/" + job.key + ".log"));
+
+    connect(process, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+            this, [this, process, jobIndex](int exitCode, QProcess::ExitStatus exitStatus) {
+        process->deleteLater();
+        finishBake(jobIndex, exitStatus == QProcess::NormalExit && exitCode == OVEN_STATUS_CODE_SUCCESS);
+    });
+    connect(process, &QProcess::errorOccurred, this, [this, process, jobIndex](QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart) {
+            process->deleteLater();
+            finishBake(jobIndex, false);
+        }
+    });
+
+    ++_runningBakes;
+    _memoryInFlight += job.memoryEstimate;
+
+    qCDebug(model_baking) << "Baking" << job.input << "for" << job.references.size() << "references";
+    process->start(QCoreApplication::applicationFilePath(), arguments);
+}
+
+void BatchBaker::finishBake(size_t jobIndex, bool succeeded) {
+    auto& job = _jobs[jobIndex];
+    job.succeeded = succeeded;
+    if (!succeeded) {
+        qCWarning(model_baking) << "Failed to bake" << job.input;
+        ++_failedBakes;
+    }
+
+    --_runningBakes;
+    _memoryInFlight -= job.memoryEstimate;
+    startBakes();
+}
+
+void BatchBaker::writeManifest() {
+    QJsonArray bakes;
+    for (auto& job : _jobs) {
+        bakes.append(QJsonObject {
+            { "input", job.input.toString() },
+            { "type", job.type },
+            { "output", job.key },
+            { "succeeded", job.succeeded },
+            { "references", QJsonArray::fromStringList(job.references) }
+        });
+    }
+
+    QFile manifest { _outputDirectory.absoluteFilePath(MANIFEST_FILENAME) };
+    if (!manifest.open(QIODevice::WriteOnly) ||
+        manifest.write(QJsonDocument(QJsonObject { { "bakes", bakes } }).toJson()) < 0) {
+        qCWarning(model_baking) << "Could not write" << manifest.fileName();
+        ++_failedBakes;
+    }
+}
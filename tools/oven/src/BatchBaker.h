@@ -0,0 +1,74 @@
+//
+//  BatchBaker.h
+//  tools/oven/src
+//
+//  Copyright 2026 Tivoli Cloud VR, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BatchBaker_h
+#define hifi_BatchBaker_h
+
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QUrl>
+
+// Bakes every asset referenced by a set of domain entity files (.json or .json.gz) and asset directories.
+// Assets with the same content are baked once no matter how many entities or domains reference them. Each bake
+// runs in its own oven process, at most maxConcurrentBakes at a time, and a bake is only started while the
+// estimated peak memory of the bakes in flight stays within memoryBudget. Results are written to
+// <output>/<key>/ and listed in <output>/batch.json.
+class BatchBaker : public QObject {
+    Q_OBJECT
+
+public:
+    BatchBaker(const QStringList& inputs, const QString& outputPath, const QString& cacheDirectory,
+               int maxConcurrentBakes, qint64 memoryBudget, QObject* parent = nullptr);
+
+public slots:
+    void bake();
+
+signals:
+    void finished(int exitCode);
+
+private:
+    struct Job {
+        QUrl input;
+        QString type;
+        QString key;
+        qint64 memoryEstimate { 0 };
+        QStringList references;
+        bool succeeded { false };
+    };
+
+    void addDomainEntities(const QString& path);
+    void addDirectory(const QString& path);
+    void addAsset(const QUrl& url, const QString& type, const QString& reference);
+    static qint64 estimateMemory(const QUrl& url, const QString& type);
+
+    void startBakes();
+    void startBake(size_t jobIndex);
+    void finishBake(size_t jobIndex, bool succeeded);
+    void writeManifest();
+
+    QStringList _inputs;
+    QDir _outputDirectory;
+    QString _cacheDirectory;
+    int _maxConcurrentBakes;
+    qint64 _memoryBudget;
+
+    std::vector<Job> _jobs;
+    QHash<QString, size_t> _jobsByKey;
+    std::vector<size_t> _pendingJobs;
+    int _runningBakes { 0 };
+    qint64 _memoryInFlight { 0 };
+    int _failedBakes { 0 };
+};
+
+#endif // hifi_BatchBaker_h
@@ -12,6 +12,7 @@
 #include "OvenCLIApplication.h"
 
 #include <QtCore/QCommandLineParser>
+#include <QtCore/QThread>
 #include <QtCore/QUrl>
 
 #include <iostream>
@@ -20,22 +21,42 @@
 #include <TextureBaker.h>
 
 #include "BakerCLI.h"
+#include "BatchBaker.h"
 
 static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_CACHE_PARAMETER = "cache";
+static const QString CLI_BATCH_PARAMETER = "batch";
+static const QString CLI_JOBS_PARAMETER = "jobs";
+static const QString CLI_MEMORY_BUDGET_PARAMETER = "memory-budget";
+
+static const qint64 DEFAULT_MEMORY_BUDGET_MB = 4096;
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QString OvenCLIApplication::_cacheDirectoryParameter;
+QStringList OvenCLIApplication::_batchParameter;
+int OvenCLIApplication::_jobsParameter { 0 };
+qint64 OvenCLIApplication::_memoryBudgetParameter { 0 };
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
 {
+    if (!_batchParameter.isEmpty()) {
+        BatchBaker* batch = new BatchBaker(_batchParameter, _outputUrlParameter.toString(), _cacheDirectoryParameter,
+                                           _jobsParameter, _memoryBudgetParameter, this);
+        connect(batch, &BatchBaker::finished, this, &QCoreApplication::exit);
+        QMetaObject::invokeMethod(batch, "bake", Qt::QueuedConnection);
+        return;
+    }
+
     BakerCLI* cli = new BakerCLI(this);
     QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
-                              Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
+                              Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter),
+                              Q_ARG(QString, _cacheDirectoryParameter));
 }
 
 void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
@@ -47,7 +68,12 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
         { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_CACHE_PARAMETER, "Path to a persistent bake cache. Inputs whose content was already baked are restored from it.", "cache" },
+        { CLI_BATCH_PARAMETER, "Domain entities file (.json or .json.gz) or asset directory to bake along with the others given. "
+                               "Each distinct asset is baked once into <output>/<key>, listed in <output>/batch.json.", "batch" },
+        { CLI_JOBS_PARAMETER, "Maximum number of batch bakes to run at once. Defaults to the number of cores.", "jobs" },
+        { CLI_MEMORY_BUDGET_PARAMETER, "Estimated memory, in MB, that concurrent batch bakes may use. Defaults to 4096.", "megabytes" }
     });
 
     auto versionOption = parser.addVersionOption();
@@ -75,18 +101,33 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         Q_UNREACHABLE();
     }
 
-    if (!parser.isSet(CLI_INPUT_PARAMETER) || !parser.isSet(CLI_OUTPUT_PARAMETER)) {
+    bool isBatch = parser.isSet(CLI_BATCH_PARAMETER);
+    if ((!isBatch && !parser.isSet(CLI_INPUT_PARAMETER)) || !parser.isSet(CLI_OUTPUT_PARAMETER)) {
         std::cout << "Error: Input and Output not set" << std::endl; // Avoid Qt log spam
         QCoreApplication mockApp(argc, argv); // required for call to showHelp()
         parser.showHelp();
         Q_UNREACHABLE();
     }
 
+    if (isBatch) {
+        for (auto& input : parser.values(CLI_BATCH_PARAMETER)) {
+            _batchParameter << QDir::fromNativeSeparators(input);
+        }
+        _jobsParameter = parser.isSet(CLI_JOBS_PARAMETER) ? parser.value(CLI_JOBS_PARAMETER).toInt() : QThread::idealThreadCount();
+        qint64 memoryBudgetMB = parser.isSet(CLI_MEMORY_BUDGET_PARAMETER) ?
+            parser.value(CLI_MEMORY_BUDGET_PARAMETER).toLongLong() : DEFAULT_MEMORY_BUDGET_MB;
+        _memoryBudgetParameter = memoryBudgetMB * 1024 * 1024;
+    }
+
     _inputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_INPUT_PARAMETER));
     _outputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_OUTPUT_PARAMETER));
 
     _typeParameter = parser.isSet(CLI_TYPE_PARAMETER) ? parser.value(CLI_TYPE_PARAMETER) : QString();
 
+    if (parser.isSet(CLI_CACHE_PARAMETER)) {
+        _cacheDirectoryParameter = QDir::fromNativeSeparators(parser.value(CLI_CACHE_PARAMETER));
+    }
+
     if (parser.isSet(CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER)) {
         qDebug() << "Disabling texture compression";
         TextureBaker::setCompressionEnabled(false);
@@ -29,6 +29,10 @@ private:
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static QString _cacheDirectoryParameter;
+    static QStringList _batchParameter;
+    static int _jobsParameter;
+    static qint64 _memoryBudgetParameter;
 };
 
 #endif // hifi_OvenCLIApplication_h